@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/LogicEngineImpl.h"
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    static void BM_Update_ConcurrentEngines(benchmark::State& state)
+    {
+        // Each benchmark thread owns an engine, like an application with one engine per display
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string_view scriptSrc = R"(
+            function interface()
+                IN.param = INT
+                OUT.param = INT
+            end
+            function run()
+                for i = 0,100,1 do
+                    OUT.param = IN.param + i
+                end
+            end
+        )";
+
+        LuaScript* previousScript = nullptr;
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            LuaScript* script = logicEngine.createLuaScriptFromSource(scriptSrc, fmt::format("script{}", i));
+            if (previousScript != nullptr)
+            {
+                logicEngine.link(*previousScript->getOutputs()->getChild("param"), *script->getInputs()->getChild("param"));
+            }
+            previousScript = script;
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.m_impl->update(true);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Measures whether engines on separate threads slow down each other. With linear scaling, the aggregated
+    // items per second grow with the thread count, and the real time per update stays the same
+    // Dirty handling: off
+    // ARG: how many linked scripts each engine executes per update
+    BENCHMARK(BM_Update_ConcurrentEngines)->Arg(10)->Arg(100)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+}
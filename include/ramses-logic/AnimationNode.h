@@ -0,0 +1,158 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class AnimationNodeImpl;
+}
+
+namespace rlogic
+{
+    /**
+     * Interpolation between the keyframes of an #rlogic::AnimationChannel
+     */
+    enum class EInterpolationType : uint8_t
+    {
+        Step,   ///< Holds the value of the previous keyframe
+        Linear, ///< Interpolates the components linearly
+        Cubic,  ///< Cubic Hermite spline, requires in and out tangents for each keyframe
+        Slerp   ///< Spherical linear interpolation of quaternions (x, y, z, w), requires #rlogic::EPropertyType::Vec4f and keyframes with non-zero length
+    };
+
+    /**
+     * Keyframe data of one animated value of an #rlogic::AnimationNode. All values are stored as flat
+     * float arrays with one entry per component, i.e. a #rlogic::EPropertyType::Vec3f channel with 4 keyframes
+     * has 4 time stamps and 12 keyframe values.
+     */
+    struct AnimationChannel
+    {
+        /**
+         * Name of the channel, used as name of the output property of the #rlogic::AnimationNode
+         */
+        std::string name;
+
+        /**
+         * Type of the animated value, one of #rlogic::EPropertyType::Float, #rlogic::EPropertyType::Vec2f,
+         * #rlogic::EPropertyType::Vec3f or #rlogic::EPropertyType::Vec4f
+         */
+        EPropertyType type = EPropertyType::Float;
+
+        /**
+         * Interpolation between keyframes
+         */
+        EInterpolationType interpolation = EInterpolationType::Linear;
+
+        /**
+         * Time of each keyframe in seconds, must be strictly increasing
+         */
+        std::vector<float> timeStamps;
+
+        /**
+         * Keyframe values, one value per component for each time stamp
+         */
+        std::vector<float> keyframes;
+
+        /**
+         * Incoming tangents, same layout as #keyframes. Only used (and required) for #rlogic::EInterpolationType::Cubic
+         */
+        std::vector<float> tangentsIn;
+
+        /**
+         * Outgoing tangents, same layout as #keyframes. Only used (and required) for #rlogic::EInterpolationType::Cubic
+         */
+        std::vector<float> tangentsOut;
+    };
+
+    /**
+     * List of channels of an #rlogic::AnimationNode
+     */
+    using AnimationChannels = std::vector<AnimationChannel>;
+
+    /**
+     * A logic node which plays keyframe animations. It has the inputs
+     *  - time (FLOAT) - the point in time (in seconds) to evaluate the animation at
+     *  - loop (BOOL) - if true, the time is wrapped into the duration of the animation, otherwise it's clamped
+     *
+     * and one output per channel, named and typed after the channel. Outputs can be linked to scripts or bindings like
+     * outputs of any other logic node. Animation nodes are created by #rlogic::LogicEngine::createAnimationNode.
+     *
+     * The keyframes of all channels are stored in contiguous arrays and interpolated in one batch, so that a single node
+     * with many channels is considerably cheaper than many nodes (or scripts) with few channels.
+     */
+    class AnimationNode : public LogicNode
+    {
+    public:
+        /**
+         * Returns the duration of the animation, i.e. the largest time stamp of all channels
+         *
+         * @return the duration of the animation in seconds
+         */
+        [[nodiscard]] RLOGIC_API float getDuration() const;
+
+        /**
+         * Returns the number of animation channels, which is also the number of outputs of the node
+         *
+         * @return the number of channels
+         */
+        [[nodiscard]] RLOGIC_API size_t getChannelCount() const;
+
+        /**
+         * Constructor of AnimationNode. User is not supposed to call this - animation nodes are created by the #rlogic::LogicEngine
+         *
+         * @param impl implementation details of the node
+         */
+        explicit AnimationNode(std::unique_ptr<internal::AnimationNodeImpl> impl) noexcept;
+
+        /**
+         * Destructor of AnimationNode
+         */
+        ~AnimationNode() noexcept override;
+
+        /**
+         * Copy Constructor of AnimationNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to copy from
+         */
+        AnimationNode(const AnimationNode& other) = delete;
+
+        /**
+         * Move Constructor of AnimationNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        AnimationNode(AnimationNode&& other) = delete;
+
+        /**
+         * Assignment operator of AnimationNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to assign from
+         */
+        AnimationNode& operator=(const AnimationNode& other) = delete;
+
+        /**
+         * Move assignment operator of AnimationNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        AnimationNode& operator=(AnimationNode&& other) = delete;
+
+        /**
+         * Implementation detail of AnimationNode
+         */
+        std::unique_ptr<internal::AnimationNodeImpl> m_animationNode;
+    };
+}
@@ -0,0 +1,117 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class ExpressionNodeImpl;
+}
+
+namespace rlogic
+{
+    /**
+     * Declaration of an input or output of an #rlogic::ExpressionNode
+     */
+    struct ExpressionVariable
+    {
+        /**
+         * Name of the property, referenced as IN.name or OUT.name in the expression
+         */
+        std::string name;
+
+        /**
+         * Type of the property, one of #rlogic::EPropertyType::Float, #rlogic::EPropertyType::Vec2f,
+         * #rlogic::EPropertyType::Vec3f, #rlogic::EPropertyType::Vec4f, #rlogic::EPropertyType::Int32
+         * or #rlogic::EPropertyType::Bool
+         */
+        EPropertyType type = EPropertyType::Float;
+    };
+
+    /**
+     * List of inputs or outputs of an #rlogic::ExpressionNode
+     */
+    using ExpressionVariables = std::vector<ExpressionVariable>;
+
+    /**
+     * A logic node which computes its outputs from its inputs by a list of math expressions, e.g.
+     *
+     * \code{.lua}
+     *   OUT.y = IN.a * 0.5 + IN.b
+     *   OUT.visible = IN.distance < 10.0 and IN.enabled
+     * \endcode
+     *
+     * The expressions are compiled once when the node is created and evaluated without calling into Lua, which
+     * makes expression nodes much cheaper than #rlogic::LuaScript instances for simple computations. See
+     * the "Expression nodes" section of the documentation for the supported operators and functions.
+     * Expression nodes are created by #rlogic::LogicEngine::createExpressionNode.
+     */
+    class ExpressionNode : public LogicNode
+    {
+    public:
+        /**
+         * Returns the source code of the expressions the node was created with
+         *
+         * @return the source code of the node
+         */
+        [[nodiscard]] RLOGIC_API std::string_view getSource() const;
+
+        /**
+         * Constructor of ExpressionNode. User is not supposed to call this - expression nodes are created by the #rlogic::LogicEngine
+         *
+         * @param impl implementation details of the node
+         */
+        explicit ExpressionNode(std::unique_ptr<internal::ExpressionNodeImpl> impl) noexcept;
+
+        /**
+         * Destructor of ExpressionNode
+         */
+        ~ExpressionNode() noexcept override;
+
+        /**
+         * Copy Constructor of ExpressionNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to copy from
+         */
+        ExpressionNode(const ExpressionNode& other) = delete;
+
+        /**
+         * Move Constructor of ExpressionNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        ExpressionNode(ExpressionNode&& other) = delete;
+
+        /**
+         * Assignment operator of ExpressionNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to assign from
+         */
+        ExpressionNode& operator=(const ExpressionNode& other) = delete;
+
+        /**
+         * Move assignment operator of ExpressionNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        ExpressionNode& operator=(ExpressionNode&& other) = delete;
+
+        /**
+         * Implementation detail of ExpressionNode
+         */
+        std::unique_ptr<internal::ExpressionNodeImpl> m_expressionNode;
+    };
+}
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace rlogic
+{
+    class Property;
+
+    /**
+     * Maps a value in the memory block of an input channel to an input property, see #rlogic::LogicEngine::attachInputChannel.
+     *
+     * Values are stored as 32 bit words in the byte order of the platform: floats as IEEE 754 single precision,
+     * integers as int32 and booleans as uint32 (0 is false, everything else true). Vectors use one word per component.
+     */
+    struct InputChannelField
+    {
+        /**
+         * Byte offset of the value in the memory block. Must be a multiple of 4 and can't be 0, the first word
+         * of the memory block is the sequence counter of the channel
+         */
+        size_t offset = 0u;
+
+        /**
+         * Input property which receives the value. Must be an input of type #rlogic::EPropertyType::Float,
+         * #rlogic::EPropertyType::Int32, #rlogic::EPropertyType::Bool or one of the vector types
+         */
+        Property* input = nullptr;
+    };
+
+    /**
+     * Layout of the memory block of an input channel
+     */
+    using InputChannelLayout = std::vector<InputChannelField>;
+}
@@ -18,6 +18,9 @@
  * Interface to interact with the internal logger. If you want to handle log messages by yourself, you can
  * register your own log handler function with #rlogic::Logger::SetLogHandler, which is called each time
  * a log message is logged. In addition you can silence the standard output of the log messages
+ *
+ * The logger is shared by all #rlogic::LogicEngine instances. All functions can be called from any thread, also while
+ * engines are updated on other threads. Messages below the verbosity limit are dropped without any synchronization.
  */
 namespace rlogic::Logger
 {
@@ -58,6 +61,8 @@ namespace rlogic::Logger
     * Sets a custom log handler function, which is called each time a log message occurs.
     * Note: setting a custom logger incurs a slight performance cost because log messages
     * will be assembled and reported, even if default logging is disabled (#SetDefaultLogging).
+    * The function is called on the thread which logs the message (see #SetAsyncLogging for the exception), but never
+    * concurrently. It must not call #SetLogHandler or #SetAsyncLogging itself.
     *
     * @ param logHandlerFunc function which is called for each log message
     */
@@ -69,4 +74,15 @@ namespace rlogic::Logger
     * @param loggingEnabled true if you want to enable logging to std::out, false otherwise
     */
     RLOGIC_API void SetDefaultLogging(bool loggingEnabled);
+
+    /**
+    * Enables or disables asynchronous logging. Disabled by default. If enabled, threads which log a message only copy it
+    * into a lock-free ring buffer of fixed size, and a separate thread passes it to the default logging and the
+    * custom log handler. Logging then never blocks #rlogic::LogicEngine::update, but the log handler is called on the
+    * separate thread. If the buffer is full, messages are dropped and the number of dropped messages is logged as a warning.
+    * Disabling asynchronous logging outputs the remaining messages and stops the thread.
+    *
+    * @param enabled true to log asynchronously, false to log on the thread which issues the message
+    */
+    RLOGIC_API void SetAsyncLogging(bool enabled);
 }
@@ -9,12 +9,25 @@
 #pragma once
 
 #include "ramses-logic/APIExport.h"
+#include "ramses-logic/EPropertyType.h"
 #include "ramses-logic/LuaScript.h"
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
 #include "ramses-logic/Collection.h"
 #include "ramses-logic/ErrorData.h"
+#include "ramses-logic/LuaMemoryStatistics.h"
+#include "ramses-logic/InputChannel.h"
+#include "ramses-logic/OutputSnapshot.h"
 
+#include <chrono>
+#include <functional>
 #include <vector>
 #include <string_view>
+#include <future>
+#include <cstdint>
+#include <limits>
+#include <utility>
 
 namespace ramses
 {
@@ -86,6 +99,27 @@ namespace rlogic
          */
         [[nodiscard]] RLOGIC_API Collection<RamsesCameraBinding> ramsesCameraBindings() const;
 
+        /**
+         * Returns an iterable #rlogic::Collection of all #rlogic::NativeLogicNode instances created by this #LogicEngine.
+         *
+         * @return an iterable #rlogic::Collection with all #rlogic::NativeLogicNode created by this #LogicEngine
+         */
+        [[nodiscard]] RLOGIC_API Collection<NativeLogicNode> nativeLogicNodes() const;
+
+        /**
+         * Returns an iterable #rlogic::Collection of all #rlogic::AnimationNode instances created by this #LogicEngine.
+         *
+         * @return an iterable #rlogic::Collection with all #rlogic::AnimationNode created by this #LogicEngine
+         */
+        [[nodiscard]] RLOGIC_API Collection<AnimationNode> animationNodes() const;
+
+        /**
+         * Returns an iterable #rlogic::Collection of all #rlogic::ExpressionNode instances created by this #LogicEngine.
+         *
+         * @return an iterable #rlogic::Collection with all #rlogic::ExpressionNode created by this #LogicEngine
+         */
+        [[nodiscard]] RLOGIC_API Collection<ExpressionNode> expressionNodes() const;
+
         /**
          * Returns a pointer to the first occurrence of a script with a given \p name if such exists, and nullptr otherwise.
          *
@@ -118,6 +152,30 @@ namespace rlogic
          */
         [[nodiscard]] RLOGIC_API RamsesCameraBinding* findCameraBinding(std::string_view name) const;
 
+        /**
+         * Returns a pointer to the first occurrence of a native logic node with a given \p name if such exists, and nullptr otherwise.
+         *
+         * @param name the name of the native logic node to search for
+         * @return a pointer to the native logic node, or nullptr if none was found
+         */
+        [[nodiscard]] RLOGIC_API NativeLogicNode* findNativeLogicNode(std::string_view name) const;
+
+        /**
+         * Returns a pointer to the first occurrence of an animation node with a given \p name if such exists, and nullptr otherwise.
+         *
+         * @param name the name of the animation node to search for
+         * @return a pointer to the animation node, or nullptr if none was found
+         */
+        [[nodiscard]] RLOGIC_API AnimationNode* findAnimationNode(std::string_view name) const;
+
+        /**
+         * Returns a pointer to the first occurrence of an expression node with a given \p name if such exists, and nullptr otherwise.
+         *
+         * @param name the name of the expression node to search for
+         * @return a pointer to the expression node, or nullptr if none was found
+         */
+        [[nodiscard]] RLOGIC_API ExpressionNode* findExpressionNode(std::string_view name) const;
+
         /**
          * Creates a new #rlogic::LuaScript from an existing Lua source file. Refer to the #rlogic::LuaScript class documentation
          * for requirements that Lua scripts must fulfill in order to be added to the #LogicEngine.
@@ -185,6 +243,66 @@ namespace rlogic
          */
         RLOGIC_API RamsesCameraBinding* createRamsesCameraBinding(ramses::Camera& ramsesCamera, std::string_view name ="");
 
+        /**
+         * Registers a type of logic node which is implemented in C++. Nodes of this type are created with #createNativeLogicNode.
+         * The interface of the type is checked: property names must be unique among siblings, only primitive types and structs
+         * are supported, and the update function must be set.
+         * Native logic nodes are saved with their type name, values and links. The type must be registered with the same
+         * interface before loading them, otherwise loading fails.
+         * Registering a type again with the same name fails, nodes keep the type they were created with.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param typeName unique name of the type
+         * @param type interface and update function of the type
+         * @return true if the type was registered, false otherwise. In that case, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool registerNativeLogicNodeType(std::string_view typeName, NativeLogicNodeType type);
+
+        /**
+         * Creates a new #rlogic::NativeLogicNode of a type registered with #registerNativeLogicNodeType.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param typeName name of the registered type
+         * @param name name of the node
+         * @return a pointer to the created object or nullptr if the type is not registered. In that case, use #getErrors() to obtain errors.
+         * The node can be destroyed by calling the #destroy method
+         */
+        RLOGIC_API NativeLogicNode* createNativeLogicNode(std::string_view typeName, std::string_view name = "");
+
+        /**
+         * Creates a new #rlogic::AnimationNode which interpolates the given keyframe \p channels. The keyframe data is copied
+         * and checked for consistency: channel names must be unique, time stamps strictly increasing and the number of
+         * keyframe values (and tangents for cubic interpolation) must match the number of time stamps and the channel type.
+         * See #rlogic::AnimationNode for the inputs and outputs of the node.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param channels keyframe data of the animated values
+         * @param name name of the node
+         * @return a pointer to the created object or nullptr if the channels are invalid. In that case, use #getErrors() to obtain errors.
+         * The node can be destroyed by calling the #destroy method
+         */
+        RLOGIC_API AnimationNode* createAnimationNode(const AnimationChannels& channels, std::string_view name = "");
+
+        /**
+         * Creates a new #rlogic::ExpressionNode which computes the declared \p outputs from the declared \p inputs
+         * by the expressions in \p source. Each output has to be assigned exactly once, e.g. "OUT.y = IN.a * 0.5 + IN.b".
+         * The source is compiled when the node is created, syntax and type errors are reported by this method.
+         * See #rlogic::ExpressionNode and the documentation for the syntax.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param source the expressions which assign the outputs
+         * @param inputs names and types of the inputs of the node
+         * @param outputs names and types of the outputs of the node
+         * @param name name of the node
+         * @return a pointer to the created object or nullptr if the source can't be compiled. In that case, use #getErrors() to obtain errors.
+         * The node can be destroyed by calling the #destroy method
+         */
+        RLOGIC_API ExpressionNode* createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, std::string_view name = "");
+
         /**
          * Updates all #rlogic::LogicNode's which were created by this #LogicEngine instance.
          * The order in which #rlogic::LogicNode's are executed is determined by the links created
@@ -192,7 +310,8 @@ namespace rlogic
          * between then are executed in arbitrary order, but the order is always the same between two
          * invocations of #update without any calls to #link or #unlink between them.
          * As an optimization #rlogic::LogicNode's are only updated, if at least one input of a #rlogic::LogicNode
-         * has changed since the last call to #update. If the links between logic nodes create a loop,
+         * has changed since the last call to #update, and not more often than allowed by #rlogic::LogicNode::setUpdateInterval
+         * and #rlogic::LogicNode::setMinimumTimeBetweenUpdates. If the links between logic nodes create a loop,
          * this method will fail with an error and will not execute any of the logic nodes.
          *
          * Attention! This method clears all previous errors! See also docs of #getErrors()
@@ -202,21 +321,257 @@ namespace rlogic
          */
         RLOGIC_API bool update();
 
+        /**
+         * Sets the clock which #update reads once at its beginning to check #rlogic::LogicNode::setMinimumTimeBetweenUpdates.
+         * By default, std::chrono::steady_clock::now is used. Applications which have their own frame time or tests which
+         * need deterministic timing can set another clock, passing nullptr restores the default clock.
+         * The time returned by \p clock must not go backwards.
+         *
+         * @param clock function which returns the current time
+         */
+        RLOGIC_API void setUpdateClock(std::function<std::chrono::steady_clock::time_point()> clock);
+
+        /**
+         * Enables or disables the tracking of changes for all outputs of all logic nodes. Disabled by default. If enabled,
+         * #update collects the outputs whose value changed during the update, they can be obtained with #getChangedOutputs.
+         * Use #subscribeToOutputChanges instead to track only a selected set of outputs.
+         *
+         * @param enabled true to report changes of all outputs, false to report only changes of subscribed outputs
+         */
+        RLOGIC_API void setOutputChangeTracking(bool enabled);
+
+        /**
+         * Subscribes to changes of an output property, so that #update reports it in #getChangedOutputs when its value changed.
+         * If \p output is a struct or an array, all of its children are subscribed. Subscriptions are not saved to files.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param output the output property to subscribe to
+         * @return true if the property was subscribed, false if it's not an output of a #rlogic::LogicNode of this #LogicEngine
+         */
+        RLOGIC_API bool subscribeToOutputChanges(const Property& output);
+
+        /**
+         * Removes the subscription of an output property (see #subscribeToOutputChanges). If \p output is a struct or an array,
+         * the subscriptions of all of its children are removed as well.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param output the output property to unsubscribe from
+         * @return true if the subscription was removed, false if the property is not an output of a #rlogic::LogicNode of this #LogicEngine
+         */
+        RLOGIC_API bool unsubscribeFromOutputChanges(const Property& output);
+
+        /**
+         * Returns the primitive output properties whose value changed during the last call to #update, in the order in which the
+         * logic nodes were executed. Only outputs which are subscribed (see #subscribeToOutputChanges) are reported, or all
+         * outputs if #setOutputChangeTracking is enabled. Structs and arrays are never reported themselves, only their children.
+         * The list is reused by each #update, so collecting changes doesn't allocate memory once the list reached its maximum size.
+         *
+         * The returned list is valid until the next call to #update, #destroy or a load method.
+         *
+         * @return list of output properties which changed during the last #update
+         */
+        [[nodiscard]] RLOGIC_API const std::vector<const Property*>& getChangedOutputs() const;
+
+        /**
+         * Queues a value for an input property, which is set at the beginning of the next #update as if #rlogic::Property::set
+         * was called. Unlike all other methods, this method can be called from any thread, also from several threads at the
+         * same time and while #update is executed. Producer threads don't block each other or the update thread, the values
+         * are stored in a lock-free queue of fixed size (see #setInputQueueCapacity).
+         *
+         * If several values are queued for the same property before an #update, only the last one is set, i.e. the property
+         * changes at most once per #update. Values for properties which are linked when the value is applied are dropped with
+         * an error log, same as with #rlogic::Property::set. The property must not be destroyed before the next #update,
+         * destroying a logic node or loading content discards all queued values.
+         *
+         * Attention! We recommend always specifying the template argument T explicitly, and don't rely on the compiler's
+         * type deduction! If T is not one of the supported types, a static_assert will be triggered!
+         *
+         * @param input the input property to set
+         * @param value the value to set
+         * @return true if the value was queued, false if the queue is full, \p input is not a primitive input or T doesn't
+         * match its type. Doesn't log errors or modify #getErrors, so that it is safe to call from other threads
+         */
+        template <typename T> bool enqueueInputValue(const Property& input, T value);
+
+        /**
+         * Sets the number of values which can be queued with #enqueueInputValue between two calls to #update. The capacity is rounded
+         * up to the next power of two, the default is 1024. Values which are currently queued are discarded.
+         *
+         * Attention! Unlike #enqueueInputValue, this method must not be called while other threads queue values.
+         *
+         * @param capacity maximum number of queued values
+         */
+        RLOGIC_API void setInputQueueCapacity(size_t capacity);
+
+        /**
+         * Attaches a memory block, usually shared memory which is written by another process, from which input values are read at the
+         * beginning of each #update. The #LogicEngine doesn't allocate, map or free the memory, it only reads from it with atomic word
+         * accesses, so reading doesn't involve system calls or locks. The \p layout maps byte offsets in the block to input properties,
+         * see #rlogic::InputChannelField for the format of the values.
+         *
+         * The first 4 bytes of the block are a sequence counter (uint32) which protects the values. The writer increments it to an odd
+         * value before it modifies any value and increments it again to an even value when all values are written, using atomic operations
+         * with release semantics. The #LogicEngine reads all values of the layout and applies them only if the counter was even and
+         * unchanged while reading, so it never applies values of an incomplete write. If the block is being written during several
+         * read attempts, the values are applied in one of the following updates. Values are applied only when the counter changed since
+         * the last time they were applied, with the same rules as #rlogic::Property::set (e.g. linked inputs can't be set).
+         *
+         * Destroying a #rlogic::LogicNode removes its properties from all layouts, loading content detaches all channels.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param memory start of the memory block, must be aligned to 4 bytes and stay valid until the channel is detached
+         * @param size size of the memory block in bytes
+         * @param layout offsets of the values in the memory block and the input properties which receive them
+         * @return true if the channel was attached, false otherwise. To get more detailed error information use #getErrors()
+         */
+        RLOGIC_API bool attachInputChannel(const void* memory, size_t size, const InputChannelLayout& layout);
+
+        /**
+         * Detaches a memory block which was attached with #attachInputChannel. The values which were already applied are kept.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param memory start of the memory block as passed to #attachInputChannel
+         * @return true if the channel was detached, false if \p memory is not attached
+         */
+        RLOGIC_API bool detachInputChannel(const void* memory);
+
+        /**
+         * Returns the number of times #update was called since this #LogicEngine was created. Snapshots of outputs
+         * are tagged with this number, see #readOutputSnapshot.
+         *
+         * @return number of #update calls
+         */
+        [[nodiscard]] RLOGIC_API uint64_t getUpdateCounter() const;
+
+        /**
+         * Adds an output property to the snapshots which are published at the end of each successful #update. If \p output is a struct
+         * or an array, all of its children are added. Other threads can read the snapshots with #readOutputSnapshot.
+         * The selected outputs are not saved to files.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param output the output property to publish
+         * @return true if the property was added, false if it's not an output of a #rlogic::LogicNode of this #LogicEngine
+         */
+        RLOGIC_API bool addOutputToSnapshot(const Property& output);
+
+        /**
+         * Removes an output property from the published snapshots (see #addOutputToSnapshot). If \p output is a struct or an array,
+         * all of its children are removed.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param output the output property to remove
+         * @return true if the property was removed, false if it's not an output of a #rlogic::LogicNode of this #LogicEngine
+         */
+        RLOGIC_API bool removeOutputFromSnapshot(const Property& output);
+
+        /**
+         * Sets the number of buffers which hold published snapshots, 3 by default (2 is the minimum). #update writes into a buffer
+         * which is neither the latest snapshot nor being read. If all of them are being read, the snapshot of that update is skipped
+         * and readers keep seeing the previous one. With 3 buffers this can only happen if more than one thread reads snapshots.
+         *
+         * Attention! Published snapshots are discarded. This method must not be called while other threads call #readOutputSnapshot!
+         *
+         * @param bufferCount number of snapshot buffers
+         */
+        RLOGIC_API void setOutputSnapshotBufferCount(size_t bufferCount);
+
+        /**
+         * Copies the latest published snapshot of outputs (see #addOutputToSnapshot) into \p snapshot. Unlike most other methods,
+         * this method can be called from any thread, also while #update is running. The values in \p snapshot are always the values
+         * of a single, completed #update, use #rlogic::OutputSnapshot::getUpdateCounter to find out of which one.
+         * This method never waits for a lock. It only copies values; it allocates memory only if \p snapshot needs more than before.
+         *
+         * Destroying a #rlogic::LogicNode or loading content invalidates all published snapshots, also the ones which were already
+         * read into \p snapshot (#rlogic::OutputSnapshot::get returns std::nullopt for them), until the next #update publishes a new one.
+         *
+         * The #LogicEngine must not be destroyed while other threads call this method.
+         *
+         * @param snapshot receives the values of the latest published snapshot
+         * @return true if \p snapshot was filled, false if no snapshot was published since the last destroy or load
+         */
+        [[nodiscard]] RLOGIC_API bool readOutputSnapshot(OutputSnapshot& snapshot) const;
+
+        /**
+         * Adds \p logicNode to the subgraph with the name \p subgraph, the subgraph is created if it doesn't exist yet.
+         * Subgraphs group nodes which can be suspended together with #suspendSubgraph, e.g. all nodes of a screen which is not shown.
+         * A node can be in at most one subgraph, it is removed from its previous subgraph. An empty \p subgraph only removes
+         * the node from its subgraph. A node which is added to a suspended subgraph is suspended immediately.
+         * Subgraphs are not saved to files.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param logicNode the node to add
+         * @param subgraph the name of the subgraph
+         * @return true if the node was added, false if \p logicNode is not a node of this #LogicEngine
+         */
+        RLOGIC_API bool setSubgraph(LogicNode& logicNode, std::string_view subgraph);
+
+        /**
+         * Returns the name of the subgraph which \p logicNode was added to with #setSubgraph.
+         *
+         * @param logicNode the node to look up
+         * @return the name of the subgraph of the node, or an empty string if it's not in a subgraph
+         */
+        [[nodiscard]] RLOGIC_API std::string_view getSubgraph(const LogicNode& logicNode) const;
+
+        /**
+         * Suspends all nodes of a subgraph (see #setSubgraph). #update skips suspended nodes entirely, they are neither executed
+         * nor do links to their inputs propagate values. Nodes linked to the outputs of suspended nodes keep seeing their last values.
+         * Values set on the inputs of suspended nodes are kept until the subgraph is resumed.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param subgraph the name of the subgraph
+         * @return true if the subgraph was suspended, false if no node was ever added to \p subgraph
+         */
+        RLOGIC_API bool suspendSubgraph(std::string_view subgraph);
+
+        /**
+         * Resumes a subgraph which was suspended with #suspendSubgraph. The changes which happened while it was suspended are applied
+         * in the next #update in the usual order of nodes: links deliver the current values of all outputs which changed in
+         * the meantime and the nodes whose inputs changed are executed, so the subgraph continues from a state which is consistent
+         * with the rest of the logic. Values which were overwritten while suspended are not seen.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param subgraph the name of the subgraph
+         * @return true if the subgraph was resumed, false if no node was ever added to \p subgraph
+         */
+        RLOGIC_API bool resumeSubgraph(std::string_view subgraph);
+
+        /**
+         * Checks if a subgraph is suspended, see #suspendSubgraph.
+         *
+         * @param subgraph the name of the subgraph
+         * @return true if \p subgraph is suspended, false if it's not suspended or doesn't exist
+         */
+        [[nodiscard]] RLOGIC_API bool isSubgraphSuspended(std::string_view subgraph) const;
+
         /**
          * Links a property of a #rlogic::LogicNode to another #rlogic::Property of another #rlogic::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
          * the \p targetProperty. Creating links influences the order in which scripts
          * are executed - if node A provides data to node B, then node A will be executed
          * before node B. A single output property (\p sourceProperty) can be linked to any number of input
-         * properties (\p targetProperty), but any input property can have at most one link to an output property
+         * properties (\p targetProperty), but any input property can have at most one link to an output property (see #linkComponent for the exception)
          * (links are directional and support a 1-to-N relationships).
          *
          * The #link() method will fail when:
          * - \p sourceProperty and \p targetProperty belong to the same #rlogic::LogicNode
          * - \p sourceProperty is not an output (see #rlogic::LogicNode::getOutputs())
          * - \p targetProperty is not an input (see #rlogic::LogicNode::getInputs())
-         * - either \p sourceProperty or \p targetProperty is not a primitive property (you have to link sub-properties
-         *   of structs and arrays individually)
+         * - \p sourceProperty and \p targetProperty are structs or arrays whose children don't have the same names and types,
+         *   or one of them is the root property returned by #rlogic::LogicNode::getInputs() or #rlogic::LogicNode::getOutputs()
+         * - \p targetProperty is a child of a linked struct or array, or a struct or array with linked children
+         *
+         * Structs and arrays are linked with a single link which copies all of their children in one loop during #update.
+         * Such a link can only be removed as a whole by calling #unlink with the same struct or array properties.
          *
          * Creating link loops will cause the next call to #update() to fail with an error. Loops
          * are directional, it is OK to have A->B, A->C and B->C, but is not OK to have
@@ -235,7 +590,49 @@ namespace rlogic
         RLOGIC_API bool link(const Property& sourceProperty, const Property& targetProperty);
 
         /**
-         * Unlinks two properties which were linked with #link. After a link is destroyed,
+         * Same as #link, but the value of \p sourceProperty is converted to the type of \p targetProperty
+         * during #update, e.g. INT32 to FLOAT or VEC3I to VEC3F. Numbers, booleans and numeric vectors can be converted
+         * into each other as long as they have the same number of components (booleans and scalars count as one component).
+         * Floats are converted to integers by truncating them towards zero, values which don't fit into INT32 are clamped
+         * to its limits and NaN becomes 0. Numbers convert to true if they are not zero, booleans convert to 0 or 1.
+         *
+         * Use this instead of scripts which only convert values - conversions are executed natively during
+         * link propagation and don't add any nodes to the graph. Converting links are removed with #unlink.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param sourceProperty the output property which will provide data for \p targetProperty
+         * @param targetProperty the target property which will receive the converted value of \p sourceProperty
+         * @return true if linking was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool linkWithConversion(const Property& sourceProperty, const Property& targetProperty);
+
+        /**
+         * Links a single component of \p sourceProperty to a single component of \p targetProperty, converting
+         * the value like #linkWithConversion if their types differ. Components are counted from 0 (x, y, z, w), scalars
+         * and booleans have a single component with index 0. For example, linking component 0 of a VEC3F output to a FLOAT
+         * input propagates only the x value, and linking three FLOAT outputs to the components 0, 1 and 2 of a VEC3F input
+         * assembles the vector from them.
+         *
+         * Unlike with #link, an input can have several component links, as long as each of them writes a different component.
+         * Components which are not linked keep their current value. The input can't have a component link and a
+         * link created with #link or #linkWithConversion at the same time. #unlink removes all component links between
+         * two properties.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param sourceProperty the output property which will provide data for \p targetProperty
+         * @param sourceComponent the index of the component of \p sourceProperty which will be propagated
+         * @param targetProperty the target property which will receive the component
+         * @param targetComponent the index of the component of \p targetProperty which will be overwritten
+         * @return true if linking was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool linkComponent(const Property& sourceProperty, size_t sourceComponent, const Property& targetProperty, size_t targetComponent);
+
+        /**
+         * Unlinks two properties which were linked with #link, #linkWithConversion or #linkComponent. After a link is destroyed,
          * calls to #update will no longer propagate the output value from the \p sourceProperty to
          * the input value of the \p targetProperty. The value of the \p targetProperty will remain as it was after the last call to #update -
          * it will **not** be restored to a default value or to any value which was set manually with calls to #rlogic::Property::set().
@@ -304,6 +701,74 @@ namespace rlogic
          */
         RLOGIC_API bool saveToFile(std::string_view filename);
 
+        /**
+         * Serializes the whole #LogicEngine into a caller-provided memory buffer. The data is the same as the one written
+         * by #saveToFile and can be loaded with #loadFromBuffer. No filesystem access is involved. The #LogicEngine
+         * serializes into internally owned memory which is reused by subsequent save calls, and then copies the result
+         * into \p buffer. If \p buffer is too small, the method fails and the error message contains the required size.
+         * Use #estimateSerializedSize to obtain a size for pre-allocating the buffer.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param buffer memory to write the serialized data to
+         * @param bufferSize size of \p buffer (bytes)
+         * @param bytesWritten set to the number of bytes written to \p buffer, or to 0 in case of errors
+         * @return true if saving was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool saveToBuffer(void* buffer, size_t bufferSize, size_t& bytesWritten);
+
+        /**
+         * Same as #saveToBuffer(void*, size_t, size_t&), but writes the data into a vector which is resized
+         * to the size of the serialized data. The capacity of the vector is reused if it is large enough, i.e.
+         * passing the same vector to subsequent save calls doesn't allocate memory.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param buffer vector which receives the serialized data
+         * @return true if saving was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool saveToBuffer(std::vector<uint8_t>& buffer);
+
+        /**
+         * Returns an estimate of the size (in bytes) which the serialized #LogicEngine content will have.
+         * After the #LogicEngine was saved once (with #saveToFile or #saveToBuffer) the size of the last saved
+         * data is returned, otherwise the size is guessed from the current content. The estimate is meant for
+         * pre-allocating memory and is not guaranteed to be an upper bound!
+         *
+         * @return the estimated size of the serialized data
+         */
+        [[nodiscard]] RLOGIC_API size_t estimateSerializedSize() const;
+
+        /**
+         * Captures the values of all inputs and outputs of all #rlogic::LogicNode instances (but not the nodes, scripts or
+         * links themselves) into a compact binary snapshot. Together with #restoreValueSnapshot this allows to quickly
+         * reset the values to a previous state, e.g. on suspend/resume, without reloading the whole #LogicEngine.
+         * The snapshot is only valid for the #LogicEngine content it was taken from (same objects, same properties),
+         * it is not meant to be stored across program versions or transferred to other platforms.
+         *
+         * @param snapshot vector which receives the snapshot data. Its capacity is reused, taking snapshots
+         * repeatedly into the same vector doesn't allocate memory.
+         */
+        RLOGIC_API void takeValueSnapshot(std::vector<uint8_t>& snapshot) const;
+
+        /**
+         * Restores the values captured with #takeValueSnapshot. The method fails if objects were created or destroyed
+         * since the snapshot was taken, or if their properties differ, and no value is changed in that case.
+         * Values of #rlogic::RamsesBinding inputs which differ from the current values are passed to Ramses on the
+         * next call to #update, as well as values which were not passed to Ramses yet when the snapshot was taken.
+         * Links are not modified.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param snapshotData pointer to the snapshot data
+         * @param snapshotSize size of the snapshot data (bytes)
+         * @return true if the values were restored, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool restoreValueSnapshot(const void* snapshotData, size_t snapshotSize);
+
         /**
          * Loads the whole LogicEngine data from the given file. See also #saveToFile().
          * After loading, the previous state of the #LogicEngine will be overwritten with the
@@ -312,8 +777,8 @@ namespace rlogic
          * will be used to resolve potential #rlogic::RamsesBinding objects which point to Ramses objects.
          * You can provide a nullptr if you know for sure that the
          * #LogicEngine loaded from the file has no #rlogic::RamsesBinding objects which point to a Ramses scene object.
-         * Otherwise, the call to #loadFromFile will fail with an error. In case of errors, the #LogicEngine
-         * may be left in an inconsistent state.
+         * Otherwise, the call to #loadFromFile will fail with an error. In case of errors, the content of the #LogicEngine
+         * is not modified.
          * For more in-depth information regarding saving and loading, refer to the online documentation at
          * https://ramses-logic.readthedocs.io/en/latest/api.html#saving-loading-from-file
          *
@@ -345,6 +810,141 @@ namespace rlogic
         */
         RLOGIC_API bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
 
+        /**
+         * Starts loading the whole LogicEngine data from the given file on a background thread and returns immediately.
+         * The data is loaded into a separate staging state (own Lua environment and own objects), the current
+         * content of the #LogicEngine is not affected and can be used and updated as usual while loading is in
+         * progress. Once the returned future is ready, call #commitAsyncLoad() to replace the current content with
+         * the loaded one. The replacement is cheap and does not parse or compile anything - it can be done between
+         * two frames without stalling the render loop. Only one asynchronous load can be pending at a time.
+         *
+         * The semantics of the data (errors, versions, resolving of Ramses objects) are the same as with #loadFromFile.
+         * Attention! The \p ramsesScene is accessed from the background thread - it must not be modified and must not
+         * be destroyed until the returned future is ready!
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param filename path to file from which to load content (relative or absolute)
+         * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
+         * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
+         *        Disable this only if the file comes from a trusted source and performance is paramount.
+         * @return a future which becomes ready when loading finished. Its value is true if the data was loaded
+         * successfully, false otherwise. The errors are reported by #commitAsyncLoad().
+         */
+        RLOGIC_API std::future<bool> loadFromFileAsync(std::string_view filename, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+
+        /**
+         * Same as #loadFromFileAsync, but loads the data from a memory buffer (see also #loadFromBuffer). The data is
+         * copied before this method returns, the memory can be freed or modified right after the call.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param rawBuffer pointer to the raw data in memory
+         * @param bufferSize size of the data (bytes)
+         * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
+         * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
+         *        Disable this only if the file comes from a trusted source and performance is paramount.
+         * @return a future which becomes ready when loading finished. Its value is true if the data was loaded
+         * successfully, false otherwise. The errors are reported by #commitAsyncLoad().
+         */
+        RLOGIC_API std::future<bool> loadFromBufferAsync(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+
+        /**
+         * Replaces the content of the #LogicEngine with the content loaded by #loadFromFileAsync or #loadFromBufferAsync.
+         * After committing, all previously created objects (scripts, bindings, etc.) are deleted and pointers to them
+         * are invalid, same as after #loadFromFile. This method never blocks - it fails if loading is still in progress,
+         * i.e. if the future returned by the load call is not ready yet. If loading failed, the content of the #LogicEngine
+         * is not changed and the loading errors are reported. In both cases, a new asynchronous load can be started afterwards.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @return true if the loaded content was applied, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool commitAsyncLoad();
+
+        /**
+         * Sets a hard limit for the memory which the Lua environment of the #LogicEngine can allocate. When a script
+         * tries to allocate more memory while it is executed, the allocation fails with a Lua error ("not enough memory")
+         * which is reported like any other script error, e.g. by #update. The allocation fails immediately, Lua doesn't
+         * collect garbage first. Garbage which was not collected yet counts against the limit, thus choose the step size of
+         * #setGarbageCollectionStep so that the heap stays below the limit (monitor it with #getLuaMemoryStatistics).
+         * Creating or loading scripts executes Lua code as well and fails the same way. Memory which is allocated
+         * by the #LogicEngine itself outside of script execution is accounted for, but never fails because of the limit.
+         * The limit also applies to content loaded in the future. Setting a limit lower than the currently used memory is
+         * allowed and lets all further growing allocations of scripts fail.
+         *
+         * @param maxBytes maximum number of bytes which scripts can allocate, 0 means no limit (default)
+         */
+        RLOGIC_API void setLuaMemoryLimit(size_t maxBytes);
+
+        /**
+         * Returns the current memory statistics of the Lua environment of the #LogicEngine, see #rlogic::LuaMemoryStatistics.
+         * The statistics are reset when content is loaded, because loading creates a new Lua environment.
+         *
+         * @return memory statistics of the Lua environment
+         */
+        [[nodiscard]] RLOGIC_API LuaMemoryStatistics getLuaMemoryStatistics() const;
+
+        /**
+         * Sets the amount of garbage collection work which #update performs at its end. The automatic garbage collection of Lua
+         * is disabled, so that collection doesn't happen at arbitrary points while scripts are executed. Instead, each #update
+         * performs one incremental collection step after all logic nodes were updated, with the work which Lua would do after
+         * \p stepSizeKB kilobytes were allocated. The step size should be chosen according to the amount of memory which scripts
+         * allocate per #update, otherwise memory usage keeps growing. With a memory limit (see #setLuaMemoryLimit), scripts fail
+         * when the garbage which was not collected yet and their live memory exceed the limit, the limit doesn't trigger a collection.
+         * Use #getLuaMemoryStatistics to monitor the heap size and the time spent for garbage collection.
+         *
+         * @param stepSizeKB size of the incremental collection step per #update in kilobytes (default: 64). 0 disables the
+         *        collection in #update, then #collectGarbage must be called regularly instead.
+         */
+        RLOGIC_API void setGarbageCollectionStep(size_t stepSizeKB);
+
+        /**
+         * Performs an incremental garbage collection step in the Lua environment. Use this to collect garbage at a point of
+         * the frame chosen by the application, e.g. after rendering, and disable the collection in #update by calling
+         * #setGarbageCollectionStep with 0. A very large step size finishes the current collection cycle.
+         *
+         * @param stepSizeKB amount of work of the step as number of allocated kilobytes, 0 performs the smallest possible step
+         * @return true if the step finished a collection cycle, false otherwise
+         */
+        RLOGIC_API bool collectGarbage(size_t stepSizeKB);
+
+        /**
+         * Enables or disables lazy compilation of scripts for all subsequent load calls (#loadFromFile, #loadFromBuffer
+         * and their asynchronous variants). Disabled by default. With lazy compilation, the properties of the loaded scripts
+         * are available right after loading, so that they can be linked and their inputs can be set, but the Lua source
+         * code is not parsed and executed until the script is updated for the first time or #prewarm is called. This reduces
+         * the loading time of files with many scripts which are not needed right away.
+         *
+         * Note that errors in the Lua source code of lazily compiled scripts are not reported by the load call, but when the
+         * script is compiled.
+         *
+         * @param enabled true to defer script compilation on load, false to compile all scripts during loading
+         */
+        RLOGIC_API void setLazyScriptCompilation(bool enabled);
+
+        /**
+         * Compiles scripts which were loaded with lazy compilation (see #setLazyScriptCompilation) and were not executed yet.
+         * Use this to move the compilation cost to idle time, e.g. by compiling a few scripts per frame. Scripts are
+         * compiled in the order of #scripts(). Has no effect if all scripts are compiled already.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param maxScriptCount maximum number of scripts to compile in this call
+         * @return true if no script failed to compile, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool prewarm(size_t maxScriptCount = std::numeric_limits<size_t>::max());
+
+        /**
+         * Returns the number of scripts which were loaded with lazy compilation (see #setLazyScriptCompilation)
+         * and are not compiled yet.
+         *
+         * @return number of scripts which are not compiled yet
+         */
+        [[nodiscard]] RLOGIC_API size_t getUncompiledScriptCount() const;
+
         /**
         * Copy Constructor of LogicEngine is deleted because logic engines hold named resources and are not supposed to be copied
         *
@@ -379,5 +979,17 @@ namespace rlogic
         * Implementation detail of LogicEngine
         */
         std::unique_ptr<internal::LogicEngineImpl> m_impl;
+
+    private:
+        /**
+         * Internal implementation of #enqueueInputValue
+         */
+        template <typename T> RLOGIC_API bool enqueueInputValueInternal(const Property& input, T value);
     };
+
+    template <typename T> bool LogicEngine::enqueueInputValue(const Property& input, T value)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call enqueueInputValue<T> only with types which have a value! Read the docs of the method!");
+        return enqueueInputValueInternal<T>(input, std::move(value));
+    }
 }
@@ -10,6 +10,7 @@
 
 #include "ramses-logic/APIExport.h"
 
+#include <chrono>
 #include <vector>
 #include <string>
 #include <functional>
@@ -75,6 +76,45 @@ namespace rlogic
         */
         RLOGIC_API void setName(std::string_view name);
 
+        /**
+        * Limits how often this #LogicNode is executed by #rlogic::LogicEngine::update. With an interval of N, the node is
+        * executed at most in every N-th update, e.g. 12 for a clock text which is updated at 5 Hz in an application which
+        * renders 60 frames per second. The default is 1 (the node can be executed in every update), 0 is treated as 1.
+        *
+        * The interval doesn't make the node run periodically, it is still only executed if one of its inputs changed.
+        * Links to its inputs are propagated in every update, so when the node is executed it sees the latest values
+        * (values which were overwritten in between are not seen). Until then, its outputs and all nodes linked
+        * to them keep their values. Use #setMinimumTimeBetweenUpdates to limit the rate in time instead of updates,
+        * if both are set the node is executed only when both have passed. The interval is not saved to files.
+        *
+        * @param updateCount number of updates from one execution of the node to the next one
+        */
+        RLOGIC_API void setUpdateInterval(size_t updateCount);
+
+        /**
+        * Returns the interval set with #setUpdateInterval.
+        *
+        * @return the update interval of the node
+        */
+        [[nodiscard]] RLOGIC_API size_t getUpdateInterval() const;
+
+        /**
+        * Same as #setUpdateInterval, but the node is only executed again when at least \p time has passed since
+        * its last execution, e.g. 200ms for 5 Hz. The time is taken once at the beginning of each #rlogic::LogicEngine::update
+        * from the clock of the engine, see #rlogic::LogicEngine::setUpdateClock. The default is 0 (no limit).
+        * The time is not saved to files.
+        *
+        * @param time minimum time from one execution of the node to the next one
+        */
+        RLOGIC_API void setMinimumTimeBetweenUpdates(std::chrono::milliseconds time);
+
+        /**
+        * Returns the time set with #setMinimumTimeBetweenUpdates.
+        *
+        * @return the minimum time between executions of the node
+        */
+        [[nodiscard]] RLOGIC_API std::chrono::milliseconds getMinimumTimeBetweenUpdates() const;
+
         /**
         * Destructor of #LogicNode
         */
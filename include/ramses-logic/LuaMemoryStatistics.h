@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <chrono>
+
+namespace rlogic
+{
+    /**
+     * Holds information about the memory used by the Lua environment of a #rlogic::LogicEngine,
+     * see #rlogic::LogicEngine::getLuaMemoryStatistics
+     */
+    struct LuaMemoryStatistics
+    {
+        /**
+         * Number of bytes currently allocated by Lua (as requested by Lua, without the overhead of the allocator)
+         */
+        size_t currentBytes = 0u;
+
+        /**
+         * Highest value of #currentBytes since the Lua environment was created
+         */
+        size_t peakBytes = 0u;
+
+        /**
+         * Memory limit in bytes as set by #rlogic::LogicEngine::setLuaMemoryLimit, 0 if there is no limit
+         */
+        size_t memoryLimit = 0u;
+
+        /**
+         * Number of memory blocks which are currently allocated by Lua
+         */
+        size_t liveAllocations = 0u;
+
+        /**
+         * Number of memory blocks allocated by Lua since the Lua environment was created
+         */
+        size_t totalAllocations = 0u;
+
+        /**
+         * Number of memory blocks which could not be served by the internal pools and were allocated from the system instead
+         */
+        size_t systemAllocations = 0u;
+
+        /**
+         * Number of allocations which failed because they would have exceeded #memoryLimit
+         */
+        size_t failedAllocations = 0u;
+
+        /**
+         * Number of bytes reserved by the internal pools for small objects. This memory is kept until the Lua environment is destroyed
+         */
+        size_t reservedPoolBytes = 0u;
+
+        /**
+         * Number of garbage collection cycles which were completed by #rlogic::LogicEngine::update or #rlogic::LogicEngine::collectGarbage
+         */
+        size_t completedCollectionCycles = 0u;
+
+        /**
+         * Duration of the last garbage collection step
+         */
+        std::chrono::microseconds lastCollectionStepDuration {0};
+
+        /**
+         * Accumulated duration of all garbage collection steps since the Lua environment was created
+         */
+        std::chrono::microseconds totalCollectionDuration {0};
+    };
+}
@@ -0,0 +1,147 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class NativeLogicNodeImpl;
+}
+
+namespace rlogic
+{
+    class Property;
+
+    /**
+     * Declares one property of the interface of a #rlogic::NativeLogicNodeType. Supported are all primitive
+     * types and structs (#rlogic::EPropertyType::Struct) whose fields are declared in #children.
+     * Arrays are not supported.
+     */
+    struct NativePropertyDeclaration
+    {
+        /**
+         * Name of the property, must be unique among its siblings
+         */
+        std::string name;
+
+        /**
+         * Type of the property
+         */
+        EPropertyType type = EPropertyType::Float;
+
+        /**
+         * Fields of a struct property, must be empty for other types
+         */
+        std::vector<NativePropertyDeclaration> children;
+    };
+
+    /**
+     * Update function of a #rlogic::NativeLogicNodeType. It is called by #rlogic::LogicEngine::update with
+     * the inputs and outputs of the node which is being updated, following the same rules as the run()
+     * function of scripts (i.e. only when an input changed, in the order given by the links).
+     *
+     * Output values can be set with #rlogic::Property::set, but only during this call. The children of
+     * inputs and outputs are in declaration order, accessing them by index is cheaper than by name.
+     *
+     * Returning an error message aborts the update, the error is reported by #rlogic::LogicEngine::getErrors.
+     */
+    using NativeUpdateFunction = std::function<std::optional<std::string>(const Property& inputs, Property& outputs)>;
+
+    /**
+     * Describes a type of logic node implemented in C++, see #rlogic::LogicEngine::registerNativeLogicNodeType.
+     */
+    struct NativeLogicNodeType
+    {
+        /**
+         * Properties of the root input struct
+         */
+        std::vector<NativePropertyDeclaration> inputs;
+
+        /**
+         * Properties of the root output struct
+         */
+        std::vector<NativePropertyDeclaration> outputs;
+
+        /**
+         * Computes the outputs from the inputs
+         */
+        NativeUpdateFunction update;
+    };
+
+    /**
+     * A logic node whose logic is implemented in C++ instead of Lua. Native logic nodes take part in linking,
+     * dirty tracking, ordering and serialization like #rlogic::LuaScript, but don't pay the cost of calling into Lua.
+     * They are created by #rlogic::LogicEngine::createNativeLogicNode from a type registered with
+     * #rlogic::LogicEngine::registerNativeLogicNodeType.
+     */
+    class NativeLogicNode : public LogicNode
+    {
+    public:
+        /**
+         * Returns the name of the type which this node was created from
+         *
+         * @return the type name of the node
+         */
+        [[nodiscard]] RLOGIC_API std::string_view getTypeName() const;
+
+        /**
+         * Constructor of NativeLogicNode. User is not supposed to call this - native nodes are created by the #rlogic::LogicEngine
+         *
+         * @param impl implementation details of the node
+         */
+        explicit NativeLogicNode(std::unique_ptr<internal::NativeLogicNodeImpl> impl) noexcept;
+
+        /**
+         * Destructor of NativeLogicNode
+         */
+        ~NativeLogicNode() noexcept override;
+
+        /**
+         * Copy Constructor of NativeLogicNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to copy from
+         */
+        NativeLogicNode(const NativeLogicNode& other) = delete;
+
+        /**
+         * Move Constructor of NativeLogicNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        NativeLogicNode(NativeLogicNode&& other) = delete;
+
+        /**
+         * Assignment operator of NativeLogicNode is deleted because nodes are not supposed to be copied
+         *
+         * @param other node to assign from
+         */
+        NativeLogicNode& operator=(const NativeLogicNode& other) = delete;
+
+        /**
+         * Move assignment operator of NativeLogicNode is deleted because nodes are not supposed to be moved
+         *
+         * @param other node to move from
+         */
+        NativeLogicNode& operator=(NativeLogicNode&& other) = delete;
+
+        /**
+         * Implementation detail of NativeLogicNode
+         */
+        std::unique_ptr<internal::NativeLogicNodeImpl> m_nativeNode;
+    };
+}
@@ -0,0 +1,104 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/APIExport.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace rlogic::internal
+{
+    class OutputSnapshotImpl;
+}
+
+namespace rlogic
+{
+    class Property;
+
+    /**
+    * Holds copies of output values as they were at the end of one #rlogic::LogicEngine::update call. Snapshots are filled
+    * by #rlogic::LogicEngine::readOutputSnapshot, which can be called from any thread. Each thread should use its own
+    * OutputSnapshot instance and reuse it, so that its memory is reused.
+    */
+    class OutputSnapshot
+    {
+    public:
+        /**
+        * Creates an empty snapshot, see #rlogic::LogicEngine::readOutputSnapshot
+        */
+        RLOGIC_API OutputSnapshot() noexcept;
+
+        /**
+        * Destructor of OutputSnapshot
+        */
+        RLOGIC_API ~OutputSnapshot() noexcept;
+
+        /**
+        * Returns the number of the #rlogic::LogicEngine::update call which produced the values of this snapshot
+        * (see #rlogic::LogicEngine::getUpdateCounter). Returns 0 if the snapshot was not filled yet.
+        *
+        * @return the update counter of the values in this snapshot
+        */
+        [[nodiscard]] RLOGIC_API uint64_t getUpdateCounter() const;
+
+        /**
+        * Returns the value which the \p output had at the end of the update of this snapshot. The \p output is only used
+        * for lookup, its current value is not accessed. The same rules apply to template parameter T as in #rlogic::Property::get.
+        *
+        * @param output an output which was added with #rlogic::LogicEngine::addOutputToSnapshot
+        * @return the value of \p output, or std::nullopt if \p output is not contained in the snapshot, T does not match or a
+        *         logic node was destroyed or content was loaded since the snapshot was published
+        */
+        template <typename T> [[nodiscard]] std::optional<T> get(const Property& output) const;
+
+        /**
+        * Copy Constructor of OutputSnapshot is deleted, snapshots are supposed to be reused
+        * @param other snapshot to copy from
+        */
+        OutputSnapshot(const OutputSnapshot& other) = delete;
+
+        /**
+        * Move Constructor of OutputSnapshot is deleted, snapshots are supposed to be reused
+        * @param other snapshot to move from
+        */
+        OutputSnapshot(OutputSnapshot&& other) = delete;
+
+        /**
+        * Assignment operator of OutputSnapshot is deleted, snapshots are supposed to be reused
+        * @param other snapshot to assign from
+        */
+        OutputSnapshot& operator=(const OutputSnapshot& other) = delete;
+
+        /**
+        * Move assignment operator of OutputSnapshot is deleted, snapshots are supposed to be reused
+        * @param other snapshot to move from
+        */
+        OutputSnapshot& operator=(OutputSnapshot&& other) = delete;
+
+        /**
+        * Implementation details of the OutputSnapshot class
+        */
+        std::unique_ptr<internal::OutputSnapshotImpl> m_impl;
+
+    private:
+        /**
+         * Internal implementation of #get
+         */
+        template <typename T> [[nodiscard]] RLOGIC_API std::optional<T> getInternal(const Property& output) const;
+    };
+
+    template <typename T> std::optional<T> OutputSnapshot::get(const Property& output) const
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call get<T> only with types which have a value! Read the docs of the method!");
+        return getInternal<T>(output);
+    }
+}
@@ -0,0 +1,294 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ANIMATIONNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_ANIMATIONNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct AnimationChannel;
+struct AnimationChannelBuilder;
+
+struct AnimationNode;
+struct AnimationNodeBuilder;
+
+enum class EInterpolationType : uint8_t {
+  Step = 0,
+  Linear = 1,
+  Cubic = 2,
+  Slerp = 3,
+  MIN = Step,
+  MAX = Slerp
+};
+
+inline const EInterpolationType (&EnumValuesEInterpolationType())[4] {
+  static const EInterpolationType values[] = {
+    EInterpolationType::Step,
+    EInterpolationType::Linear,
+    EInterpolationType::Cubic,
+    EInterpolationType::Slerp
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesEInterpolationType() {
+  static const char * const names[5] = {
+    "Step",
+    "Linear",
+    "Cubic",
+    "Slerp",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameEInterpolationType(EInterpolationType e) {
+  if (flatbuffers::IsOutRange(e, EInterpolationType::Step, EInterpolationType::Slerp)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesEInterpolationType()[index];
+}
+
+struct AnimationChannel FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AnimationChannelBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_TYPE = 6,
+    VT_INTERPOLATION = 8,
+    VT_TIMESTAMPS = 10,
+    VT_KEYFRAMES = 12,
+    VT_TANGENTSIN = 14,
+    VT_TANGENTSOUT = 16
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  rlogic_serialization::EPropertyType type() const {
+    return static_cast<rlogic_serialization::EPropertyType>(GetField<uint8_t>(VT_TYPE, 0));
+  }
+  rlogic_serialization::EInterpolationType interpolation() const {
+    return static_cast<rlogic_serialization::EInterpolationType>(GetField<uint8_t>(VT_INTERPOLATION, 0));
+  }
+  const flatbuffers::Vector<float> *timeStamps() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_TIMESTAMPS);
+  }
+  const flatbuffers::Vector<float> *keyframes() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_KEYFRAMES);
+  }
+  const flatbuffers::Vector<float> *tangentsIn() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_TANGENTSIN);
+  }
+  const flatbuffers::Vector<float> *tangentsOut() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_TANGENTSOUT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint8_t>(verifier, VT_TYPE) &&
+           VerifyField<uint8_t>(verifier, VT_INTERPOLATION) &&
+           VerifyOffset(verifier, VT_TIMESTAMPS) &&
+           verifier.VerifyVector(timeStamps()) &&
+           VerifyOffset(verifier, VT_KEYFRAMES) &&
+           verifier.VerifyVector(keyframes()) &&
+           VerifyOffset(verifier, VT_TANGENTSIN) &&
+           verifier.VerifyVector(tangentsIn()) &&
+           VerifyOffset(verifier, VT_TANGENTSOUT) &&
+           verifier.VerifyVector(tangentsOut()) &&
+           verifier.EndTable();
+  }
+};
+
+struct AnimationChannelBuilder {
+  typedef AnimationChannel Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(AnimationChannel::VT_NAME, name);
+  }
+  void add_type(rlogic_serialization::EPropertyType type) {
+    fbb_.AddElement<uint8_t>(AnimationChannel::VT_TYPE, static_cast<uint8_t>(type), 0);
+  }
+  void add_interpolation(rlogic_serialization::EInterpolationType interpolation) {
+    fbb_.AddElement<uint8_t>(AnimationChannel::VT_INTERPOLATION, static_cast<uint8_t>(interpolation), 0);
+  }
+  void add_timeStamps(flatbuffers::Offset<flatbuffers::Vector<float>> timeStamps) {
+    fbb_.AddOffset(AnimationChannel::VT_TIMESTAMPS, timeStamps);
+  }
+  void add_keyframes(flatbuffers::Offset<flatbuffers::Vector<float>> keyframes) {
+    fbb_.AddOffset(AnimationChannel::VT_KEYFRAMES, keyframes);
+  }
+  void add_tangentsIn(flatbuffers::Offset<flatbuffers::Vector<float>> tangentsIn) {
+    fbb_.AddOffset(AnimationChannel::VT_TANGENTSIN, tangentsIn);
+  }
+  void add_tangentsOut(flatbuffers::Offset<flatbuffers::Vector<float>> tangentsOut) {
+    fbb_.AddOffset(AnimationChannel::VT_TANGENTSOUT, tangentsOut);
+  }
+  explicit AnimationChannelBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AnimationChannelBuilder &operator=(const AnimationChannelBuilder &);
+  flatbuffers::Offset<AnimationChannel> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<AnimationChannel>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<AnimationChannel> CreateAnimationChannel(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    rlogic_serialization::EPropertyType type = rlogic_serialization::EPropertyType::Float,
+    rlogic_serialization::EInterpolationType interpolation = rlogic_serialization::EInterpolationType::Step,
+    flatbuffers::Offset<flatbuffers::Vector<float>> timeStamps = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> keyframes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> tangentsIn = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> tangentsOut = 0) {
+  AnimationChannelBuilder builder_(_fbb);
+  builder_.add_tangentsOut(tangentsOut);
+  builder_.add_tangentsIn(tangentsIn);
+  builder_.add_keyframes(keyframes);
+  builder_.add_timeStamps(timeStamps);
+  builder_.add_name(name);
+  builder_.add_interpolation(interpolation);
+  builder_.add_type(type);
+  return builder_.Finish();
+}
+
+struct AnimationChannel::Traits {
+  using type = AnimationChannel;
+  static auto constexpr Create = CreateAnimationChannel;
+};
+
+inline flatbuffers::Offset<AnimationChannel> CreateAnimationChannelDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    rlogic_serialization::EPropertyType type = rlogic_serialization::EPropertyType::Float,
+    rlogic_serialization::EInterpolationType interpolation = rlogic_serialization::EInterpolationType::Step,
+    const std::vector<float> *timeStamps = nullptr,
+    const std::vector<float> *keyframes = nullptr,
+    const std::vector<float> *tangentsIn = nullptr,
+    const std::vector<float> *tangentsOut = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto timeStamps__ = timeStamps ? _fbb.CreateVector<float>(*timeStamps) : 0;
+  auto keyframes__ = keyframes ? _fbb.CreateVector<float>(*keyframes) : 0;
+  auto tangentsIn__ = tangentsIn ? _fbb.CreateVector<float>(*tangentsIn) : 0;
+  auto tangentsOut__ = tangentsOut ? _fbb.CreateVector<float>(*tangentsOut) : 0;
+  return rlogic_serialization::CreateAnimationChannel(
+      _fbb,
+      name__,
+      type,
+      interpolation,
+      timeStamps__,
+      keyframes__,
+      tangentsIn__,
+      tangentsOut__);
+}
+
+struct AnimationNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AnimationNodeBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_CHANNELS = 6,
+    VT_ROOTINPUT = 8,
+    VT_ROOTOUTPUT = 10
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>> *channels() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>> *>(VT_CHANNELS);
+  }
+  const rlogic_serialization::PropertyTree *rootInput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::PropertyTree *rootOutput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTOUTPUT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_CHANNELS) &&
+           verifier.VerifyVector(channels()) &&
+           verifier.VerifyVectorOfTables(channels()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           verifier.EndTable();
+  }
+};
+
+struct AnimationNodeBuilder {
+  typedef AnimationNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(AnimationNode::VT_NAME, name);
+  }
+  void add_channels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>>> channels) {
+    fbb_.AddOffset(AnimationNode::VT_CHANNELS, channels);
+  }
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput) {
+    fbb_.AddOffset(AnimationNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput) {
+    fbb_.AddOffset(AnimationNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  explicit AnimationNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AnimationNodeBuilder &operator=(const AnimationNodeBuilder &);
+  flatbuffers::Offset<AnimationNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<AnimationNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<AnimationNode> CreateAnimationNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>>> channels = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  AnimationNodeBuilder builder_(_fbb);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_channels(channels);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct AnimationNode::Traits {
+  using type = AnimationNode;
+  static auto constexpr Create = CreateAnimationNode;
+};
+
+inline flatbuffers::Offset<AnimationNode> CreateAnimationNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>> *channels = nullptr,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto channels__ = channels ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>>(*channels) : 0;
+  return rlogic_serialization::CreateAnimationNode(
+      _fbb,
+      name__,
+      channels__,
+      rootInput,
+      rootOutput);
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_ANIMATIONNODE_RLOGIC_SERIALIZATION_H_
@@ -6,8 +6,11 @@
 
 #include "flatbuffers/flatbuffers.h"
 
+#include "AnimationNodeGen.h"
+#include "ExpressionNodeGen.h"
 #include "LinkGen.h"
 #include "LuaScriptGen.h"
+#include "NativeLogicNodeGen.h"
 #include "PropertyGen.h"
 #include "RamsesAppearanceBindingGen.h"
 #include "RamsesBindingGen.h"
@@ -28,7 +31,11 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_NODEBINDINGS = 6,
     VT_APPEARANCEBINDINGS = 8,
     VT_CAMERABINDINGS = 10,
-    VT_LINKS = 12
+    VT_LINKS = 12,
+    VT_STRINGS = 14,
+    VT_NATIVENODES = 16,
+    VT_ANIMATIONNODES = 18,
+    VT_EXPRESSIONNODES = 20
   };
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaScript>> *luaScripts() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaScript>> *>(VT_LUASCRIPTS);
@@ -45,6 +52,18 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>> *links() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>> *>(VT_LINKS);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *strings() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_STRINGS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>> *nativeNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>> *>(VT_NATIVENODES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> *animationNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> *>(VT_ANIMATIONNODES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *expressionNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *>(VT_EXPRESSIONNODES);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_LUASCRIPTS) &&
@@ -62,6 +81,18 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_LINKS) &&
            verifier.VerifyVector(links()) &&
            verifier.VerifyVectorOfTables(links()) &&
+           VerifyOffset(verifier, VT_STRINGS) &&
+           verifier.VerifyVector(strings()) &&
+           verifier.VerifyVectorOfStrings(strings()) &&
+           VerifyOffset(verifier, VT_NATIVENODES) &&
+           verifier.VerifyVector(nativeNodes()) &&
+           verifier.VerifyVectorOfTables(nativeNodes()) &&
+           VerifyOffset(verifier, VT_ANIMATIONNODES) &&
+           verifier.VerifyVector(animationNodes()) &&
+           verifier.VerifyVectorOfTables(animationNodes()) &&
+           VerifyOffset(verifier, VT_EXPRESSIONNODES) &&
+           verifier.VerifyVector(expressionNodes()) &&
+           verifier.VerifyVectorOfTables(expressionNodes()) &&
            verifier.EndTable();
   }
 };
@@ -85,6 +116,18 @@ struct ApiObjectsBuilder {
   void add_links(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links) {
     fbb_.AddOffset(ApiObjects::VT_LINKS, links);
   }
+  void add_strings(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> strings) {
+    fbb_.AddOffset(ApiObjects::VT_STRINGS, strings);
+  }
+  void add_nativeNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>>> nativeNodes) {
+    fbb_.AddOffset(ApiObjects::VT_NATIVENODES, nativeNodes);
+  }
+  void add_animationNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>>> animationNodes) {
+    fbb_.AddOffset(ApiObjects::VT_ANIMATIONNODES, animationNodes);
+  }
+  void add_expressionNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>> expressionNodes) {
+    fbb_.AddOffset(ApiObjects::VT_EXPRESSIONNODES, expressionNodes);
+  }
   explicit ApiObjectsBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -103,8 +146,16 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjects(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>>> nodeBindings = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesAppearanceBinding>>> appearanceBindings = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesCameraBinding>>> cameraBindings = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> strings = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>>> nativeNodes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>>> animationNodes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>> expressionNodes = 0) {
   ApiObjectsBuilder builder_(_fbb);
+  builder_.add_expressionNodes(expressionNodes);
+  builder_.add_animationNodes(animationNodes);
+  builder_.add_nativeNodes(nativeNodes);
+  builder_.add_strings(strings);
   builder_.add_links(links);
   builder_.add_cameraBindings(cameraBindings);
   builder_.add_appearanceBindings(appearanceBindings);
@@ -124,19 +175,31 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
     const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>> *nodeBindings = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesAppearanceBinding>> *appearanceBindings = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesCameraBinding>> *cameraBindings = nullptr,
-    const std::vector<flatbuffers::Offset<rlogic_serialization::Link>> *links = nullptr) {
+    const std::vector<flatbuffers::Offset<rlogic_serialization::Link>> *links = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *strings = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>> *nativeNodes = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> *animationNodes = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *expressionNodes = nullptr) {
   auto luaScripts__ = luaScripts ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaScript>>(*luaScripts) : 0;
   auto nodeBindings__ = nodeBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>>(*nodeBindings) : 0;
   auto appearanceBindings__ = appearanceBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesAppearanceBinding>>(*appearanceBindings) : 0;
   auto cameraBindings__ = cameraBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesCameraBinding>>(*cameraBindings) : 0;
   auto links__ = links ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::Link>>(*links) : 0;
+  auto strings__ = strings ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*strings) : 0;
+  auto nativeNodes__ = nativeNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>>(*nativeNodes) : 0;
+  auto animationNodes__ = animationNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::AnimationNode>>(*animationNodes) : 0;
+  auto expressionNodes__ = expressionNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>(*expressionNodes) : 0;
   return rlogic_serialization::CreateApiObjects(
       _fbb,
       luaScripts__,
       nodeBindings__,
       appearanceBindings__,
       cameraBindings__,
-      links__);
+      links__,
+      strings__,
+      nativeNodes__,
+      animationNodes__,
+      expressionNodes__);
 }
 
 }  // namespace rlogic_serialization
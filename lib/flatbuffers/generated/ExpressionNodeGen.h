@@ -0,0 +1,116 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct ExpressionNode;
+struct ExpressionNodeBuilder;
+
+struct ExpressionNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ExpressionNodeBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_SOURCE = 6,
+    VT_ROOTINPUT = 8,
+    VT_ROOTOUTPUT = 10
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::String *source() const {
+    return GetPointer<const flatbuffers::String *>(VT_SOURCE);
+  }
+  const rlogic_serialization::PropertyTree *rootInput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::PropertyTree *rootOutput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTOUTPUT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_SOURCE) &&
+           verifier.VerifyString(source()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ExpressionNodeBuilder {
+  typedef ExpressionNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(ExpressionNode::VT_NAME, name);
+  }
+  void add_source(flatbuffers::Offset<flatbuffers::String> source) {
+    fbb_.AddOffset(ExpressionNode::VT_SOURCE, source);
+  }
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput) {
+    fbb_.AddOffset(ExpressionNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput) {
+    fbb_.AddOffset(ExpressionNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  explicit ExpressionNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ExpressionNodeBuilder &operator=(const ExpressionNodeBuilder &);
+  flatbuffers::Offset<ExpressionNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ExpressionNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ExpressionNode> CreateExpressionNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::String> source = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  ExpressionNodeBuilder builder_(_fbb);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_source(source);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct ExpressionNode::Traits {
+  using type = ExpressionNode;
+  static auto constexpr Create = CreateExpressionNode;
+};
+
+inline flatbuffers::Offset<ExpressionNode> CreateExpressionNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const char *source = nullptr,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto source__ = source ? _fbb.CreateString(source) : 0;
+  return rlogic_serialization::CreateExpressionNode(
+      _fbb,
+      name__,
+      source__,
+      rootInput,
+      rootOutput);
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
@@ -13,25 +13,83 @@ namespace rlogic_serialization {
 struct Link;
 struct LinkBuilder;
 
+enum class ELinkKind : uint8_t {
+  Direct = 0,
+  Conversion = 1,
+  Component = 2,
+  MIN = Direct,
+  MAX = Component
+};
+
+inline const ELinkKind (&EnumValuesELinkKind())[3] {
+  static const ELinkKind values[] = {
+    ELinkKind::Direct,
+    ELinkKind::Conversion,
+    ELinkKind::Component
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesELinkKind() {
+  static const char * const names[4] = {
+    "Direct",
+    "Conversion",
+    "Component",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameELinkKind(ELinkKind e) {
+  if (flatbuffers::IsOutRange(e, ELinkKind::Direct, ELinkKind::Component)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesELinkKind()[index];
+}
+
 struct Link FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef LinkBuilder Builder;
   struct Traits;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SOURCEPROPERTY = 4,
-    VT_TARGETPROPERTY = 6
+    VT_SOURCETREE = 4,
+    VT_SOURCEINDEX = 6,
+    VT_TARGETTREE = 8,
+    VT_TARGETINDEX = 10,
+    VT_KIND = 12,
+    VT_SOURCECOMPONENT = 14,
+    VT_TARGETCOMPONENT = 16
   };
-  const rlogic_serialization::Property *sourceProperty() const {
-    return GetPointer<const rlogic_serialization::Property *>(VT_SOURCEPROPERTY);
+  const rlogic_serialization::PropertyTree *sourceTree() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_SOURCETREE);
   }
-  const rlogic_serialization::Property *targetProperty() const {
-    return GetPointer<const rlogic_serialization::Property *>(VT_TARGETPROPERTY);
+  uint32_t sourceIndex() const {
+    return GetField<uint32_t>(VT_SOURCEINDEX, 0);
+  }
+  const rlogic_serialization::PropertyTree *targetTree() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_TARGETTREE);
+  }
+  uint32_t targetIndex() const {
+    return GetField<uint32_t>(VT_TARGETINDEX, 0);
+  }
+  rlogic_serialization::ELinkKind kind() const {
+    return static_cast<rlogic_serialization::ELinkKind>(GetField<uint8_t>(VT_KIND, 0));
+  }
+  uint8_t sourceComponent() const {
+    return GetField<uint8_t>(VT_SOURCECOMPONENT, 0);
+  }
+  uint8_t targetComponent() const {
+    return GetField<uint8_t>(VT_TARGETCOMPONENT, 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffset(verifier, VT_SOURCEPROPERTY) &&
-           verifier.VerifyTable(sourceProperty()) &&
-           VerifyOffset(verifier, VT_TARGETPROPERTY) &&
-           verifier.VerifyTable(targetProperty()) &&
+           VerifyOffset(verifier, VT_SOURCETREE) &&
+           verifier.VerifyTable(sourceTree()) &&
+           VerifyField<uint32_t>(verifier, VT_SOURCEINDEX) &&
+           VerifyOffset(verifier, VT_TARGETTREE) &&
+           verifier.VerifyTable(targetTree()) &&
+           VerifyField<uint32_t>(verifier, VT_TARGETINDEX) &&
+           VerifyField<uint8_t>(verifier, VT_KIND) &&
+           VerifyField<uint8_t>(verifier, VT_SOURCECOMPONENT) &&
+           VerifyField<uint8_t>(verifier, VT_TARGETCOMPONENT) &&
            verifier.EndTable();
   }
 };
@@ -40,11 +98,26 @@ struct LinkBuilder {
   typedef Link Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_sourceProperty(flatbuffers::Offset<rlogic_serialization::Property> sourceProperty) {
-    fbb_.AddOffset(Link::VT_SOURCEPROPERTY, sourceProperty);
+  void add_sourceTree(flatbuffers::Offset<rlogic_serialization::PropertyTree> sourceTree) {
+    fbb_.AddOffset(Link::VT_SOURCETREE, sourceTree);
+  }
+  void add_sourceIndex(uint32_t sourceIndex) {
+    fbb_.AddElement<uint32_t>(Link::VT_SOURCEINDEX, sourceIndex, 0);
+  }
+  void add_targetTree(flatbuffers::Offset<rlogic_serialization::PropertyTree> targetTree) {
+    fbb_.AddOffset(Link::VT_TARGETTREE, targetTree);
+  }
+  void add_targetIndex(uint32_t targetIndex) {
+    fbb_.AddElement<uint32_t>(Link::VT_TARGETINDEX, targetIndex, 0);
+  }
+  void add_kind(rlogic_serialization::ELinkKind kind) {
+    fbb_.AddElement<uint8_t>(Link::VT_KIND, static_cast<uint8_t>(kind), 0);
+  }
+  void add_sourceComponent(uint8_t sourceComponent) {
+    fbb_.AddElement<uint8_t>(Link::VT_SOURCECOMPONENT, sourceComponent, 0);
   }
-  void add_targetProperty(flatbuffers::Offset<rlogic_serialization::Property> targetProperty) {
-    fbb_.AddOffset(Link::VT_TARGETPROPERTY, targetProperty);
+  void add_targetComponent(uint8_t targetComponent) {
+    fbb_.AddElement<uint8_t>(Link::VT_TARGETCOMPONENT, targetComponent, 0);
   }
   explicit LinkBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
@@ -60,11 +133,21 @@ struct LinkBuilder {
 
 inline flatbuffers::Offset<Link> CreateLink(
     flatbuffers::FlatBufferBuilder &_fbb,
-    flatbuffers::Offset<rlogic_serialization::Property> sourceProperty = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> targetProperty = 0) {
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> sourceTree = 0,
+    uint32_t sourceIndex = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> targetTree = 0,
+    uint32_t targetIndex = 0,
+    rlogic_serialization::ELinkKind kind = rlogic_serialization::ELinkKind::Direct,
+    uint8_t sourceComponent = 0,
+    uint8_t targetComponent = 0) {
   LinkBuilder builder_(_fbb);
-  builder_.add_targetProperty(targetProperty);
-  builder_.add_sourceProperty(sourceProperty);
+  builder_.add_targetIndex(targetIndex);
+  builder_.add_targetTree(targetTree);
+  builder_.add_sourceIndex(sourceIndex);
+  builder_.add_sourceTree(sourceTree);
+  builder_.add_targetComponent(targetComponent);
+  builder_.add_sourceComponent(sourceComponent);
+  builder_.add_kind(kind);
   return builder_.Finish();
 }
 
@@ -32,11 +32,11 @@ struct LuaScript FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *luaSourceCode() const {
     return GetPointer<const flatbuffers::String *>(VT_LUASOURCECODE);
   }
-  const rlogic_serialization::Property *rootInput() const {
-    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTINPUT);
+  const rlogic_serialization::PropertyTree *rootInput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTINPUT);
   }
-  const rlogic_serialization::Property *rootOutput() const {
-    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
+  const rlogic_serialization::PropertyTree *rootOutput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTOUTPUT);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -67,10 +67,10 @@ struct LuaScriptBuilder {
   void add_luaSourceCode(flatbuffers::Offset<flatbuffers::String> luaSourceCode) {
     fbb_.AddOffset(LuaScript::VT_LUASOURCECODE, luaSourceCode);
   }
-  void add_rootInput(flatbuffers::Offset<rlogic_serialization::Property> rootInput) {
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput) {
     fbb_.AddOffset(LuaScript::VT_ROOTINPUT, rootInput);
   }
-  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput) {
     fbb_.AddOffset(LuaScript::VT_ROOTOUTPUT, rootOutput);
   }
   explicit LuaScriptBuilder(flatbuffers::FlatBufferBuilder &_fbb)
@@ -90,8 +90,8 @@ inline flatbuffers::Offset<LuaScript> CreateLuaScript(
     flatbuffers::Offset<flatbuffers::String> name = 0,
     flatbuffers::Offset<flatbuffers::String> filename = 0,
     flatbuffers::Offset<flatbuffers::String> luaSourceCode = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
   LuaScriptBuilder builder_(_fbb);
   builder_.add_rootOutput(rootOutput);
   builder_.add_rootInput(rootInput);
@@ -111,8 +111,8 @@ inline flatbuffers::Offset<LuaScript> CreateLuaScriptDirect(
     const char *name = nullptr,
     const char *filename = nullptr,
     const char *luaSourceCode = nullptr,
-    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto filename__ = filename ? _fbb.CreateString(filename) : 0;
   auto luaSourceCode__ = luaSourceCode ? _fbb.CreateString(luaSourceCode) : 0;
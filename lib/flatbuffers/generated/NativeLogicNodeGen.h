@@ -0,0 +1,116 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_NATIVELOGICNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_NATIVELOGICNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct NativeLogicNode;
+struct NativeLogicNodeBuilder;
+
+struct NativeLogicNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef NativeLogicNodeBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_TYPENAME = 6,
+    VT_ROOTINPUT = 8,
+    VT_ROOTOUTPUT = 10
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::String *typeName() const {
+    return GetPointer<const flatbuffers::String *>(VT_TYPENAME);
+  }
+  const rlogic_serialization::PropertyTree *rootInput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::PropertyTree *rootOutput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTOUTPUT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_TYPENAME) &&
+           verifier.VerifyString(typeName()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           verifier.EndTable();
+  }
+};
+
+struct NativeLogicNodeBuilder {
+  typedef NativeLogicNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(NativeLogicNode::VT_NAME, name);
+  }
+  void add_typeName(flatbuffers::Offset<flatbuffers::String> typeName) {
+    fbb_.AddOffset(NativeLogicNode::VT_TYPENAME, typeName);
+  }
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput) {
+    fbb_.AddOffset(NativeLogicNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput) {
+    fbb_.AddOffset(NativeLogicNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  explicit NativeLogicNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  NativeLogicNodeBuilder &operator=(const NativeLogicNodeBuilder &);
+  flatbuffers::Offset<NativeLogicNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<NativeLogicNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<NativeLogicNode> CreateNativeLogicNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::String> typeName = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  NativeLogicNodeBuilder builder_(_fbb);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_typeName(typeName);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct NativeLogicNode::Traits {
+  using type = NativeLogicNode;
+  static auto constexpr Create = CreateNativeLogicNode;
+};
+
+inline flatbuffers::Offset<NativeLogicNode> CreateNativeLogicNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const char *typeName = nullptr,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootOutput = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto typeName__ = typeName ? _fbb.CreateString(typeName) : 0;
+  return rlogic_serialization::CreateNativeLogicNode(
+      _fbb,
+      name__,
+      typeName__,
+      rootInput,
+      rootOutput);
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_NATIVELOGICNODE_RLOGIC_SERIALIZATION_H_
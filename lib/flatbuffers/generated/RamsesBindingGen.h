@@ -28,8 +28,8 @@ struct RamsesBinding FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const rlogic_serialization::RamsesReference *boundRamsesObject() const {
     return GetPointer<const rlogic_serialization::RamsesReference *>(VT_BOUNDRAMSESOBJECT);
   }
-  const rlogic_serialization::Property *rootInput() const {
-    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTINPUT);
+  const rlogic_serialization::PropertyTree *rootInput() const {
+    return GetPointer<const rlogic_serialization::PropertyTree *>(VT_ROOTINPUT);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -53,7 +53,7 @@ struct RamsesBindingBuilder {
   void add_boundRamsesObject(flatbuffers::Offset<rlogic_serialization::RamsesReference> boundRamsesObject) {
     fbb_.AddOffset(RamsesBinding::VT_BOUNDRAMSESOBJECT, boundRamsesObject);
   }
-  void add_rootInput(flatbuffers::Offset<rlogic_serialization::Property> rootInput) {
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput) {
     fbb_.AddOffset(RamsesBinding::VT_ROOTINPUT, rootInput);
   }
   explicit RamsesBindingBuilder(flatbuffers::FlatBufferBuilder &_fbb)
@@ -72,7 +72,7 @@ inline flatbuffers::Offset<RamsesBinding> CreateRamsesBinding(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<flatbuffers::String> name = 0,
     flatbuffers::Offset<rlogic_serialization::RamsesReference> boundRamsesObject = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0) {
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0) {
   RamsesBindingBuilder builder_(_fbb);
   builder_.add_rootInput(rootInput);
   builder_.add_boundRamsesObject(boundRamsesObject);
@@ -89,7 +89,7 @@ inline flatbuffers::Offset<RamsesBinding> CreateRamsesBindingDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     const char *name = nullptr,
     flatbuffers::Offset<rlogic_serialization::RamsesReference> boundRamsesObject = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0) {
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> rootInput = 0) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   return rlogic_serialization::CreateRamsesBinding(
       _fbb,
@@ -0,0 +1,32 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/AnimationNode.h"
+#include "impl/AnimationNodeImpl.h"
+
+namespace rlogic
+{
+    AnimationNode::AnimationNode(std::unique_ptr<internal::AnimationNodeImpl> impl) noexcept
+        // The impl pointer is owned by this class, but a reference to the data is passed to the base class
+        : LogicNode(std::ref(static_cast<internal::LogicNodeImpl&>(*impl)))
+        , m_animationNode(std::move(impl))
+    {
+    }
+
+    AnimationNode::~AnimationNode() noexcept = default;
+
+    float AnimationNode::getDuration() const
+    {
+        return m_animationNode->getDuration();
+    }
+
+    size_t AnimationNode::getChannelCount() const
+    {
+        return m_animationNode->getChannelCount();
+    }
+}
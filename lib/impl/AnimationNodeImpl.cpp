@@ -0,0 +1,615 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/AnimationNodeImpl.h"
+#include "impl/PropertyImpl.h"
+
+#include "internals/ErrorReporting.h"
+#include "internals/TypeUtils.h"
+#include "internals/SerializationHelper.h"
+
+#include "ramses-logic/Property.h"
+
+#include "generated/AnimationNodeGen.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Indices of the input properties, see CreateRootInput()
+        constexpr size_t TimeInputIndex = 0u;
+        constexpr size_t LoopInputIndex = 1u;
+
+        bool IsAnimatableType(EPropertyType type)
+        {
+            return type == EPropertyType::Float || type == EPropertyType::Vec2f || type == EPropertyType::Vec3f || type == EPropertyType::Vec4f;
+        }
+
+        std::optional<EInterpolationType> ConvertSerializationInterpolation(rlogic_serialization::EInterpolationType interpolation)
+        {
+            switch (interpolation)
+            {
+            case rlogic_serialization::EInterpolationType::Step:
+                return EInterpolationType::Step;
+            case rlogic_serialization::EInterpolationType::Linear:
+                return EInterpolationType::Linear;
+            case rlogic_serialization::EInterpolationType::Cubic:
+                return EInterpolationType::Cubic;
+            case rlogic_serialization::EInterpolationType::Slerp:
+                return EInterpolationType::Slerp;
+            }
+            return std::nullopt;
+        }
+
+        rlogic_serialization::EInterpolationType ConvertInterpolationToSerialization(EInterpolationType interpolation)
+        {
+            switch (interpolation)
+            {
+            case EInterpolationType::Step:
+                return rlogic_serialization::EInterpolationType::Step;
+            case EInterpolationType::Linear:
+                return rlogic_serialization::EInterpolationType::Linear;
+            case EInterpolationType::Cubic:
+                return rlogic_serialization::EInterpolationType::Cubic;
+            case EInterpolationType::Slerp:
+                return rlogic_serialization::EInterpolationType::Slerp;
+            }
+            assert(false && "Should never reach this line");
+            return rlogic_serialization::EInterpolationType::Step;
+        }
+
+        std::vector<float> CopyFloats(const flatbuffers::Vector<float>* values)
+        {
+            if (values == nullptr)
+            {
+                return {};
+            }
+            return std::vector<float>(values->begin(), values->end());
+        }
+
+        // Quaternions are stored as (x, y, z, w)
+        vec4f Slerp(const vec4f& from, const vec4f& to, float alpha)
+        {
+            float dot = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+
+            // Interpolate along the shorter arc
+            float sign = 1.f;
+            if (dot < 0.f)
+            {
+                dot = -dot;
+                sign = -1.f;
+            }
+
+            float weightFrom = 1.f - alpha;
+            float weightTo = alpha;
+            // Close quaternions are interpolated linearly to avoid a division by a sine close to zero
+            if (dot < 0.9995f)
+            {
+                const float theta = std::acos(dot);
+                const float sinTheta = std::sin(theta);
+                weightFrom = std::sin((1.f - alpha) * theta) / sinTheta;
+                weightTo = std::sin(alpha * theta) / sinTheta;
+            }
+            weightTo *= sign;
+
+            vec4f result{};
+            float lengthSquared = 0.f;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                result[i] = weightFrom * from[i] + weightTo * to[i];
+                lengthSquared += result[i] * result[i];
+            }
+
+            const float inverseLength = 1.f / std::sqrt(lengthSquared);
+            for (auto& component : result)
+            {
+                component *= inverseLength;
+            }
+            return result;
+        }
+    }
+
+    AnimationNodeImpl::AnimationNodeImpl(std::string_view name, const AnimationChannels& channels)
+        : AnimationNodeImpl(name, channels, CreateRootInput(), CreateRootOutput(channels))
+    {
+    }
+
+    AnimationNodeImpl::AnimationNodeImpl(std::string_view name, const AnimationChannels& channels, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
+        : LogicNodeImpl(name)
+    {
+        setRootProperties(std::make_unique<Property>(std::move(rootInput)), std::make_unique<Property>(std::move(rootOutput)));
+
+        size_t totalKeyCount = 0u;
+        size_t totalValueCount = 0u;
+        for (const auto& channel : channels)
+        {
+            totalKeyCount += channel.timeStamps.size();
+            totalValueCount += channel.keyframes.size();
+        }
+        m_timeStamps.reserve(totalKeyCount);
+        m_keyframes.reserve(totalValueCount);
+        m_channels.reserve(channels.size());
+
+        size_t componentCount = 0u;
+        for (size_t i = 0; i < channels.size(); ++i)
+        {
+            const AnimationChannel& channel = channels[i];
+
+            Channel data;
+            data.name = channel.name;
+            data.type = channel.type;
+            data.interpolation = channel.interpolation;
+            data.componentCount = TypeUtils::ComponentsSizeForPropertyType(channel.type);
+            data.firstKey = m_timeStamps.size();
+            data.keyCount = channel.timeStamps.size();
+            data.firstValue = m_keyframes.size();
+            data.firstTangent = m_tangentsIn.size();
+            data.firstComponent = componentCount;
+            data.output = getOutputs()->getChild(i)->m_impl.get();
+            m_channels.push_back(std::move(data));
+
+            m_timeStamps.insert(m_timeStamps.end(), channel.timeStamps.cbegin(), channel.timeStamps.cend());
+            m_keyframes.insert(m_keyframes.end(), channel.keyframes.cbegin(), channel.keyframes.cend());
+            if (channel.interpolation == EInterpolationType::Cubic)
+            {
+                m_tangentsIn.insert(m_tangentsIn.end(), channel.tangentsIn.cbegin(), channel.tangentsIn.cend());
+                m_tangentsOut.insert(m_tangentsOut.end(), channel.tangentsOut.cbegin(), channel.tangentsOut.cend());
+            }
+
+            componentCount += m_channels.back().componentCount;
+            m_duration = std::max(m_duration, channel.timeStamps.back());
+        }
+
+        m_batch.value0.resize(componentCount);
+        m_batch.value1.resize(componentCount);
+        m_batch.tangent0.resize(componentCount);
+        m_batch.tangent1.resize(componentCount);
+        m_batch.weight0.resize(componentCount);
+        m_batch.weight1.resize(componentCount);
+        m_batch.tangentWeight0.resize(componentCount);
+        m_batch.tangentWeight1.resize(componentCount);
+        m_batch.result.resize(componentCount);
+    }
+
+    std::optional<std::string> AnimationNodeImpl::ValidateChannels(const AnimationChannels& channels)
+    {
+        if (channels.empty())
+        {
+            return "animation needs at least one channel";
+        }
+
+        std::unordered_set<std::string_view> names;
+        for (const auto& channel : channels)
+        {
+            if (channel.name.empty())
+            {
+                return "channels must have a name";
+            }
+
+            if (!names.insert(channel.name).second)
+            {
+                return fmt::format("channel '{}' is declared more than once", channel.name);
+            }
+
+            if (!IsAnimatableType(channel.type))
+            {
+                return fmt::format("channel '{}' has an unsupported type (only Float, Vec2f, Vec3f and Vec4f are supported)", channel.name);
+            }
+
+            const bool isCubic = (channel.interpolation == EInterpolationType::Cubic);
+            switch (channel.interpolation)
+            {
+            case EInterpolationType::Step:
+            case EInterpolationType::Linear:
+            case EInterpolationType::Cubic:
+                break;
+            case EInterpolationType::Slerp:
+                if (channel.type != EPropertyType::Vec4f)
+                {
+                    return fmt::format("channel '{}' uses slerp interpolation which requires type Vec4f", channel.name);
+                }
+                break;
+            default:
+                return fmt::format("channel '{}' has an unsupported interpolation type", channel.name);
+            }
+
+            if (channel.timeStamps.empty())
+            {
+                return fmt::format("channel '{}' has no keyframes", channel.name);
+            }
+
+            for (size_t i = 0; i < channel.timeStamps.size(); ++i)
+            {
+                if (!std::isfinite(channel.timeStamps[i]) || (i > 0 && channel.timeStamps[i] <= channel.timeStamps[i - 1]))
+                {
+                    return fmt::format("channel '{}' has time stamps which are not strictly increasing", channel.name);
+                }
+            }
+
+            const size_t expectedValueCount = channel.timeStamps.size() * TypeUtils::ComponentsSizeForPropertyType(channel.type);
+            if (channel.keyframes.size() != expectedValueCount)
+            {
+                return fmt::format("channel '{}' has {} keyframe values but expected {} (one per component and time stamp)", channel.name, channel.keyframes.size(), expectedValueCount);
+            }
+
+            if (isCubic && (channel.tangentsIn.size() != expectedValueCount || channel.tangentsOut.size() != expectedValueCount))
+            {
+                return fmt::format("channel '{}' uses cubic interpolation and needs {} values for both in and out tangents", channel.name, expectedValueCount);
+            }
+
+            if (!isCubic && (!channel.tangentsIn.empty() || !channel.tangentsOut.empty()))
+            {
+                return fmt::format("channel '{}' has tangents but doesn't use cubic interpolation", channel.name);
+            }
+
+            if (channel.interpolation == EInterpolationType::Slerp)
+            {
+                // Slerp() normalizes its result, which fails for zero length (or NaN) quaternions
+                for (size_t i = 0; i < channel.keyframes.size(); i += 4)
+                {
+                    const float lengthSquared = channel.keyframes[i] * channel.keyframes[i] + channel.keyframes[i + 1] * channel.keyframes[i + 1]
+                        + channel.keyframes[i + 2] * channel.keyframes[i + 2] + channel.keyframes[i + 3] * channel.keyframes[i + 3];
+                    if (!(lengthSquared > 0.f))
+                    {
+                        return fmt::format("channel '{}' uses slerp interpolation and has a keyframe which is not a valid quaternion (keyframe {})", channel.name, i / 4);
+                    }
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::unique_ptr<PropertyImpl> AnimationNodeImpl::CreateRootInput()
+    {
+        auto rootInput = std::make_unique<PropertyImpl>("IN", EPropertyType::Struct, EPropertySemantics::ScriptInput);
+        rootInput->addChild(std::make_unique<PropertyImpl>("time", EPropertyType::Float, EPropertySemantics::ScriptInput));
+        rootInput->addChild(std::make_unique<PropertyImpl>("loop", EPropertyType::Bool, EPropertySemantics::ScriptInput));
+        return rootInput;
+    }
+
+    std::unique_ptr<PropertyImpl> AnimationNodeImpl::CreateRootOutput(const AnimationChannels& channels)
+    {
+        auto rootOutput = std::make_unique<PropertyImpl>("OUT", EPropertyType::Struct, EPropertySemantics::ScriptOutput);
+        for (const auto& channel : channels)
+        {
+            rootOutput->addChild(std::make_unique<PropertyImpl>(channel.name, channel.type, EPropertySemantics::ScriptOutput));
+        }
+        return rootOutput;
+    }
+
+    float AnimationNodeImpl::getDuration() const
+    {
+        return m_duration;
+    }
+
+    size_t AnimationNodeImpl::getChannelCount() const
+    {
+        return m_channels.size();
+    }
+
+    std::optional<LogicNodeRuntimeError> AnimationNodeImpl::update()
+    {
+        float time = getInputs()->getChild(TimeInputIndex)->m_impl->getValueAs<float>();
+        const bool loop = getInputs()->getChild(LoopInputIndex)->m_impl->getValueAs<bool>();
+
+        if (!std::isfinite(time))
+        {
+            return LogicNodeRuntimeError{ fmt::format("Can't evaluate animation '{}' at invalid time {}!", getName(), time) };
+        }
+
+        if (loop && m_duration > 0.f)
+        {
+            time = std::fmod(time, m_duration);
+            if (time < 0.f)
+            {
+                time += m_duration;
+            }
+        }
+
+        for (size_t i = 0; i < m_channels.size(); ++i)
+        {
+            gatherChannel(i, time);
+        }
+        evaluateBatch();
+        scatterResults();
+
+        return std::nullopt;
+    }
+
+    void AnimationNodeImpl::findSegment(size_t channelIndex, float time, size_t& segment, float& alpha)
+    {
+        Channel& channel = m_channels[channelIndex];
+        const auto keysBegin = m_timeStamps.cbegin() + static_cast<std::ptrdiff_t>(channel.firstKey);
+        const auto keysEnd = keysBegin + static_cast<std::ptrdiff_t>(channel.keyCount);
+        const auto key = [this, &channel](size_t index) { return m_timeStamps[channel.firstKey + index]; };
+
+        // Before the first or after the last keyframe the value of that keyframe is held
+        if (time <= key(0))
+        {
+            segment = 0u;
+            alpha = 0.f;
+            return;
+        }
+        if (time >= key(channel.keyCount - 1))
+        {
+            segment = channel.keyCount - 1;
+            alpha = 0.f;
+            return;
+        }
+
+        const auto segmentContainsTime = [&key, &channel, time](size_t s) {
+            return s + 1 < channel.keyCount && key(s) <= time && time < key(s + 1);
+        };
+        size_t candidate = channel.lastSegment;
+        if (!segmentContainsTime(candidate))
+        {
+            if (segmentContainsTime(candidate + 1))
+            {
+                ++candidate;
+            }
+            else
+            {
+                candidate = static_cast<size_t>(std::upper_bound(keysBegin, keysEnd, time) - keysBegin) - 1u;
+            }
+        }
+
+        channel.lastSegment = candidate;
+        segment = candidate;
+        alpha = (time - key(candidate)) / (key(candidate + 1) - key(candidate));
+    }
+
+    void AnimationNodeImpl::gatherChannel(size_t channelIndex, float time)
+    {
+        size_t segment = 0u;
+        float alpha = 0.f;
+        findSegment(channelIndex, time, segment, alpha);
+
+        const Channel& channel = m_channels[channelIndex];
+        const size_t components = channel.componentCount;
+        const size_t next = std::min(segment + 1, channel.keyCount - 1);
+        const size_t from = channel.firstValue + segment * components;
+        const size_t to = channel.firstValue + next * components;
+        const size_t first = channel.firstComponent;
+
+        float weight0 = 1.f;
+        float weight1 = 0.f;
+        float tangentWeight0 = 0.f;
+        float tangentWeight1 = 0.f;
+
+        switch (channel.interpolation)
+        {
+        case EInterpolationType::Step:
+            break;
+        case EInterpolationType::Linear:
+            weight0 = 1.f - alpha;
+            weight1 = alpha;
+            break;
+        case EInterpolationType::Cubic:
+        {
+            // Cubic Hermite basis, tangents are scaled by the segment duration
+            const float alpha2 = alpha * alpha;
+            const float alpha3 = alpha2 * alpha;
+            const float segmentDuration = m_timeStamps[channel.firstKey + next] - m_timeStamps[channel.firstKey + segment];
+            weight0 = 2.f * alpha3 - 3.f * alpha2 + 1.f;
+            weight1 = -2.f * alpha3 + 3.f * alpha2;
+            tangentWeight0 = (alpha3 - 2.f * alpha2 + alpha) * segmentDuration;
+            tangentWeight1 = (alpha3 - alpha2) * segmentDuration;
+            break;
+        }
+        case EInterpolationType::Slerp:
+        {
+            const vec4f rotation = Slerp(
+                { m_keyframes[from], m_keyframes[from + 1], m_keyframes[from + 2], m_keyframes[from + 3] },
+                { m_keyframes[to], m_keyframes[to + 1], m_keyframes[to + 2], m_keyframes[to + 3] },
+                alpha);
+            for (size_t c = 0; c < 4; ++c)
+            {
+                m_batch.value0[first + c] = rotation[c];
+                m_batch.value1[first + c] = 0.f;
+                m_batch.tangent0[first + c] = 0.f;
+                m_batch.tangent1[first + c] = 0.f;
+                m_batch.weight0[first + c] = 1.f;
+                m_batch.weight1[first + c] = 0.f;
+                m_batch.tangentWeight0[first + c] = 0.f;
+                m_batch.tangentWeight1[first + c] = 0.f;
+            }
+            return;
+        }
+        }
+
+        const bool isCubic = (channel.interpolation == EInterpolationType::Cubic);
+        const size_t tangentOut = channel.firstTangent + segment * components;
+        const size_t tangentIn = channel.firstTangent + next * components;
+        for (size_t c = 0; c < components; ++c)
+        {
+            m_batch.value0[first + c] = m_keyframes[from + c];
+            m_batch.value1[first + c] = m_keyframes[to + c];
+            m_batch.tangent0[first + c] = isCubic ? m_tangentsOut[tangentOut + c] : 0.f;
+            m_batch.tangent1[first + c] = isCubic ? m_tangentsIn[tangentIn + c] : 0.f;
+            m_batch.weight0[first + c] = weight0;
+            m_batch.weight1[first + c] = weight1;
+            m_batch.tangentWeight0[first + c] = tangentWeight0;
+            m_batch.tangentWeight1[first + c] = tangentWeight1;
+        }
+    }
+
+    void AnimationNodeImpl::evaluateBatch()
+    {
+        // Plain loop over contiguous arrays without branches, so that it's vectorized for whatever SIMD width the target has
+        const std::vector<float>& value0 = m_batch.value0;
+        const std::vector<float>& value1 = m_batch.value1;
+        const std::vector<float>& tangent0 = m_batch.tangent0;
+        const std::vector<float>& tangent1 = m_batch.tangent1;
+        const std::vector<float>& weight0 = m_batch.weight0;
+        const std::vector<float>& weight1 = m_batch.weight1;
+        const std::vector<float>& tangentWeight0 = m_batch.tangentWeight0;
+        const std::vector<float>& tangentWeight1 = m_batch.tangentWeight1;
+        std::vector<float>& result = m_batch.result;
+
+        const size_t count = result.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            result[i] = weight0[i] * value0[i] + weight1[i] * value1[i] + tangentWeight0[i] * tangent0[i] + tangentWeight1[i] * tangent1[i];
+        }
+    }
+
+    void AnimationNodeImpl::scatterResults()
+    {
+        for (const auto& channel : m_channels)
+        {
+            const std::vector<float>& result = m_batch.result;
+            const size_t first = channel.firstComponent;
+            switch (channel.type)
+            {
+            case EPropertyType::Float:
+                channel.output->setValue(result[first], false);
+                break;
+            case EPropertyType::Vec2f:
+                channel.output->setValue(vec2f{ result[first], result[first + 1] }, false);
+                break;
+            case EPropertyType::Vec3f:
+                channel.output->setValue(vec3f{ result[first], result[first + 1], result[first + 2] }, false);
+                break;
+            case EPropertyType::Vec4f:
+                channel.output->setValue(vec4f{ result[first], result[first + 1], result[first + 2], result[first + 3] }, false);
+                break;
+            case EPropertyType::Int32:
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::Struct:
+            case EPropertyType::String:
+            case EPropertyType::Bool:
+            case EPropertyType::Array:
+                assert(false && "Unsupported channel type, must be caught by ValidateChannels()");
+                break;
+            }
+        }
+    }
+
+    flatbuffers::Offset<rlogic_serialization::AnimationNode> AnimationNodeImpl::Serialize(const AnimationNodeImpl& animationNode, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    {
+        std::vector<flatbuffers::Offset<rlogic_serialization::AnimationChannel>> channels;
+        channels.reserve(animationNode.m_channels.size());
+
+        for (const auto& channel : animationNode.m_channels)
+        {
+            const size_t valueCount = channel.keyCount * channel.componentCount;
+            const bool isCubic = (channel.interpolation == EInterpolationType::Cubic);
+            channels.push_back(rlogic_serialization::CreateAnimationChannel(builder,
+                builder.CreateSharedString(channel.name.data(), channel.name.size()),
+                ConvertEPropertyTypeToSerializationType(channel.type),
+                ConvertInterpolationToSerialization(channel.interpolation),
+                builder.CreateVector(&animationNode.m_timeStamps[channel.firstKey], channel.keyCount),
+                builder.CreateVector(&animationNode.m_keyframes[channel.firstValue], valueCount),
+                isCubic ? builder.CreateVector(&animationNode.m_tangentsIn[channel.firstTangent], valueCount) : flatbuffers::Offset<flatbuffers::Vector<float>>(),
+                isCubic ? builder.CreateVector(&animationNode.m_tangentsOut[channel.firstTangent], valueCount) : flatbuffers::Offset<flatbuffers::Vector<float>>()
+            ));
+        }
+
+        auto node = rlogic_serialization::CreateAnimationNode(builder,
+            builder.CreateSharedString(animationNode.getName().data(), animationNode.getName().size()),
+            builder.CreateVector(channels),
+            PropertyImpl::Serialize(*animationNode.getInputs()->m_impl, builder, serializationMap),
+            PropertyImpl::Serialize(*animationNode.getOutputs()->m_impl, builder, serializationMap)
+        );
+        builder.Finish(node);
+
+        return node;
+    }
+
+    std::unique_ptr<AnimationNodeImpl> AnimationNodeImpl::Deserialize(
+        const rlogic_serialization::AnimationNode& animationNode,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        if (!animationNode.name())
+        {
+            errorReporting.add("Fatal error during loading of AnimationNode from serialized data: missing name!");
+            return nullptr;
+        }
+
+        const std::string_view name = animationNode.name()->string_view();
+
+        if (!animationNode.channels())
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}' from serialized data: missing channels!", name));
+            return nullptr;
+        }
+
+        AnimationChannels channels;
+        channels.reserve(animationNode.channels()->size());
+        for (const auto* serializedChannel : *animationNode.channels())
+        {
+            assert(serializedChannel);
+            const std::optional<EPropertyType> type = ConvertSerializationTypeToEPropertyType(serializedChannel->type());
+            const std::optional<EInterpolationType> interpolation = ConvertSerializationInterpolation(serializedChannel->interpolation());
+            if (!serializedChannel->name() || !type || !interpolation)
+            {
+                errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}' from serialized data: invalid channel!", name));
+                return nullptr;
+            }
+
+            AnimationChannel channel;
+            channel.name = serializedChannel->name()->str();
+            channel.type = *type;
+            channel.interpolation = *interpolation;
+            channel.timeStamps = CopyFloats(serializedChannel->timeStamps());
+            channel.keyframes = CopyFloats(serializedChannel->keyframes());
+            channel.tangentsIn = CopyFloats(serializedChannel->tangentsIn());
+            channel.tangentsOut = CopyFloats(serializedChannel->tangentsOut());
+            channels.push_back(std::move(channel));
+        }
+
+        const std::optional<std::string> channelError = ValidateChannels(channels);
+        if (channelError)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}' from serialized data: {}!", name, *channelError));
+            return nullptr;
+        }
+
+        if (!animationNode.rootInput())
+        {
+            errorReporting.add("Fatal error during loading of AnimationNode from serialized data: missing root input!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootInput = PropertyImpl::Deserialize(*animationNode.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        if (!rootInput)
+        {
+            return nullptr;
+        }
+
+        if (!animationNode.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of AnimationNode from serialized data: missing root output!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootOutput = PropertyImpl::Deserialize(*animationNode.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!rootOutput)
+        {
+            return nullptr;
+        }
+
+        if (!rootInput->hasSameStructureAs(*CreateRootInput()) || !rootOutput->hasSameStructureAs(*CreateRootOutput(channels)))
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}' from serialized data: properties don't match the animation channels!", name));
+            return nullptr;
+        }
+
+        return std::unique_ptr<AnimationNodeImpl>(new AnimationNodeImpl(name, channels, std::move(rootInput), std::move(rootOutput)));
+    }
+}
@@ -0,0 +1,127 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+
+#include "ramses-logic/AnimationNode.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rlogic_serialization
+{
+    struct AnimationNode;
+}
+
+namespace flatbuffers
+{
+    class FlatBufferBuilder;
+    template<typename T> struct Offset;
+}
+
+namespace rlogic::internal
+{
+    class ErrorReporting;
+    class PropertyImpl;
+
+    class AnimationNodeImpl : public LogicNodeImpl
+    {
+    public:
+        // Returns an error message if the keyframe data of any channel is inconsistent
+        [[nodiscard]] static std::optional<std::string> ValidateChannels(const AnimationChannels& channels);
+
+        AnimationNodeImpl(std::string_view name, const AnimationChannels& channels);
+        // Move-able (noexcept); Not copy-able
+        ~AnimationNodeImpl() noexcept override = default;
+        AnimationNodeImpl(AnimationNodeImpl&& other) noexcept = default;
+        AnimationNodeImpl& operator=(AnimationNodeImpl&& other) noexcept = default;
+        AnimationNodeImpl(const AnimationNodeImpl& other) = delete;
+        AnimationNodeImpl& operator=(const AnimationNodeImpl& other) = delete;
+
+        [[nodiscard]] float getDuration() const;
+        [[nodiscard]] size_t getChannelCount() const;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::AnimationNode> Serialize(
+            const AnimationNodeImpl& animationNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<AnimationNodeImpl> Deserialize(
+            const rlogic_serialization::AnimationNode& animationNode,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+    private:
+        AnimationNodeImpl(std::string_view name, const AnimationChannels& channels, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
+
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> CreateRootInput();
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> CreateRootOutput(const AnimationChannels& channels);
+
+        // Finds the keyframe segment which contains the given time and the relative position in it
+        void findSegment(size_t channelIndex, float time, size_t& segment, float& alpha);
+        // Writes the interpolation inputs of a channel into the evaluation batch
+        void gatherChannel(size_t channelIndex, float time);
+        void evaluateBatch();
+        void scatterResults();
+
+        // Keyframe data is not stored per channel, but in arrays shared by all channels
+        struct Channel
+        {
+            std::string name;
+            EPropertyType type = EPropertyType::Float;
+            EInterpolationType interpolation = EInterpolationType::Linear;
+            size_t componentCount = 0u;
+            size_t firstKey = 0u;
+            size_t keyCount = 0u;
+            // Index of the first component of the first keyframe in m_keyframes
+            size_t firstValue = 0u;
+            // Index into the tangent arrays, only valid for cubic channels
+            size_t firstTangent = 0u;
+            // Index of the first component in the evaluation batch
+            size_t firstComponent = 0u;
+            // Playback usually advances by a small step, so the previous segment is tried first
+            size_t lastSegment = 0u;
+            PropertyImpl* output = nullptr;
+        };
+
+        std::vector<Channel> m_channels;
+        std::vector<float> m_timeStamps;
+        std::vector<float> m_keyframes;
+        std::vector<float> m_tangentsIn;
+        std::vector<float> m_tangentsOut;
+        float m_duration = 0.f;
+
+        // Evaluation batch, one entry per output component of all channels (structure of arrays).
+        // Every interpolation type (except slerp, which is computed while gathering) is expressed as
+        // result = weight0 * value0 + weight1 * value1 + tangentWeight0 * tangent0 + tangentWeight1 * tangent1
+        // so that all components are evaluated by a single loop which the compiler can vectorize
+        struct EvaluationBatch
+        {
+            std::vector<float> value0;
+            std::vector<float> value1;
+            std::vector<float> tangent0;
+            std::vector<float> tangent1;
+            std::vector<float> weight0;
+            std::vector<float> weight1;
+            std::vector<float> tangentWeight0;
+            std::vector<float> tangentWeight1;
+            std::vector<float> result;
+        };
+
+        EvaluationBatch m_batch;
+    };
+}
@@ -0,0 +1,27 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/ExpressionNode.h"
+#include "impl/ExpressionNodeImpl.h"
+
+namespace rlogic
+{
+    ExpressionNode::ExpressionNode(std::unique_ptr<internal::ExpressionNodeImpl> impl) noexcept
+        // The impl pointer is owned by this class, but a reference to the data is passed to the base class
+        : LogicNode(std::ref(static_cast<internal::LogicNodeImpl&>(*impl)))
+        , m_expressionNode(std::move(impl))
+    {
+    }
+
+    ExpressionNode::~ExpressionNode() noexcept = default;
+
+    std::string_view ExpressionNode::getSource() const
+    {
+        return m_expressionNode->getSource();
+    }
+}
@@ -0,0 +1,247 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/ExpressionNodeImpl.h"
+#include "impl/PropertyImpl.h"
+
+#include "internals/ErrorReporting.h"
+#include "internals/ExpressionCompiler.h"
+
+#include "ramses-logic/Property.h"
+
+#include "generated/ExpressionNodeGen.h"
+
+#include "fmt/format.h"
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        void ReadInput(const PropertyImpl& input, ExpressionValue& value)
+        {
+            switch (input.getType())
+            {
+            case EPropertyType::Float:
+                value.components[0] = input.getValueAs<float>();
+                break;
+            case EPropertyType::Vec2f:
+            {
+                const vec2f& vec = input.getValueAs<vec2f>();
+                value.components = { vec[0], vec[1], 0.f, 0.f };
+                break;
+            }
+            case EPropertyType::Vec3f:
+            {
+                const vec3f& vec = input.getValueAs<vec3f>();
+                value.components = { vec[0], vec[1], vec[2], 0.f };
+                break;
+            }
+            case EPropertyType::Vec4f:
+                value.components = input.getValueAs<vec4f>();
+                break;
+            case EPropertyType::Int32:
+                value.integer = input.getValueAs<int32_t>();
+                break;
+            case EPropertyType::Bool:
+                value.integer = input.getValueAs<bool>() ? 1 : 0;
+                break;
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                assert(false && "Unsupported input type, must be caught by ExpressionCompiler");
+                break;
+            }
+        }
+
+        void WriteOutput(const ExpressionValue& value, PropertyImpl& output)
+        {
+            const std::array<float, 4>& c = value.components;
+            switch (output.getType())
+            {
+            case EPropertyType::Float:
+                output.setValue(c[0], false);
+                break;
+            case EPropertyType::Vec2f:
+                output.setValue(vec2f{ c[0], c[1] }, false);
+                break;
+            case EPropertyType::Vec3f:
+                output.setValue(vec3f{ c[0], c[1], c[2] }, false);
+                break;
+            case EPropertyType::Vec4f:
+                output.setValue(c, false);
+                break;
+            case EPropertyType::Int32:
+                output.setValue(value.integer, false);
+                break;
+            case EPropertyType::Bool:
+                output.setValue(value.integer != 0, false);
+                break;
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                assert(false && "Unsupported output type, must be caught by ExpressionCompiler");
+                break;
+            }
+        }
+    }
+
+    ExpressionNodeImpl::ExpressionNodeImpl(std::string_view name, std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, ExpressionProgram program)
+        : ExpressionNodeImpl(name, source, std::move(program),
+            CreateRootProperty(inputs, "IN", EPropertySemantics::ScriptInput),
+            CreateRootProperty(outputs, "OUT", EPropertySemantics::ScriptOutput))
+    {
+    }
+
+    ExpressionNodeImpl::ExpressionNodeImpl(std::string_view name, std::string_view source, ExpressionProgram program, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
+        : LogicNodeImpl(name)
+        , m_source(source)
+        , m_program(std::move(program))
+    {
+        setRootProperties(std::make_unique<Property>(std::move(rootInput)), std::make_unique<Property>(std::move(rootOutput)));
+
+        m_inputs.reserve(getInputs()->getChildCount());
+        for (size_t i = 0; i < getInputs()->getChildCount(); ++i)
+        {
+            m_inputs.push_back(getInputs()->getChild(i)->m_impl.get());
+        }
+        m_outputs.reserve(getOutputs()->getChildCount());
+        for (size_t i = 0; i < getOutputs()->getChildCount(); ++i)
+        {
+            m_outputs.push_back(getOutputs()->getChild(i)->m_impl.get());
+        }
+    }
+
+    std::unique_ptr<PropertyImpl> ExpressionNodeImpl::CreateRootProperty(const ExpressionVariables& variables, std::string_view name, EPropertySemantics semantics)
+    {
+        auto rootProperty = std::make_unique<PropertyImpl>(name, EPropertyType::Struct, semantics);
+        for (const auto& variable : variables)
+        {
+            rootProperty->addChild(std::make_unique<PropertyImpl>(variable.name, variable.type, semantics));
+        }
+        return rootProperty;
+    }
+
+    ExpressionVariables ExpressionNodeImpl::GetVariables(const PropertyImpl& rootProperty)
+    {
+        ExpressionVariables variables;
+        variables.reserve(rootProperty.getChildCount());
+        for (size_t i = 0; i < rootProperty.getChildCount(); ++i)
+        {
+            const Property* child = rootProperty.getChild(i);
+            variables.push_back({ std::string(child->getName()), child->getType() });
+        }
+        return variables;
+    }
+
+    std::string_view ExpressionNodeImpl::getSource() const
+    {
+        return m_source;
+    }
+
+    std::optional<LogicNodeRuntimeError> ExpressionNodeImpl::update()
+    {
+        for (size_t i = 0; i < m_inputs.size(); ++i)
+        {
+            ReadInput(*m_inputs[i], m_program.registers[i]);
+        }
+
+        const std::optional<std::string> error = m_program.execute();
+        if (error)
+        {
+            return LogicNodeRuntimeError{ fmt::format("Can't evaluate expression node '{}': {}!", getName(), *error) };
+        }
+
+        for (size_t i = 0; i < m_outputs.size(); ++i)
+        {
+            WriteOutput(m_program.registers[m_program.outputRegisters[i]], *m_outputs[i]);
+        }
+
+        return std::nullopt;
+    }
+
+    flatbuffers::Offset<rlogic_serialization::ExpressionNode> ExpressionNodeImpl::Serialize(const ExpressionNodeImpl& expressionNode, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    {
+        // The program is not serialized, it's compiled again from the source when loading
+        auto node = rlogic_serialization::CreateExpressionNode(builder,
+            builder.CreateSharedString(expressionNode.getName().data(), expressionNode.getName().size()),
+            builder.CreateString(expressionNode.m_source),
+            PropertyImpl::Serialize(*expressionNode.getInputs()->m_impl, builder, serializationMap),
+            PropertyImpl::Serialize(*expressionNode.getOutputs()->m_impl, builder, serializationMap)
+        );
+        builder.Finish(node);
+
+        return node;
+    }
+
+    std::unique_ptr<ExpressionNodeImpl> ExpressionNodeImpl::Deserialize(
+        const rlogic_serialization::ExpressionNode& expressionNode,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        if (!expressionNode.name())
+        {
+            errorReporting.add("Fatal error during loading of ExpressionNode from serialized data: missing name!");
+            return nullptr;
+        }
+
+        const std::string_view name = expressionNode.name()->string_view();
+
+        if (!expressionNode.source())
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of ExpressionNode '{}' from serialized data: missing source!", name));
+            return nullptr;
+        }
+
+        if (!expressionNode.rootInput())
+        {
+            errorReporting.add("Fatal error during loading of ExpressionNode from serialized data: missing root input!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootInput = PropertyImpl::Deserialize(*expressionNode.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        if (!rootInput)
+        {
+            return nullptr;
+        }
+
+        if (!expressionNode.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of ExpressionNode from serialized data: missing root output!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootOutput = PropertyImpl::Deserialize(*expressionNode.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!rootOutput)
+        {
+            return nullptr;
+        }
+
+        if (rootInput->getType() != EPropertyType::Struct || rootOutput->getType() != EPropertyType::Struct)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of ExpressionNode '{}' from serialized data: invalid root properties!", name));
+            return nullptr;
+        }
+
+        // The declarations are part of the serialized properties, so only the source has to be compiled
+        const std::string_view source = expressionNode.source()->string_view();
+        ExpressionCompilationResult compilation = ExpressionCompiler::Compile(source, GetVariables(*rootInput), GetVariables(*rootOutput));
+        if (!compilation.program)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of ExpressionNode '{}' from serialized data: {}!", name, compilation.errorMessage));
+            return nullptr;
+        }
+
+        return std::unique_ptr<ExpressionNodeImpl>(new ExpressionNodeImpl(name, source, std::move(*compilation.program), std::move(rootInput), std::move(rootOutput)));
+    }
+}
@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+#include "internals/ExpressionProgram.h"
+#include "internals/EPropertySemantics.h"
+
+#include "ramses-logic/ExpressionNode.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rlogic_serialization
+{
+    struct ExpressionNode;
+}
+
+namespace flatbuffers
+{
+    class FlatBufferBuilder;
+    template<typename T> struct Offset;
+}
+
+namespace rlogic::internal
+{
+    class ErrorReporting;
+    class PropertyImpl;
+
+    class ExpressionNodeImpl : public LogicNodeImpl
+    {
+    public:
+        // The program must be compiled from the source and the declarations by ExpressionCompiler
+        ExpressionNodeImpl(std::string_view name, std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, ExpressionProgram program);
+        // Move-able (noexcept); Not copy-able
+        ~ExpressionNodeImpl() noexcept override = default;
+        ExpressionNodeImpl(ExpressionNodeImpl&& other) noexcept = default;
+        ExpressionNodeImpl& operator=(ExpressionNodeImpl&& other) noexcept = default;
+        ExpressionNodeImpl(const ExpressionNodeImpl& other) = delete;
+        ExpressionNodeImpl& operator=(const ExpressionNodeImpl& other) = delete;
+
+        [[nodiscard]] std::string_view getSource() const;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::ExpressionNode> Serialize(
+            const ExpressionNodeImpl& expressionNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<ExpressionNodeImpl> Deserialize(
+            const rlogic_serialization::ExpressionNode& expressionNode,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+    private:
+        ExpressionNodeImpl(std::string_view name, std::string_view source, ExpressionProgram program, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
+
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> CreateRootProperty(const ExpressionVariables& variables, std::string_view name, EPropertySemantics semantics);
+        [[nodiscard]] static ExpressionVariables GetVariables(const PropertyImpl& rootProperty);
+
+        std::string m_source;
+        ExpressionProgram m_program;
+        // Properties in the order of the input and output registers of the program, the
+        // program registers of the inputs are the first ones (see ExpressionProgram)
+        std::vector<PropertyImpl*> m_inputs;
+        std::vector<PropertyImpl*> m_outputs;
+    };
+}
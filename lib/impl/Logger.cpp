@@ -30,4 +30,9 @@ namespace rlogic::Logger
     {
         internal::LoggerImpl::GetInstance().setDefaultLogging(loggingEnabled);
     }
+
+    void SetAsyncLogging(bool enabled)
+    {
+        internal::LoggerImpl::GetInstance().setAsyncLogging(enabled);
+    }
 }
@@ -7,32 +7,163 @@
 //  -------------------------------------------------------------------------
 
 #include "impl/LoggerImpl.h"
+#include "internals/LogMessageQueue.h"
+
+#include <chrono>
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        constexpr size_t AsyncQueueCapacity = 1024u;
+        // The output thread polls instead of being notified, so that logging threads never make system calls
+        constexpr std::chrono::milliseconds AsyncPollInterval{1};
+    }
+
     LoggerImpl::LoggerImpl() noexcept
         : m_logHandler(nullptr)
     {
     }
 
+    LoggerImpl::~LoggerImpl() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_asyncControlMutex);
+        stopAsyncLogging();
+    }
+
     void LoggerImpl::setLogHandler(Logger::LogHandlerFunc logHandlerFunc)
     {
+        std::lock_guard<std::mutex> lock(m_outputMutex);
+        m_hasLogHandler.store(nullptr != logHandlerFunc, std::memory_order_relaxed);
         m_logHandler = std::move(logHandlerFunc);
     }
 
     void LoggerImpl::setDefaultLogging(bool loggingEnabled)
     {
-        m_defaultLogging = loggingEnabled;
+        m_defaultLogging.store(loggingEnabled, std::memory_order_relaxed);
     }
 
     void LoggerImpl::setLogVerbosityLimit(ELogMessageType verbosityLimit)
     {
-        m_logVerbosityLimit = verbosityLimit;
+        m_logVerbosityLimit.store(verbosityLimit, std::memory_order_relaxed);
     }
 
     ELogMessageType LoggerImpl::getLogVerbosityLimit() const
     {
-        return m_logVerbosityLimit;
+        return m_logVerbosityLimit.load(std::memory_order_relaxed);
+    }
+
+    void LoggerImpl::setAsyncLogging(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(m_asyncControlMutex);
+        if (!enabled)
+        {
+            stopAsyncLogging();
+            return;
+        }
+
+        if (m_asyncLogging.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        if (!m_asyncQueue)
+        {
+            m_asyncQueue = std::make_unique<LogMessageQueue>(AsyncQueueCapacity);
+        }
+        // Release, so that logging threads which see the flag also see the queue
+        m_asyncLogging.store(true, std::memory_order_release);
+        m_outputThread = std::thread([this]() {
+            std::string messageBuffer;
+            messageBuffer.reserve(QueuedLogMessage::ReservedMessageSize);
+            while (m_asyncLogging.load(std::memory_order_relaxed))
+            {
+                if (!outputQueuedMessages(messageBuffer))
+                {
+                    std::this_thread::sleep_for(AsyncPollInterval);
+                }
+            }
+        });
+    }
+
+    bool LoggerImpl::isAsyncLogging() const
+    {
+        return m_asyncLogging.load(std::memory_order_relaxed);
     }
 
+    void LoggerImpl::stopAsyncLogging()
+    {
+        if (!m_asyncLogging.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Sequentially consistent with the check in emit(), so that every producer either sees the flag cleared or is seen here
+        m_asyncLogging.store(false, std::memory_order_seq_cst);
+        m_outputThread.join();
+        while (m_asyncProducers.load(std::memory_order_seq_cst) != 0u)
+        {
+            std::this_thread::yield();
+        }
+
+        // Output what was queued until now, later messages are output synchronously
+        std::string messageBuffer;
+        (void)outputQueuedMessages(messageBuffer);
+    }
+
+    void LoggerImpl::emit(ELogMessageType messageType, std::string_view message)
+    {
+        if (m_asyncLogging.load(std::memory_order_acquire))
+        {
+            // Announce the push before checking the flag again, stopAsyncLogging() waits for it before the final output
+            m_asyncProducers.fetch_add(1u, std::memory_order_seq_cst);
+            if (m_asyncLogging.load(std::memory_order_seq_cst))
+            {
+                // Never waits for the output thread, messages are dropped if it can't keep up
+                if (!m_asyncQueue->push(messageType, message))
+                {
+                    m_droppedMessages.fetch_add(1u, std::memory_order_relaxed);
+                }
+                m_asyncProducers.fetch_sub(1u, std::memory_order_release);
+                return;
+            }
+            m_asyncProducers.fetch_sub(1u, std::memory_order_release);
+        }
+
+        std::lock_guard<std::mutex> lock(m_outputMutex);
+        output(messageType, message);
+    }
+
+    bool LoggerImpl::outputQueuedMessages(std::string& messageBuffer)
+    {
+        bool hasOutput = false;
+        ELogMessageType messageType = ELogMessageType::Info;
+        while (m_asyncQueue->pop(messageType, messageBuffer))
+        {
+            std::lock_guard<std::mutex> lock(m_outputMutex);
+            output(messageType, messageBuffer);
+            hasOutput = true;
+        }
+
+        const size_t droppedMessages = m_droppedMessages.exchange(0u, std::memory_order_relaxed);
+        if (droppedMessages != 0u)
+        {
+            std::lock_guard<std::mutex> lock(m_outputMutex);
+            output(ELogMessageType::Warn, fmt::format("Dropped {} log messages because the asynchronous log queue was full", droppedMessages));
+            hasOutput = true;
+        }
+        return hasOutput;
+    }
+
+    void LoggerImpl::output(ELogMessageType messageType, std::string_view message)
+    {
+        if (m_defaultLogging.load(std::memory_order_relaxed))
+        {
+            PrintLogMessage(messageType, message);
+        }
+        if (nullptr != m_logHandler)
+        {
+            m_logHandler(messageType, message);
+        }
+    }
 }
@@ -13,29 +13,45 @@
 
 #include "fmt/format.h"
 
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
 #ifdef __ANDROID__
 #include <android/log.h>
 #else
 #include <iostream>
 #endif
 
-#define LOG_FATAL(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Fatal, __VA_ARGS__)
-
-#define LOG_ERROR(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Error, __VA_ARGS__)
-
-#define LOG_WARN(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Warn, __VA_ARGS__)
-
-#define LOG_INFO(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Info, __VA_ARGS__)
-
-#define LOG_DEBUG(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Debug, __VA_ARGS__)
+// Least important message type which is compiled in (value of rlogic::ELogMessageType), see CMake option ramses-logic_MAX_LOG_LEVEL
+#ifndef RLOGIC_MAX_LOG_LEVEL
+#define RLOGIC_MAX_LOG_LEVEL 6
+#endif
 
-#define LOG_TRACE(...) \
-internal::LoggerImpl::GetInstance().log(rlogic::ELogMessageType::Trace, __VA_ARGS__)
+// Messages above RLOGIC_MAX_LOG_LEVEL are removed by the compiler. The arguments of all other messages are only evaluated
+// if the message passes the verbosity limit, so disabled messages cost a single relaxed atomic load
+#define RLOGIC_LOG(messageType, ...) \
+do \
+{ \
+    if constexpr (static_cast<int>(messageType) <= RLOGIC_MAX_LOG_LEVEL) \
+    { \
+        if (rlogic::internal::LoggerImpl::GetInstance().isLogged(messageType)) \
+        { \
+            rlogic::internal::LoggerImpl::GetInstance().log(messageType, __VA_ARGS__); \
+        } \
+    } \
+} while (false)
+
+#define LOG_FATAL(...) RLOGIC_LOG(rlogic::ELogMessageType::Fatal, __VA_ARGS__)
+#define LOG_ERROR(...) RLOGIC_LOG(rlogic::ELogMessageType::Error, __VA_ARGS__)
+#define LOG_WARN(...) RLOGIC_LOG(rlogic::ELogMessageType::Warn, __VA_ARGS__)
+#define LOG_INFO(...) RLOGIC_LOG(rlogic::ELogMessageType::Info, __VA_ARGS__)
+#define LOG_DEBUG(...) RLOGIC_LOG(rlogic::ELogMessageType::Debug, __VA_ARGS__)
+#define LOG_TRACE(...) RLOGIC_LOG(rlogic::ELogMessageType::Trace, __VA_ARGS__)
 
 namespace rlogic::internal
 {
@@ -63,15 +79,28 @@ namespace rlogic::internal
         return "INFO ";
     }
 
+    class LogMessageQueue;
+
+    // Shared by all LogicEngine instances, which can be updated on different threads. Messages which are filtered out only cost
+    // relaxed atomic loads, so that disabled debug logs in update() don't make engines on different threads contend for anything.
+    // Only messages which are actually emitted take the lock, which also keeps their lines from being interleaved.
+    // With asynchronous logging, emitted messages are only copied into a lock-free ring buffer and output by a separate thread
     class LoggerImpl
     {
     public:
-        ~LoggerImpl() noexcept = default;
+        ~LoggerImpl() noexcept;
         LoggerImpl(const LoggerImpl& other) = delete;
         LoggerImpl(LoggerImpl&& other) = delete;
         LoggerImpl& operator=(const LoggerImpl& other) = delete;
         LoggerImpl& operator=(LoggerImpl&& other) = delete;
 
+        [[nodiscard]] bool isLogged(ELogMessageType messageType) const
+        {
+            return !logMessageExceedsVerbosityLimit(messageType) &&
+                (m_defaultLogging.load(std::memory_order_relaxed) || m_hasLogHandler.load(std::memory_order_relaxed));
+        }
+
+        // Formats and emits the message, callers check isLogged() first (done by the LOG_ macros)
         template<typename ...ARGS>
         void log(ELogMessageType messageType, const ARGS&... args);
 
@@ -79,6 +108,8 @@ namespace rlogic::internal
         ELogMessageType getLogVerbosityLimit() const;
         void setLogHandler(Logger::LogHandlerFunc logHandlerFunc);
         void setDefaultLogging(bool loggingEnabled);
+        void setAsyncLogging(bool enabled);
+        [[nodiscard]] bool isAsyncLogging() const;
 
         static LoggerImpl& GetInstance();
 
@@ -87,39 +118,44 @@ namespace rlogic::internal
 
         [[nodiscard]] bool logMessageExceedsVerbosityLimit(ELogMessageType messageType) const
         {
-            return (messageType > m_logVerbosityLimit);
+            return (messageType > m_logVerbosityLimit.load(std::memory_order_relaxed));
         }
 
-        static void PrintLogMessage(ELogMessageType messageType, const std::string& message);
+        void emit(ELogMessageType messageType, std::string_view message);
+        void output(ELogMessageType messageType, std::string_view message);
+        bool outputQueuedMessages(std::string& messageBuffer);
+        void stopAsyncLogging();
+        static void PrintLogMessage(ELogMessageType messageType, std::string_view message);
 
+        // Guards m_logHandler and the output of messages
+        std::mutex             m_outputMutex;
         Logger::LogHandlerFunc m_logHandler;
-        bool                   m_defaultLogging = true;
-
-        ELogMessageType m_logVerbosityLimit = ELogMessageType::Info;
-
+        std::atomic<bool>      m_hasLogHandler = false;
+        std::atomic<bool>      m_defaultLogging = true;
+
+        std::atomic<ELogMessageType> m_logVerbosityLimit = ELogMessageType::Info;
+
+        // Created when asynchronous logging is enabled for the first time and kept, so that producers never see it destroyed
+        std::unique_ptr<LogMessageQueue> m_asyncQueue;
+        std::atomic<bool>                m_asyncLogging = false;
+        std::atomic<size_t>              m_droppedMessages = 0u;
+        // Threads which are pushing a message, so that no message is pushed after the final output of stopAsyncLogging()
+        std::atomic<size_t>              m_asyncProducers = 0u;
+        std::thread                      m_outputThread;
+        // Serializes enabling and disabling asynchronous logging
+        std::mutex                       m_asyncControlMutex;
     };
 
     template <typename... ARGS>
     inline void LoggerImpl::log(ELogMessageType messageType, const ARGS&... args)
     {
-        // Early exit if log level exceeded, or no logger configured
-        if (logMessageExceedsVerbosityLimit(messageType) || (!m_defaultLogging && !m_logHandler))
-        {
-            return;
-        }
-
-        const std::string formattedMessage = fmt::format(args...);
-        if (m_defaultLogging)
-        {
-            PrintLogMessage(messageType, formattedMessage);
-        }
-        if (nullptr != m_logHandler)
-        {
-            m_logHandler(messageType, formattedMessage);
-        }
+        // Formatted outside of the lock, short messages don't allocate memory
+        fmt::memory_buffer buffer;
+        fmt::format_to(std::back_inserter(buffer), args...);
+        emit(messageType, std::string_view(buffer.data(), buffer.size()));
     }
 
-    inline void LoggerImpl::PrintLogMessage(ELogMessageType messageType, const std::string& message)
+    inline void LoggerImpl::PrintLogMessage(ELogMessageType messageType, std::string_view message)
     {
 #ifdef __ANDROID__
 
@@ -150,7 +186,7 @@ namespace rlogic::internal
             break;
         }
 
-        __android_log_print(logLevel, "Ramses.Logic", "%s", message.c_str());
+        __android_log_print(logLevel, "Ramses.Logic", "%.*s", static_cast<int>(message.size()), message.data());
 #else
         std::cout << "[ " << GetLogMessageTypeString(messageType) << " ] " << message << std::endl;
 #endif
@@ -11,6 +11,9 @@
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include "impl/LogicEngineImpl.h"
 
@@ -50,6 +53,21 @@ namespace rlogic
         return Collection<RamsesCameraBinding>(m_impl->getApiObjects().getCameraBindings());
     }
 
+    Collection<NativeLogicNode> LogicEngine::nativeLogicNodes() const
+    {
+        return Collection<NativeLogicNode>(m_impl->getApiObjects().getNativeLogicNodes());
+    }
+
+    Collection<AnimationNode> LogicEngine::animationNodes() const
+    {
+        return Collection<AnimationNode>(m_impl->getApiObjects().getAnimationNodes());
+    }
+
+    Collection<ExpressionNode> LogicEngine::expressionNodes() const
+    {
+        return Collection<ExpressionNode>(m_impl->getApiObjects().getExpressionNodes());
+    }
+
     LuaScript* LogicEngine::findScript(std::string_view name) const
     {
         auto scriptIter = std::find_if(scripts().begin(), scripts().end(),
@@ -110,6 +128,51 @@ namespace rlogic
         return *bindingIter;
     }
 
+    NativeLogicNode* LogicEngine::findNativeLogicNode(std::string_view name) const
+    {
+        auto nodeIter = std::find_if(nativeLogicNodes().begin(), nativeLogicNodes().end(),
+            [name](const NativeLogicNode* node)
+        {
+            return node->getName() == name;
+        }
+        );
+        if (nodeIter == nativeLogicNodes().end())
+        {
+            return nullptr;
+        }
+        return *nodeIter;
+    }
+
+    AnimationNode* LogicEngine::findAnimationNode(std::string_view name) const
+    {
+        auto nodeIter = std::find_if(animationNodes().begin(), animationNodes().end(),
+            [name](const AnimationNode* node)
+        {
+            return node->getName() == name;
+        }
+        );
+        if (nodeIter == animationNodes().end())
+        {
+            return nullptr;
+        }
+        return *nodeIter;
+    }
+
+    ExpressionNode* LogicEngine::findExpressionNode(std::string_view name) const
+    {
+        auto nodeIter = std::find_if(expressionNodes().begin(), expressionNodes().end(),
+            [name](const ExpressionNode* node)
+        {
+            return node->getName() == name;
+        }
+        );
+        if (nodeIter == expressionNodes().end())
+        {
+            return nullptr;
+        }
+        return *nodeIter;
+    }
+
 
     LuaScript* LogicEngine::createLuaScriptFromSource(std::string_view source, std::string_view scriptName)
     {
@@ -136,6 +199,26 @@ namespace rlogic
         return m_impl->createRamsesCameraBinding(ramsesCamera, name);
     }
 
+    bool LogicEngine::registerNativeLogicNodeType(std::string_view typeName, NativeLogicNodeType type)
+    {
+        return m_impl->registerNativeLogicNodeType(typeName, std::move(type));
+    }
+
+    NativeLogicNode* LogicEngine::createNativeLogicNode(std::string_view typeName, std::string_view name)
+    {
+        return m_impl->createNativeLogicNode(typeName, name);
+    }
+
+    AnimationNode* LogicEngine::createAnimationNode(const AnimationChannels& channels, std::string_view name)
+    {
+        return m_impl->createAnimationNode(channels, name);
+    }
+
+    ExpressionNode* LogicEngine::createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, std::string_view name)
+    {
+        return m_impl->createExpressionNode(source, inputs, outputs, name);
+    }
+
     const std::vector<ErrorData>& LogicEngine::getErrors() const
     {
         return m_impl->getErrors();
@@ -146,6 +229,31 @@ namespace rlogic
         return m_impl->update();
     }
 
+    void LogicEngine::setUpdateClock(std::function<std::chrono::steady_clock::time_point()> clock)
+    {
+        m_impl->setUpdateClock(std::move(clock));
+    }
+
+    void LogicEngine::setOutputChangeTracking(bool enabled)
+    {
+        m_impl->setOutputChangeTracking(enabled);
+    }
+
+    bool LogicEngine::subscribeToOutputChanges(const Property& output)
+    {
+        return m_impl->subscribeToOutputChanges(output);
+    }
+
+    bool LogicEngine::unsubscribeFromOutputChanges(const Property& output)
+    {
+        return m_impl->unsubscribeFromOutputChanges(output);
+    }
+
+    const std::vector<const Property*>& LogicEngine::getChangedOutputs() const
+    {
+        return m_impl->getChangedOutputs();
+    }
+
     bool LogicEngine::loadFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
     {
         return m_impl->loadFromFile(filename, ramsesScene, enableMemoryVerification);
@@ -156,16 +264,101 @@ namespace rlogic
         return m_impl->loadFromBuffer(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification);
     }
 
+    std::future<bool> LogicEngine::loadFromFileAsync(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    {
+        return m_impl->loadFromFileAsync(filename, ramsesScene, enableMemoryVerification);
+    }
+
+    std::future<bool> LogicEngine::loadFromBufferAsync(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    {
+        return m_impl->loadFromBufferAsync(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification);
+    }
+
+    bool LogicEngine::commitAsyncLoad()
+    {
+        return m_impl->commitAsyncLoad();
+    }
+
+    void LogicEngine::setLuaMemoryLimit(size_t maxBytes)
+    {
+        m_impl->setLuaMemoryLimit(maxBytes);
+    }
+
+    LuaMemoryStatistics LogicEngine::getLuaMemoryStatistics() const
+    {
+        return m_impl->getLuaMemoryStatistics();
+    }
+
+    void LogicEngine::setGarbageCollectionStep(size_t stepSizeKB)
+    {
+        m_impl->setGarbageCollectionStep(stepSizeKB);
+    }
+
+    bool LogicEngine::collectGarbage(size_t stepSizeKB)
+    {
+        return m_impl->collectGarbage(stepSizeKB);
+    }
+
+    void LogicEngine::setLazyScriptCompilation(bool enabled)
+    {
+        m_impl->setLazyScriptCompilation(enabled);
+    }
+
+    bool LogicEngine::prewarm(size_t maxScriptCount)
+    {
+        return m_impl->prewarm(maxScriptCount);
+    }
+
+    size_t LogicEngine::getUncompiledScriptCount() const
+    {
+        return m_impl->getUncompiledScriptCount();
+    }
+
     bool LogicEngine::saveToFile(std::string_view filename)
     {
         return m_impl->saveToFile(filename);
     }
 
+    bool LogicEngine::saveToBuffer(void* buffer, size_t bufferSize, size_t& bytesWritten)
+    {
+        return m_impl->saveToBuffer(buffer, bufferSize, bytesWritten);
+    }
+
+    bool LogicEngine::saveToBuffer(std::vector<uint8_t>& buffer)
+    {
+        return m_impl->saveToBuffer(buffer);
+    }
+
+    size_t LogicEngine::estimateSerializedSize() const
+    {
+        return m_impl->estimateSerializedSize();
+    }
+
+    void LogicEngine::takeValueSnapshot(std::vector<uint8_t>& snapshot) const
+    {
+        m_impl->takeValueSnapshot(snapshot);
+    }
+
+    bool LogicEngine::restoreValueSnapshot(const void* snapshotData, size_t snapshotSize)
+    {
+        return m_impl->restoreValueSnapshot(snapshotData, snapshotSize);
+    }
+
     bool LogicEngine::link(const Property& sourceProperty, const Property& targetProperty)
     {
         return m_impl->link(sourceProperty, targetProperty);
     }
 
+    bool LogicEngine::linkWithConversion(const Property& sourceProperty, const Property& targetProperty)
+    {
+        return m_impl->linkWithConversion(sourceProperty, targetProperty);
+    }
+
+    bool LogicEngine::linkComponent(const Property& sourceProperty, size_t sourceComponent, const Property& targetProperty, size_t targetComponent)
+    {
+        return m_impl->linkComponent(sourceProperty, sourceComponent, targetProperty, targetComponent);
+    }
+
     bool LogicEngine::unlink(const Property& sourceProperty, const Property& targetProperty)
     {
         return m_impl->unlink(sourceProperty, targetProperty);
@@ -175,4 +368,86 @@ namespace rlogic
     {
         return m_impl->isLinked(logicNode);
     }
+
+    template <typename T>
+    bool LogicEngine::enqueueInputValueInternal(const Property& input, T value)
+    {
+        return m_impl->enqueueInputValue(input, PropertyTypeToEnum<T>::TYPE, std::move(value));
+    }
+
+    void LogicEngine::setInputQueueCapacity(size_t capacity)
+    {
+        m_impl->setInputQueueCapacity(capacity);
+    }
+
+    bool LogicEngine::attachInputChannel(const void* memory, size_t size, const InputChannelLayout& layout)
+    {
+        return m_impl->attachInputChannel(memory, size, layout);
+    }
+
+    bool LogicEngine::detachInputChannel(const void* memory)
+    {
+        return m_impl->detachInputChannel(memory);
+    }
+
+    uint64_t LogicEngine::getUpdateCounter() const
+    {
+        return m_impl->getUpdateCounter();
+    }
+
+    bool LogicEngine::addOutputToSnapshot(const Property& output)
+    {
+        return m_impl->addOutputToSnapshot(output);
+    }
+
+    bool LogicEngine::removeOutputFromSnapshot(const Property& output)
+    {
+        return m_impl->removeOutputFromSnapshot(output);
+    }
+
+    void LogicEngine::setOutputSnapshotBufferCount(size_t bufferCount)
+    {
+        m_impl->setOutputSnapshotBufferCount(bufferCount);
+    }
+
+    bool LogicEngine::readOutputSnapshot(OutputSnapshot& snapshot) const
+    {
+        return m_impl->readOutputSnapshot(snapshot);
+    }
+
+    bool LogicEngine::setSubgraph(LogicNode& logicNode, std::string_view subgraph)
+    {
+        return m_impl->setSubgraph(logicNode, subgraph);
+    }
+
+    std::string_view LogicEngine::getSubgraph(const LogicNode& logicNode) const
+    {
+        return m_impl->getSubgraph(logicNode);
+    }
+
+    bool LogicEngine::suspendSubgraph(std::string_view subgraph)
+    {
+        return m_impl->setSubgraphSuspended(subgraph, true);
+    }
+
+    bool LogicEngine::resumeSubgraph(std::string_view subgraph)
+    {
+        return m_impl->setSubgraphSuspended(subgraph, false);
+    }
+
+    bool LogicEngine::isSubgraphSuspended(std::string_view subgraph) const
+    {
+        return m_impl->isSubgraphSuspended(subgraph);
+    }
+
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<float>(const Property& /*input*/, float /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec2f>(const Property& /*input*/, vec2f /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec3f>(const Property& /*input*/, vec3f /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec4f>(const Property& /*input*/, vec4f /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<int32_t>(const Property& /*input*/, int32_t /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec2i>(const Property& /*input*/, vec2i /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec3i>(const Property& /*input*/, vec3i /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<vec4i>(const Property& /*input*/, vec4i /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<std::string>(const Property& /*input*/, std::string /*value*/);
+    template RLOGIC_API bool LogicEngine::enqueueInputValueInternal<bool>(const Property& /*input*/, bool /*value*/);
 }
@@ -8,16 +8,25 @@
 
 #include "impl/LogicEngineImpl.h"
 #include "impl/LuaScriptImpl.h"
+#include "impl/AnimationNodeImpl.h"
+#include "impl/ExpressionNodeImpl.h"
 
 #include "impl/LoggerImpl.h"
 #include "internals/FileUtils.h"
 #include "internals/TypeUtils.h"
 #include "internals/RamsesObjectResolver.h"
+#include "internals/ValueSnapshot.h"
+#include "internals/ExpressionCompiler.h"
+#include "internals/LinkConversion.h"
 
 // TODO Violin remove these header dependencies
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
+#include "ramses-logic/OutputSnapshot.h"
 
 #include "ramses-logic-build-config.h"
 #include "generated/LogicEngineGen.h"
@@ -27,11 +36,31 @@
 #include <string>
 #include <fstream>
 #include <streambuf>
+#include <utility>
+#include <cstring>
+#include <algorithm>
+#include <cassert>
 
 #include "fmt/format.h"
 
 namespace rlogic::internal
 {
+    LogicEngineImpl::LogicEngineImpl()
+        : m_luaState(std::make_unique<SolState>())
+        , m_inputValueQueue(std::make_unique<InputValueQueue>(DefaultInputQueueCapacity))
+        , m_outputSnapshots(std::make_unique<OutputSnapshotBuffer>(DefaultOutputSnapshotBufferCount, m_outputSnapshotContentGeneration))
+    {
+    }
+
+    LogicEngineImpl::~LogicEngineImpl() noexcept
+    {
+        // Don't leave a detached thread behind which still writes into the staged content
+        if (m_stagedContentLoader.joinable())
+        {
+            m_stagedContentLoader.join();
+        }
+    }
+
     LuaScript* LogicEngineImpl::createLuaScriptFromFile(std::string_view filename, std::string_view scriptName)
     {
         m_errors.clear();
@@ -46,13 +75,13 @@ namespace rlogic::internal
         }
 
         std::string source(std::istreambuf_iterator<char>(iStream), std::istreambuf_iterator<char>{});
-        return m_apiObjects.createLuaScript(m_luaState, source, filename, scriptName, m_errors);
+        return m_apiObjects.createLuaScript(*m_luaState, source, filename, scriptName, m_errors);
     }
 
     LuaScript* LogicEngineImpl::createLuaScriptFromSource(std::string_view source, std::string_view scriptName)
     {
         m_errors.clear();
-        return m_apiObjects.createLuaScript(m_luaState, source, "", scriptName, m_errors);
+        return m_apiObjects.createLuaScript(*m_luaState, source, "", scriptName, m_errors);
     }
 
     RamsesNodeBinding* LogicEngineImpl::createRamsesNodeBinding(ramses::Node& ramsesNode, std::string_view name)
@@ -73,9 +102,83 @@ namespace rlogic::internal
         return m_apiObjects.createRamsesCameraBinding(ramsesCamera, name);
     }
 
+    bool LogicEngineImpl::registerNativeLogicNodeType(std::string_view typeName, NativeLogicNodeType type)
+    {
+        m_errors.clear();
+
+        if (m_nativeLogicNodeTypes.find(std::string(typeName)) != m_nativeLogicNodeTypes.end())
+        {
+            m_errors.add(fmt::format("Can't register native logic node type '{}': a type with this name is already registered!", typeName));
+            return false;
+        }
+
+        const std::optional<std::string> validationError = NativeLogicNodeImpl::ValidateType(type);
+        if (validationError)
+        {
+            m_errors.add(fmt::format("Can't register native logic node type '{}': {}!", typeName, *validationError));
+            return false;
+        }
+
+        m_nativeLogicNodeTypes.emplace(std::string(typeName), std::make_shared<const NativeLogicNodeType>(std::move(type)));
+        return true;
+    }
+
+    NativeLogicNode* LogicEngineImpl::createNativeLogicNode(std::string_view typeName, std::string_view name)
+    {
+        m_errors.clear();
+
+        const auto typeIter = m_nativeLogicNodeTypes.find(std::string(typeName));
+        if (typeIter == m_nativeLogicNodeTypes.end())
+        {
+            m_errors.add(fmt::format("Can't create native logic node '{}': type '{}' is not registered!", name, typeName));
+            return nullptr;
+        }
+
+        return m_apiObjects.createNativeLogicNode(typeIter->first, typeIter->second, name);
+    }
+
+    AnimationNode* LogicEngineImpl::createAnimationNode(const AnimationChannels& channels, std::string_view name)
+    {
+        m_errors.clear();
+
+        const std::optional<std::string> validationError = AnimationNodeImpl::ValidateChannels(channels);
+        if (validationError)
+        {
+            m_errors.add(fmt::format("Can't create animation node '{}': {}!", name, *validationError));
+            return nullptr;
+        }
+
+        return m_apiObjects.createAnimationNode(channels, name);
+    }
+
+    ExpressionNode* LogicEngineImpl::createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, std::string_view name)
+    {
+        m_errors.clear();
+
+        ExpressionCompilationResult compilation = ExpressionCompiler::Compile(source, inputs, outputs);
+        if (!compilation.program)
+        {
+            m_errors.add(fmt::format("Can't create expression node '{}': {}!", name, compilation.errorMessage));
+            return nullptr;
+        }
+
+        return m_apiObjects.createExpressionNode(source, inputs, outputs, std::move(*compilation.program), name);
+    }
+
     bool LogicEngineImpl::destroy(LogicNode& logicNode)
     {
         m_errors.clear();
+        m_changedOutputs.clear();
+        discardQueuedInputValues();
+        for (InputChannel& inputChannel : m_inputChannels)
+        {
+            inputChannel.removeFieldsOf(logicNode.m_impl);
+        }
+        const LogicNodeImpl& logicNodeImpl = logicNode.m_impl;
+        m_snapshotOutputs.erase(std::remove_if(m_snapshotOutputs.begin(), m_snapshotOutputs.end(),
+            [&logicNodeImpl](const Property* output) { return &output->m_impl->getLogicNode() == &logicNodeImpl; }), m_snapshotOutputs.end());
+        m_outputSnapshotContentGeneration->fetch_add(1u, std::memory_order_release);
+        m_subgraphs.remove(logicNode.m_impl);
         return m_apiObjects.destroy(logicNode, m_errors);
     }
 
@@ -87,6 +190,7 @@ namespace rlogic::internal
     void LogicEngineImpl::updateLinksRecursive(Property& inputProperty)
     {
         // TODO Violin consider providing property iterator - seems it's needed quite often, would make access more convenient also for users
+        const LinksMap& links = m_apiObjects.getLogicNodeDependencies().getLinks();
         const auto inputCount = inputProperty.getChildCount();
         for (size_t i = 0; i < inputCount; ++i)
         {
@@ -94,14 +198,61 @@ namespace rlogic::internal
 
             if (TypeUtils::CanHaveChildren(child.getType()))
             {
-                updateLinksRecursive(child);
+                const auto complexLink = links.find(child.m_impl.get());
+                if (complexLink == links.end())
+                {
+                    updateLinksRecursive(child);
+                    continue;
+                }
+
+                // Linked structs and arrays are copied in one loop over their flattened children
+                for (const auto& leaf : complexLink->second.leaves)
+                {
+                    const uint64_t sourceVersion = leaf.source->getChangeVersion();
+                    if (sourceVersion != leaf.propagatedVersion)
+                    {
+                        leaf.target->setValue(leaf.source->getValue(), true);
+                        leaf.propagatedVersion = sourceVersion;
+                    }
+                }
             }
             else
             {
-                const PropertyImpl* output = m_apiObjects.getLogicNodeDependencies().getLinkedOutput(*child.m_impl);
-                if (nullptr != output)
+                const auto [linksBegin, linksEnd] = links.equal_range(child.m_impl.get());
+                if (linksBegin == linksEnd)
+                {
+                    continue;
+                }
+
+                // Sources which were not written since the last propagation are skipped without reading their value
+                bool sourceChanged = false;
+                for (auto iter = linksBegin; iter != linksEnd; ++iter)
+                {
+                    sourceChanged = sourceChanged || (iter->second.source->getChangeVersion() != iter->second.propagatedVersion);
+                }
+                if (!sourceChanged)
+                {
+                    continue;
+                }
+
+                if (linksBegin->second.kind == ELinkKind::Direct)
+                {
+                    child.m_impl->setValue(linksBegin->second.source->getValue(), true);
+                }
+                else
+                {
+                    // Component links only overwrite their own component, the others keep their current value
+                    PropertyValue value = child.m_impl->getValue();
+                    for (auto iter = linksBegin; iter != linksEnd; ++iter)
+                    {
+                        LinkConversion::Apply(iter->second, value);
+                    }
+                    child.m_impl->setValue(std::move(value), true);
+                }
+
+                for (auto iter = linksBegin; iter != linksEnd; ++iter)
                 {
-                    child.m_impl->setValue(output->getValue(), true);
+                    iter->second.propagatedVersion = iter->second.source->getChangeVersion();
                 }
             }
         }
@@ -110,8 +261,290 @@ namespace rlogic::internal
     bool LogicEngineImpl::update(bool disableDirtyTracking)
     {
         m_errors.clear();
+        m_changedOutputs.clear();
+        ++m_updateCounter;
+        m_updateTime = m_updateClock ? m_updateClock() : std::chrono::steady_clock::now();
         LOG_DEBUG("Begin update");
 
+        applyQueuedInputValues();
+        for (InputChannel& inputChannel : m_inputChannels)
+        {
+            // If the writer is too busy, the channel is read again in the next update
+            (void)inputChannel.apply();
+        }
+
+        const bool success = updateNodes(disableDirtyTracking);
+
+        // Collect garbage at a fixed point of the frame (also when a script failed, it might fail in every frame)
+        if (m_garbageCollectionStepSizeKB != 0u)
+        {
+            m_luaState->collectGarbage(m_garbageCollectionStepSizeKB);
+        }
+
+        // Outputs of a failed update can be partially updated, readers keep seeing the last complete snapshot
+        if (success && !m_snapshotOutputs.empty())
+        {
+            if (!m_outputSnapshots->publish(m_updateCounter, m_snapshotOutputs))
+            {
+                LOG_DEBUG("Skip publishing output snapshot because all snapshot buffers are being read");
+            }
+        }
+
+        return success;
+    }
+
+    void LogicEngineImpl::applyQueuedInputValues()
+    {
+        PropertyImpl* property = nullptr;
+        PropertyValue value;
+        // Only the last queued value of each property is set, producers which queue faster than the update rate
+        // don't cause redundant sets (and version changes) of the same property
+        while (m_inputValueQueue->pop(property, value))
+        {
+            const auto [index, inserted] = m_coalescedInputValueIndices.try_emplace(property, m_coalescedInputValues.size());
+            if (inserted)
+            {
+                m_coalescedInputValues.emplace_back(property, std::move(value));
+            }
+            else
+            {
+                m_coalescedInputValues[index->second].second = std::move(value);
+            }
+        }
+
+        for (auto& [coalescedProperty, coalescedValue] : m_coalescedInputValues)
+        {
+            // Same checks and logs as Property::set, the property could have been linked after the value was queued
+            (void)coalescedProperty->setValue_PublicApi(std::move(coalescedValue));
+        }
+        m_coalescedInputValues.clear();
+        m_coalescedInputValueIndices.clear();
+    }
+
+    void LogicEngineImpl::discardQueuedInputValues()
+    {
+        PropertyImpl* property = nullptr;
+        PropertyValue value;
+        while (m_inputValueQueue->pop(property, value))
+        {
+        }
+    }
+
+    bool LogicEngineImpl::enqueueInputValue(const Property& input, EPropertyType type, PropertyValue value)
+    {
+        // Only checks what can't change after the property was created, so that other threads can call it safely
+        if (!input.m_impl->isInput() || input.m_impl->getType() != type)
+        {
+            return false;
+        }
+
+        return m_inputValueQueue->push(*input.m_impl, std::move(value));
+    }
+
+    void LogicEngineImpl::setInputQueueCapacity(size_t capacity)
+    {
+        m_inputValueQueue = std::make_unique<InputValueQueue>(capacity);
+    }
+
+    bool LogicEngineImpl::attachInputChannel(const void* memory, size_t size, const InputChannelLayout& layout)
+    {
+        m_errors.clear();
+
+        if (memory == nullptr || size < InputChannel::WordSize)
+        {
+            m_errors.add("Can't attach input channel: the memory block must at least contain the sequence counter (4 bytes)");
+            return false;
+        }
+
+        if (reinterpret_cast<uintptr_t>(memory) % InputChannel::WordSize != 0u)
+        {
+            m_errors.add("Can't attach input channel: the memory block must be aligned to 4 bytes");
+            return false;
+        }
+
+        const auto channelWithSameMemory = std::find_if(m_inputChannels.cbegin(), m_inputChannels.cend(),
+            [memory](const InputChannel& inputChannel) { return inputChannel.getMemory() == memory; });
+        if (channelWithSameMemory != m_inputChannels.cend())
+        {
+            m_errors.add("Can't attach input channel: the memory block is already attached");
+            return false;
+        }
+
+        std::vector<InputChannel::Field> fields;
+        fields.reserve(layout.size());
+        for (const InputChannelField& field : layout)
+        {
+            if (field.input == nullptr || !field.input->m_impl->isInput())
+            {
+                m_errors.add(fmt::format("Can't attach input channel: field at offset {} doesn't refer to an input property", field.offset));
+                return false;
+            }
+
+            PropertyImpl& input = *field.input->m_impl;
+            if (m_apiObjects.getReverseImplMapping().find(&input.getLogicNode()) == m_apiObjects.getReverseImplMapping().end())
+            {
+                m_errors.add(fmt::format("LogicNode '{}' is not an instance of this LogicEngine", input.getLogicNode().getName()));
+                return false;
+            }
+
+            const size_t wordCount = LinkConversion::GetComponentCount(input.getType());
+            if (wordCount == 0u)
+            {
+                m_errors.add(fmt::format("Can't attach input channel: property '{}' has unsupported type '{}' (only numbers, booleans and numeric vectors are supported)",
+                    input.getName(), GetLuaPrimitiveTypeName(input.getType())));
+                return false;
+            }
+
+            if (field.offset % InputChannel::WordSize != 0u)
+            {
+                m_errors.add(fmt::format("Can't attach input channel: offset {} of property '{}' is not aligned to 4 bytes", field.offset, input.getName()));
+                return false;
+            }
+
+            const size_t firstWord = field.offset / InputChannel::WordSize;
+            if (firstWord == 0u || (firstWord + wordCount) * InputChannel::WordSize > size)
+            {
+                m_errors.add(fmt::format("Can't attach input channel: value of property '{}' at offset {} overlaps the sequence counter or exceeds the memory block of {} bytes",
+                    input.getName(), field.offset, size));
+                return false;
+            }
+
+            fields.push_back(InputChannel::Field{firstWord, wordCount, field.input->m_impl.get()});
+        }
+
+        m_inputChannels.emplace_back(memory, size, std::move(fields));
+        return true;
+    }
+
+    bool LogicEngineImpl::detachInputChannel(const void* memory)
+    {
+        m_errors.clear();
+
+        const auto inputChannel = std::find_if(m_inputChannels.cbegin(), m_inputChannels.cend(),
+            [memory](const InputChannel& channel) { return channel.getMemory() == memory; });
+        if (inputChannel == m_inputChannels.cend())
+        {
+            m_errors.add("Can't detach input channel: the memory block is not attached");
+            return false;
+        }
+
+        m_inputChannels.erase(inputChannel);
+        return true;
+    }
+
+    void LogicEngineImpl::setUpdateClock(std::function<std::chrono::steady_clock::time_point()> clock)
+    {
+        m_updateClock = std::move(clock);
+    }
+
+    uint64_t LogicEngineImpl::getUpdateCounter() const
+    {
+        return m_updateCounter;
+    }
+
+    void LogicEngineImpl::SetSnapshotOutputsRecursive(const Property& output, bool published, std::vector<const Property*>& snapshotOutputs)
+    {
+        if (TypeUtils::CanHaveChildren(output.getType()))
+        {
+            for (size_t i = 0; i < output.getChildCount(); ++i)
+            {
+                SetSnapshotOutputsRecursive(*output.getChild(i), published, snapshotOutputs);
+            }
+            return;
+        }
+
+        const auto iter = std::lower_bound(snapshotOutputs.begin(), snapshotOutputs.end(), &output, std::less<>());
+        const bool isPublished = (iter != snapshotOutputs.end() && *iter == &output);
+        if (published && !isPublished)
+        {
+            snapshotOutputs.insert(iter, &output);
+        }
+        else if (!published && isPublished)
+        {
+            snapshotOutputs.erase(iter);
+        }
+    }
+
+    bool LogicEngineImpl::addOutputToSnapshot(const Property& output)
+    {
+        m_errors.clear();
+        if (!output.m_impl->isOutput())
+        {
+            m_errors.add(fmt::format("Can't add property '{}' to output snapshots, only outputs of logic nodes can be published", output.getName()));
+            return false;
+        }
+        if (!checkLogicNodeOfThisEngine(output.m_impl->getLogicNode()))
+        {
+            return false;
+        }
+
+        SetSnapshotOutputsRecursive(output, true, m_snapshotOutputs);
+        return true;
+    }
+
+    bool LogicEngineImpl::removeOutputFromSnapshot(const Property& output)
+    {
+        m_errors.clear();
+        if (!output.m_impl->isOutput())
+        {
+            m_errors.add(fmt::format("Can't remove property '{}' from output snapshots, only outputs of logic nodes can be published", output.getName()));
+            return false;
+        }
+        if (!checkLogicNodeOfThisEngine(output.m_impl->getLogicNode()))
+        {
+            return false;
+        }
+
+        SetSnapshotOutputsRecursive(output, false, m_snapshotOutputs);
+        return true;
+    }
+
+    void LogicEngineImpl::setOutputSnapshotBufferCount(size_t bufferCount)
+    {
+        m_outputSnapshots = std::make_unique<OutputSnapshotBuffer>(bufferCount, m_outputSnapshotContentGeneration);
+    }
+
+    bool LogicEngineImpl::readOutputSnapshot(OutputSnapshot& snapshot) const
+    {
+        return m_outputSnapshots->read(*snapshot.m_impl);
+    }
+
+    bool LogicEngineImpl::setSubgraph(LogicNode& logicNode, std::string_view subgraph)
+    {
+        m_errors.clear();
+        if (!checkLogicNodeOfThisEngine(logicNode.m_impl))
+        {
+            return false;
+        }
+
+        m_subgraphs.add(logicNode.m_impl, subgraph);
+        return true;
+    }
+
+    std::string_view LogicEngineImpl::getSubgraph(const LogicNode& logicNode) const
+    {
+        return m_subgraphs.getSubgraphOf(logicNode.m_impl);
+    }
+
+    bool LogicEngineImpl::setSubgraphSuspended(std::string_view subgraph, bool suspended)
+    {
+        m_errors.clear();
+        if (!m_subgraphs.setSuspended(subgraph, suspended))
+        {
+            m_errors.add(fmt::format("Can't {} subgraph '{}' because it doesn't exist, add logic nodes to it with setSubgraph() first",
+                suspended ? "suspend" : "resume", subgraph));
+            return false;
+        }
+        return true;
+    }
+
+    bool LogicEngineImpl::isSubgraphSuspended(std::string_view subgraph) const
+    {
+        return m_subgraphs.isSuspended(subgraph).value_or(false);
+    }
+
+    bool LogicEngineImpl::updateNodes(bool disableDirtyTracking)
+    {
         const std::optional<NodeVector> sortedNodes = m_apiObjects.getLogicNodeDependencies().getTopologicallySortedNodes();
         if (!sortedNodes)
         {
@@ -121,6 +554,12 @@ namespace rlogic::internal
 
         for (LogicNodeImpl* logicNode : *sortedNodes)
         {
+            // Suspended nodes stay dirty and their links keep their propagated versions, so that they catch up when resumed
+            if (logicNode->isSuspended())
+            {
+                continue;
+            }
+
             if (!updateLogicNodeInternal(*logicNode, disableDirtyTracking))
             {
                 return false;
@@ -132,11 +571,37 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::updateLogicNodeInternal(LogicNodeImpl& node, bool disableDirtyTracking)
     {
+        // Links are propagated also when the node is not due, so that it sees the latest values when it's executed
         updateLinksRecursive(*node.getInputs());
-        if (disableDirtyTracking || node.isDirty())
+        const bool needsUpdate = disableDirtyTracking || node.isDirty();
+        if (needsUpdate && !node.isUpdateDue(m_updateCounter, m_updateTime))
+        {
+            // Stays dirty until its update interval has passed, its outputs keep their values until then
+            LOG_DEBUG("Defer update of LogicNode '{}' because its update interval has not passed yet", node.getName());
+            return true;
+        }
+
+        if (needsUpdate)
         {
             LOG_DEBUG("Updating LogicNode '{}'", node.getName());
+            // Outputs only change while their node is updated, so only the outputs of updated nodes have to be checked
+            const Property* outputs = node.getOutputs();
+            const bool trackOutputChanges = (outputs != nullptr) && (m_trackAllOutputChanges || m_hasOutputChangeSubscriptions);
+            if (trackOutputChanges)
+            {
+                m_outputVersionsBeforeUpdate.clear();
+                captureOutputVersionsRecursive(*outputs);
+            }
+
             const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+            node.setLastUpdate(m_updateCounter, m_updateTime);
+
+            if (trackOutputChanges)
+            {
+                size_t versionIndex = 0u;
+                collectChangedOutputsRecursive(*outputs, versionIndex);
+            }
+
             if (potentialError)
             {
                 m_errors.add(potentialError->message, *m_apiObjects.getApiObject(node));
@@ -151,6 +616,116 @@ namespace rlogic::internal
         return true;
     }
 
+    bool LogicEngineImpl::isOutputChangeTracked(const PropertyImpl& output) const
+    {
+        return m_trackAllOutputChanges || output.isOutputChangesSubscribed();
+    }
+
+    void LogicEngineImpl::captureOutputVersionsRecursive(const Property& outputProperty)
+    {
+        const auto outputCount = outputProperty.getChildCount();
+        for (size_t i = 0; i < outputCount; ++i)
+        {
+            const Property& child = *outputProperty.getChild(i);
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                captureOutputVersionsRecursive(child);
+            }
+            else if (isOutputChangeTracked(*child.m_impl))
+            {
+                m_outputVersionsBeforeUpdate.push_back(child.m_impl->getChangeVersion());
+            }
+        }
+    }
+
+    void LogicEngineImpl::collectChangedOutputsRecursive(const Property& outputProperty, size_t& versionIndex)
+    {
+        const auto outputCount = outputProperty.getChildCount();
+        for (size_t i = 0; i < outputCount; ++i)
+        {
+            const Property& child = *outputProperty.getChild(i);
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                collectChangedOutputsRecursive(child, versionIndex);
+            }
+            else if (isOutputChangeTracked(*child.m_impl))
+            {
+                assert(versionIndex < m_outputVersionsBeforeUpdate.size());
+                if (child.m_impl->getChangeVersion() != m_outputVersionsBeforeUpdate[versionIndex])
+                {
+                    m_changedOutputs.push_back(&child);
+                }
+                ++versionIndex;
+            }
+        }
+    }
+
+    void LogicEngineImpl::setOutputChangeTracking(bool enabled)
+    {
+        m_trackAllOutputChanges = enabled;
+    }
+
+    bool LogicEngineImpl::checkOutputOfThisEngine(const Property& output, std::string_view action)
+    {
+        if (!output.m_impl->isOutput())
+        {
+            m_errors.add(fmt::format("Can't {} changes of property '{}', only outputs of logic nodes can be subscribed", action, output.getName()));
+            return false;
+        }
+
+        return checkLogicNodeOfThisEngine(output.m_impl->getLogicNode());
+    }
+
+    bool LogicEngineImpl::checkLogicNodeOfThisEngine(LogicNodeImpl& logicNode)
+    {
+        if (m_apiObjects.getReverseImplMapping().find(&logicNode) == m_apiObjects.getReverseImplMapping().end())
+        {
+            m_errors.add(fmt::format("LogicNode '{}' is not an instance of this LogicEngine", logicNode.getName()));
+            return false;
+        }
+
+        return true;
+    }
+
+    void LogicEngineImpl::SetOutputChangesSubscribedRecursive(PropertyImpl& output, bool subscribed)
+    {
+        output.setOutputChangesSubscribed(subscribed);
+        for (size_t i = 0; i < output.getChildCount(); ++i)
+        {
+            SetOutputChangesSubscribedRecursive(*output.getChild(i)->m_impl, subscribed);
+        }
+    }
+
+    bool LogicEngineImpl::subscribeToOutputChanges(const Property& output)
+    {
+        m_errors.clear();
+        if (!checkOutputOfThisEngine(output, "subscribe to"))
+        {
+            return false;
+        }
+
+        SetOutputChangesSubscribedRecursive(*output.m_impl, true);
+        m_hasOutputChangeSubscriptions = true;
+        return true;
+    }
+
+    bool LogicEngineImpl::unsubscribeFromOutputChanges(const Property& output)
+    {
+        m_errors.clear();
+        if (!checkOutputOfThisEngine(output, "unsubscribe from"))
+        {
+            return false;
+        }
+
+        SetOutputChangesSubscribedRecursive(*output.m_impl, false);
+        return true;
+    }
+
+    const std::vector<const Property*>& LogicEngineImpl::getChangedOutputs() const
+    {
+        return m_changedOutputs;
+    }
+
     const std::vector<ErrorData>& LogicEngineImpl::getErrors() const
     {
         return m_errors.getErrors();
@@ -179,22 +754,213 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
     {
-        std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(std::string(filename));
-        if (!maybeBytesFromFile)
+        m_errors.clear();
+
+        LoadedContent loadedContent;
+        loadedContent.deferScriptCompilation = m_lazyScriptCompilation;
+        loadedContent.luaMemoryLimit = m_luaMemoryLimit;
+        loadedContent.nativeLogicNodeTypes = m_nativeLogicNodeTypes;
+        LoadFromFile(std::string(filename), scene, enableMemoryVerification, loadedContent);
+        return setLoadedContent(loadedContent);
+    }
+
+    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription)
+    {
+        m_errors.clear();
+
+        LoadedContent loadedContent;
+        loadedContent.deferScriptCompilation = m_lazyScriptCompilation;
+        loadedContent.luaMemoryLimit = m_luaMemoryLimit;
+        loadedContent.nativeLogicNodeTypes = m_nativeLogicNodeTypes;
+        LoadFromByteData(byteData, byteSize, scene, enableMemoryVerification, dataSourceDescription, loadedContent);
+        return setLoadedContent(loadedContent);
+    }
+
+    void LogicEngineImpl::setLuaMemoryLimit(size_t memoryLimit)
+    {
+        m_luaMemoryLimit = memoryLimit;
+        m_luaState->getAllocator().setMemoryLimit(memoryLimit);
+    }
+
+    LuaMemoryStatistics LogicEngineImpl::getLuaMemoryStatistics() const
+    {
+        return m_luaState->getMemoryStatistics();
+    }
+
+    void LogicEngineImpl::setGarbageCollectionStep(size_t stepSizeKB)
+    {
+        m_garbageCollectionStepSizeKB = stepSizeKB;
+    }
+
+    bool LogicEngineImpl::collectGarbage(size_t stepSizeKB)
+    {
+        return m_luaState->collectGarbage(stepSizeKB);
+    }
+
+    void LogicEngineImpl::setLazyScriptCompilation(bool enabled)
+    {
+        m_lazyScriptCompilation = enabled;
+    }
+
+    bool LogicEngineImpl::prewarm(size_t maxScriptCount)
+    {
+        m_errors.clear();
+
+        size_t compiledScripts = 0u;
+        for (auto& script : m_apiObjects.getScripts())
+        {
+            if (compiledScripts == maxScriptCount)
+            {
+                break;
+            }
+
+            LuaScriptImpl& scriptImpl = *script->m_script;
+            if (scriptImpl.isCompiled())
+            {
+                continue;
+            }
+
+            ++compiledScripts;
+            const std::optional<std::string> compileError = scriptImpl.compile();
+            if (compileError)
+            {
+                m_errors.add(*compileError, *script);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t LogicEngineImpl::getUncompiledScriptCount() const
+    {
+        const auto& scripts = m_apiObjects.getScripts();
+        return static_cast<size_t>(std::count_if(scripts.cbegin(), scripts.cend(), [](const auto& script) { return !script->m_script->isCompiled(); }));
+    }
+
+    std::future<bool> LogicEngineImpl::loadFromFileAsync(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
+    {
+        return startAsyncLoad(
+            [filenameCopy = std::string(filename), scene, enableMemoryVerification](LoadedContent& loadedContent)
+            {
+                LoadFromFile(filenameCopy, scene, enableMemoryVerification, loadedContent);
+            });
+    }
+
+    std::future<bool> LogicEngineImpl::loadFromBufferAsync(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification)
+    {
+        // The caller is free to release the buffer after this call returns, thus the loader works on its own copy
+        const auto* bytes = static_cast<const char*>(rawBuffer);
+        std::string dataSourceDescription = fmt::format("data buffer '{}' (size: {})", rawBuffer, bufferSize);
+        return startAsyncLoad(
+            [bufferCopy = std::vector<char>(bytes, bytes + bufferSize), dataSourceDescription = std::move(dataSourceDescription), scene, enableMemoryVerification](LoadedContent& loadedContent)
+            {
+                LoadFromByteData(bufferCopy.data(), bufferCopy.size(), scene, enableMemoryVerification, dataSourceDescription, loadedContent);
+            });
+    }
+
+    std::future<bool> LogicEngineImpl::startAsyncLoad(std::function<void(LoadedContent&)> loadFunction)
+    {
+        m_errors.clear();
+
+        std::promise<bool> loadResult;
+        std::future<bool> futureLoadResult = loadResult.get_future();
+
+        if (m_stagedContent)
+        {
+            m_errors.add("Can't start loading asynchronously while a previous asynchronous load was not committed yet! Call commitAsyncLoad() first!");
+            loadResult.set_value(false);
+            return futureLoadResult;
+        }
+
+        m_stagedContent = std::make_shared<LoadedContent>();
+        m_stagedContent->deferScriptCompilation = m_lazyScriptCompilation;
+        m_stagedContent->luaMemoryLimit = m_luaMemoryLimit;
+        m_stagedContent->nativeLogicNodeTypes = m_nativeLogicNodeTypes;
+        m_stagedContentLoader = std::thread(
+            [stagedContent = m_stagedContent, loadFunction = std::move(loadFunction), loadResult = std::move(loadResult)]() mutable
+            {
+                loadFunction(*stagedContent);
+                // Set the flag before fulfilling the promise, so that a ready future guarantees that commitAsyncLoad() succeeds
+                stagedContent->finished = true;
+                loadResult.set_value(stagedContent->errors.getErrors().empty());
+            });
+
+        return futureLoadResult;
+    }
+
+    bool LogicEngineImpl::commitAsyncLoad()
+    {
+        m_errors.clear();
+
+        if (!m_stagedContent)
+        {
+            m_errors.add("Can't commit asynchronously loaded content, no asynchronous load was started!");
+            return false;
+        }
+
+        if (!m_stagedContent->finished)
+        {
+            m_errors.add("Can't commit asynchronously loaded content, loading is still in progress!");
+            return false;
+        }
+
+        // The thread has already finished its work, joining does not block
+        m_stagedContentLoader.join();
+
+        std::shared_ptr<LoadedContent> stagedContent = std::move(m_stagedContent);
+        return setLoadedContent(*stagedContent);
+    }
+
+    bool LogicEngineImpl::isAsyncLoadPending() const
+    {
+        return m_stagedContent != nullptr;
+    }
+
+    bool LogicEngineImpl::setLoadedContent(LoadedContent& loadedContent)
+    {
+        if (!loadedContent.apiObjects)
         {
-            m_errors.add(fmt::format("Failed to load file '{}'", filename));
+            // Errors were already logged by the loader, don't report them twice
+            m_errors = std::move(loadedContent.errors);
             return false;
         }
 
+        // Objects are replaced before the Lua state which they were created in, so that
+        // the old scripts are destroyed while their Lua state is still alive
+        m_changedOutputs.clear();
+        discardQueuedInputValues();
+        m_inputChannels.clear();
+        m_snapshotOutputs.clear();
+        m_outputSnapshotContentGeneration->fetch_add(1u, std::memory_order_release);
+        m_subgraphs.clear();
+        m_apiObjects = std::move(*loadedContent.apiObjects);
+        loadedContent.apiObjects.reset();
+        std::swap(m_luaState, loadedContent.luaState);
+        // The limit could have been changed while loading asynchronously
+        m_luaState->getAllocator().setMemoryLimit(m_luaMemoryLimit);
+        return true;
+    }
+
+    void LogicEngineImpl::LoadFromFile(const std::string& filename, ramses::Scene* scene, bool enableMemoryVerification, LoadedContent& loadedContent)
+    {
+        std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(filename);
+        if (!maybeBytesFromFile)
+        {
+            loadedContent.errors.add(fmt::format("Failed to load file '{}'", filename));
+            return;
+        }
+
         const size_t fileSize = (*maybeBytesFromFile).size();
-        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize));
+        LoadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize), loadedContent);
     }
 
-    // TODO Violin consider handling errors gracefully, e.g. don't change state when error occurs
-    // Idea: collect data, and only move() in the end when everything was loaded correctly
-    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription)
+    // Loads everything into a fresh Lua state and fresh API objects, so that failing to load
+    // leaves the current engine content untouched. Doesn't access any state of the engine and
+    // can thus be executed on a different thread
+    void LogicEngineImpl::LoadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription, LoadedContent& loadedContent)
     {
-        m_errors.clear();
+        ErrorReporting& errors = loadedContent.errors;
 
         if (enableMemoryVerification)
         {
@@ -203,8 +969,8 @@ namespace rlogic::internal
 
             if (!bufferOK)
             {
-                m_errors.add(fmt::format("{} contains corrupted data!", dataSourceDescription));
-                return false;
+                errors.add(fmt::format("{} contains corrupted data!", dataSourceDescription));
+                return;
             }
         }
 
@@ -212,64 +978,53 @@ namespace rlogic::internal
 
         if (nullptr == logicEngine)
         {
-            m_errors.add(fmt::format("{} doesn't contain logic engine data with readable version specifiers", dataSourceDescription));
-            return false;
+            errors.add(fmt::format("{} doesn't contain logic engine data with readable version specifiers", dataSourceDescription));
+            return;
         }
 
         const auto& ramsesVersion = *logicEngine->ramsesVersion();
         if (!CheckRamsesVersionFromFile(ramsesVersion))
         {
-            m_errors.add(fmt::format("Version mismatch while loading {}! Expected Ramses version {}.x.x but found {}",
+            errors.add(fmt::format("Version mismatch while loading {}! Expected Ramses version {}.x.x but found {}",
                 dataSourceDescription, ramses::GetRamsesVersion().major,
                 ramsesVersion.v_string()->string_view()));
-            return false;
+            return;
         }
 
         const auto& rlogicVersion = *logicEngine->rlogicVersion();
         if (!CheckLogicVersionFromFile(rlogicVersion))
         {
-            m_errors.add(fmt::format("Version mismatch while loading {}! Expected version {}.{}.x but found {}",
+            errors.add(fmt::format("Version mismatch while loading {}! Expected version {}.{}.x but found {}",
                 dataSourceDescription, g_PROJECT_VERSION_MAJOR, g_PROJECT_VERSION_MINOR,
                 rlogicVersion.v_string()->string_view()));
-            return false;
+            return;
         }
 
         if (nullptr == logicEngine->apiObjects())
         {
-            m_errors.add(fmt::format("Fatal error while loading {}: doesn't contain API objects!", dataSourceDescription));
-            return false;
-        }
-
-        RamsesObjectResolver ramsesResolver(m_errors, scene);
-
-        // TODO Violin also use fresh Lua environment, so that we don't pollute current one when loading failed
-        std::optional<ApiObjects> deserializedObjects = ApiObjects::Deserialize(m_luaState, *logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, m_errors);
-
-        if (!deserializedObjects)
-        {
-            return false;
+            errors.add(fmt::format("Fatal error while loading {}: doesn't contain API objects!", dataSourceDescription));
+            return;
         }
 
-        // No errors -> move data into member
-        m_apiObjects = std::move(*deserializedObjects);
+        RamsesObjectResolver ramsesResolver(errors, scene);
 
-        return true;
+        loadedContent.luaState = std::make_unique<SolState>(loadedContent.luaMemoryLimit);
+        loadedContent.apiObjects = ApiObjects::Deserialize(*loadedContent.luaState, *logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, errors,
+            loadedContent.deferScriptCompilation, loadedContent.nativeLogicNodeTypes);
     }
 
-    bool LogicEngineImpl::saveToFile(std::string_view filename)
+    bool LogicEngineImpl::serialize(std::string_view saveFunctionName, std::string_view saveTarget)
     {
-        m_errors.clear();
-
         if (!m_apiObjects.checkBindingsReferToSameRamsesScene(m_errors))
         {
-            m_errors.add("Can't save a logic engine to file while it has references to more than one Ramses scene!");
+            m_errors.add(fmt::format("Can't save a logic engine to {} while it has references to more than one Ramses scene!", saveTarget));
             return false;
         }
 
         // Refuse save() if logic graph has loops
         if (!m_apiObjects.getLogicNodeDependencies().getTopologicallySortedNodes())
         {
-            m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling saveToFile()!");
+            m_errors.add(fmt::format("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling {}()!", saveFunctionName));
             return false;
         }
 
@@ -278,7 +1033,15 @@ namespace rlogic::internal
             LOG_WARN("Saving logic engine content with manually updated binding values without calling update() will result in those values being lost!");
         }
 
-        flatbuffers::FlatBufferBuilder builder;
+        if (!m_flatBufferBuilder)
+        {
+            m_flatBufferBuilder = std::make_unique<flatbuffers::FlatBufferBuilder>(estimateSerializedSize());
+        }
+
+        // Keeps the memory allocated by previous saves
+        flatbuffers::FlatBufferBuilder& builder = *m_flatBufferBuilder;
+        builder.Clear();
+
         ramses::RamsesVersion ramsesVersion = ramses::GetRamsesVersion();
 
         const auto ramsesVersionOffset = rlogic_serialization::CreateVersion(builder,
@@ -301,7 +1064,20 @@ namespace rlogic::internal
             ApiObjects::Serialize(m_apiObjects, builder));
         builder.Finish(logicEngine);
 
-        if (!FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize()))
+        m_lastSerializedSize = builder.GetSize();
+        return true;
+    }
+
+    bool LogicEngineImpl::saveToFile(std::string_view filename)
+    {
+        m_errors.clear();
+
+        if (!serialize("saveToFile", "file"))
+        {
+            return false;
+        }
+
+        if (!FileUtils::SaveBinary(std::string(filename), m_flatBufferBuilder->GetBufferPointer(), m_flatBufferBuilder->GetSize()))
         {
             m_errors.add(fmt::format("Failed to save content to path '{}'!", filename));
             return false;
@@ -310,6 +1086,101 @@ namespace rlogic::internal
         return true;
     }
 
+    bool LogicEngineImpl::saveToBuffer(void* buffer, size_t bufferSize, size_t& bytesWritten)
+    {
+        m_errors.clear();
+        bytesWritten = 0u;
+
+        if (!serialize("saveToBuffer", "buffer"))
+        {
+            return false;
+        }
+
+        const size_t serializedSize = m_flatBufferBuilder->GetSize();
+        if (nullptr == buffer || bufferSize < serializedSize)
+        {
+            m_errors.add(fmt::format("Can't save content to buffer with size {}, it requires {} bytes!", bufferSize, serializedSize));
+            return false;
+        }
+
+        std::memcpy(buffer, m_flatBufferBuilder->GetBufferPointer(), serializedSize);
+        bytesWritten = serializedSize;
+        return true;
+    }
+
+    bool LogicEngineImpl::saveToBuffer(std::vector<uint8_t>& buffer)
+    {
+        m_errors.clear();
+
+        if (!serialize("saveToBuffer", "buffer"))
+        {
+            return false;
+        }
+
+        // assign() reuses the capacity of the vector if it is sufficient
+        const uint8_t* serializedData = m_flatBufferBuilder->GetBufferPointer();
+        buffer.assign(serializedData, serializedData + m_flatBufferBuilder->GetSize());
+        return true;
+    }
+
+    size_t LogicEngineImpl::estimateSerializedSize() const
+    {
+        if (m_lastSerializedSize != 0u)
+        {
+            return m_lastSerializedSize;
+        }
+
+        // Rough guess based on the content, real size depends on the flatbuffers alignment and on the contained strings
+        size_t estimatedSize = 256u;
+        for (const auto& apiObject : m_apiObjects.getReverseImplMapping())
+        {
+            const LogicNodeImpl& logicNode = *apiObject.first;
+            estimatedSize += 64u + logicNode.getName().size();
+            if (logicNode.getInputs() != nullptr)
+            {
+                estimatedSize += EstimateSerializedPropertySize(*logicNode.getInputs()->m_impl);
+            }
+            if (logicNode.getOutputs() != nullptr)
+            {
+                estimatedSize += EstimateSerializedPropertySize(*logicNode.getOutputs()->m_impl);
+            }
+            if (const auto* luaScript = dynamic_cast<const LuaScriptImpl*>(&logicNode))
+            {
+                estimatedSize += luaScript->getSourceCode().size() + luaScript->getFilename().size();
+            }
+        }
+        estimatedSize += 32u * m_apiObjects.getLogicNodeDependencies().getLinks().size();
+
+        return estimatedSize;
+    }
+
+    size_t LogicEngineImpl::EstimateSerializedPropertySize(const PropertyImpl& property)
+    {
+        // Property record (16 bytes) plus up to 4 value components; names are stored in the shared string table
+        size_t estimatedSize = 32u + property.getName().size();
+        const size_t childCount = property.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            estimatedSize += EstimateSerializedPropertySize(*property.getChild(i)->m_impl);
+        }
+        return estimatedSize;
+    }
+
+    void LogicEngineImpl::takeValueSnapshot(std::vector<uint8_t>& snapshot) const
+    {
+        ValueSnapshot::Take(m_apiObjects, snapshot);
+    }
+
+    bool LogicEngineImpl::restoreValueSnapshot(const void* snapshotData, size_t snapshotSize)
+    {
+        m_errors.clear();
+        const bool success = ValueSnapshot::Restore(m_apiObjects, static_cast<const uint8_t*>(snapshotData), snapshotSize, m_errors);
+        // Restored inputs can differ from their sources, whose versions didn't change (e.g. when the snapshot was taken while
+        // a propagation was pending). Links must propagate again, otherwise they are skipped until their sources change
+        m_apiObjects.getLogicNodeDependencies().resetPropagatedLinkVersions();
+        return success;
+    }
+
     bool LogicEngineImpl::link(const Property& sourceProperty, const Property& targetProperty)
     {
         m_errors.clear();
@@ -317,6 +1188,20 @@ namespace rlogic::internal
         return m_apiObjects.getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, m_errors);
     }
 
+    bool LogicEngineImpl::linkWithConversion(const Property& sourceProperty, const Property& targetProperty)
+    {
+        m_errors.clear();
+
+        return m_apiObjects.getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, ELinkKind::Conversion, 0u, 0u, m_errors);
+    }
+
+    bool LogicEngineImpl::linkComponent(const Property& sourceProperty, size_t sourceComponent, const Property& targetProperty, size_t targetComponent)
+    {
+        m_errors.clear();
+
+        return m_apiObjects.getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, ELinkKind::Component, sourceComponent, targetComponent, m_errors);
+    }
+
     bool LogicEngineImpl::unlink(const Property& sourceProperty, const Property& targetProperty)
     {
         m_errors.clear();
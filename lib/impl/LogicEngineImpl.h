@@ -13,13 +13,28 @@
 #include "internals/LogicNodeDependencies.h"
 #include "internals/ErrorReporting.h"
 #include "internals/ApiObjects.h"
+#include "internals/InputValueQueue.h"
+#include "internals/InputChannel.h"
+#include "internals/OutputSnapshotBuffer.h"
+#include "internals/Subgraphs.h"
 
+#include "ramses-logic/LuaMemoryStatistics.h"
+#include "ramses-logic/InputChannel.h"
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 
+#include <chrono>
 #include <optional>
 #include <vector>
 #include <string>
 #include <string_view>
+#include <memory>
+#include <future>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
 
 namespace ramses
 {
@@ -35,9 +50,13 @@ namespace rlogic
     class RamsesNodeBinding;
     class RamsesAppearanceBinding;
     class RamsesCameraBinding;
+    class NativeLogicNode;
+    class AnimationNode;
+    class ExpressionNode;
     class LuaScript;
     class LogicNode;
     class Property;
+    class OutputSnapshot;
 }
 
 namespace rlogic_serialization
@@ -45,22 +64,28 @@ namespace rlogic_serialization
     struct Version;
 }
 
+namespace flatbuffers
+{
+    class FlatBufferBuilder;
+}
+
 namespace rlogic::internal
 {
     class LogicNodeImpl;
     class RamsesBindingImpl;
+    class PropertyImpl;
 
     class LogicEngineImpl
     {
     public:
-        // Move-able (noexcept); Not copy-able
+        // Not move-able and not copy-able (owns the thread of a pending asynchronous load)
 
         // can't be noexcept anymore because constructor of std::unordered_map can throw
-        LogicEngineImpl() = default;
-        ~LogicEngineImpl() noexcept = default;
+        LogicEngineImpl();
+        ~LogicEngineImpl() noexcept;
 
-        LogicEngineImpl(LogicEngineImpl&& other) noexcept = default;
-        LogicEngineImpl& operator=(LogicEngineImpl&& other) noexcept = default;
+        LogicEngineImpl(LogicEngineImpl&& other) noexcept = delete;
+        LogicEngineImpl& operator=(LogicEngineImpl&& other) noexcept = delete;
         LogicEngineImpl(const LogicEngineImpl& other)                = delete;
         LogicEngineImpl& operator=(const LogicEngineImpl& other) = delete;
 
@@ -70,6 +95,10 @@ namespace rlogic::internal
         RamsesNodeBinding* createRamsesNodeBinding(ramses::Node& ramsesNode, std::string_view name);
         RamsesAppearanceBinding* createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name);
         RamsesCameraBinding* createRamsesCameraBinding(ramses::Camera& ramsesCamera, std::string_view name);
+        bool registerNativeLogicNodeType(std::string_view typeName, NativeLogicNodeType type);
+        NativeLogicNode* createNativeLogicNode(std::string_view typeName, std::string_view name);
+        AnimationNode* createAnimationNode(const AnimationChannels& channels, std::string_view name);
+        ExpressionNode* createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, std::string_view name);
 
         bool destroy(LogicNode& logicNode);
 
@@ -79,27 +108,153 @@ namespace rlogic::internal
         bool loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification);
         bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
         bool saveToFile(std::string_view filename);
+        bool saveToBuffer(void* buffer, size_t bufferSize, size_t& bytesWritten);
+        bool saveToBuffer(std::vector<uint8_t>& buffer);
+        [[nodiscard]] size_t estimateSerializedSize() const;
+
+        void takeValueSnapshot(std::vector<uint8_t>& snapshot) const;
+        bool restoreValueSnapshot(const void* snapshotData, size_t snapshotSize);
+
+        void setLuaMemoryLimit(size_t memoryLimit);
+        [[nodiscard]] LuaMemoryStatistics getLuaMemoryStatistics() const;
+
+        void setGarbageCollectionStep(size_t stepSizeKB);
+        bool collectGarbage(size_t stepSizeKB);
+
+        void setLazyScriptCompilation(bool enabled);
+        bool prewarm(size_t maxScriptCount);
+        [[nodiscard]] size_t getUncompiledScriptCount() const;
+
+        std::future<bool> loadFromFileAsync(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification);
+        std::future<bool> loadFromBufferAsync(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
+        bool commitAsyncLoad();
+        [[nodiscard]] bool isAsyncLoadPending() const;
 
         bool link(const Property& sourceProperty, const Property& targetProperty);
+        bool linkWithConversion(const Property& sourceProperty, const Property& targetProperty);
+        bool linkComponent(const Property& sourceProperty, size_t sourceComponent, const Property& targetProperty, size_t targetComponent);
         bool unlink(const Property& sourceProperty, const Property& targetProperty);
 
         [[nodiscard]] bool isLinked(const LogicNode& logicNode) const;
 
+        void setOutputChangeTracking(bool enabled);
+        bool subscribeToOutputChanges(const Property& output);
+        bool unsubscribeFromOutputChanges(const Property& output);
+        [[nodiscard]] const std::vector<const Property*>& getChangedOutputs() const;
+
+        // Thread-safe
+        bool enqueueInputValue(const Property& input, EPropertyType type, PropertyValue value);
+        void setInputQueueCapacity(size_t capacity);
+
+        bool attachInputChannel(const void* memory, size_t size, const InputChannelLayout& layout);
+        bool detachInputChannel(const void* memory);
+
+        void setUpdateClock(std::function<std::chrono::steady_clock::time_point()> clock);
+
+        [[nodiscard]] uint64_t getUpdateCounter() const;
+        bool addOutputToSnapshot(const Property& output);
+        bool removeOutputFromSnapshot(const Property& output);
+        void setOutputSnapshotBufferCount(size_t bufferCount);
+        // Thread-safe
+        [[nodiscard]] bool readOutputSnapshot(OutputSnapshot& snapshot) const;
+
+        bool setSubgraph(LogicNode& logicNode, std::string_view subgraph);
+        [[nodiscard]] std::string_view getSubgraph(const LogicNode& logicNode) const;
+        bool setSubgraphSuspended(std::string_view subgraph, bool suspended);
+        [[nodiscard]] bool isSubgraphSuspended(std::string_view subgraph) const;
+
+        static constexpr size_t DefaultGarbageCollectionStepSizeKB = 64u;
+        static constexpr size_t DefaultInputQueueCapacity = 1024u;
+        static constexpr size_t DefaultOutputSnapshotBufferCount = 3u;
+
         [[nodiscard]] ApiObjects& getApiObjects();
         [[nodiscard]] const ApiObjects& getApiObjects() const;
 
     private:
-        SolState m_luaState;
+        // Result of loading data into a fresh Lua state, fully independent of the live engine content
+        struct LoadedContent
+        {
+            std::unique_ptr<SolState> luaState;
+            std::optional<ApiObjects> apiObjects;
+            ErrorReporting errors;
+            std::atomic<bool> finished = false;
+            bool deferScriptCompilation = false;
+            size_t luaMemoryLimit = 0u;
+            // Copied from the engine, so that loading on another thread doesn't access the engine
+            NativeLogicNodeTypes nativeLogicNodeTypes;
+        };
+
+        // The Lua state is held by pointer so that it can be swapped with a staged state without
+        // invalidating the references which scripts hold to it
+        std::unique_ptr<SolState> m_luaState;
         ApiObjects m_apiObjects;
         ErrorReporting m_errors;
+        NativeLogicNodeTypes m_nativeLogicNodeTypes;
+
+        std::shared_ptr<LoadedContent> m_stagedContent;
+        std::thread m_stagedContentLoader;
+
+        // Kept between save calls so that its memory is reused
+        std::unique_ptr<flatbuffers::FlatBufferBuilder> m_flatBufferBuilder;
+        size_t m_lastSerializedSize = 0u;
+
+        bool m_lazyScriptCompilation = false;
+        size_t m_luaMemoryLimit = 0u;
+        size_t m_garbageCollectionStepSizeKB = DefaultGarbageCollectionStepSizeKB;
 
+        bool m_trackAllOutputChanges = false;
+        bool m_hasOutputChangeSubscriptions = false;
+        // Both are cleared, but keep their memory between updates
+        std::vector<const Property*> m_changedOutputs;
+        std::vector<uint64_t> m_outputVersionsBeforeUpdate;
+
+        // Filled by other threads, see LogicEngine::enqueueInputValue
+        std::unique_ptr<InputValueQueue> m_inputValueQueue;
+        // Last queued value per property and its index in the list, cleared after each update but keep their memory
+        std::vector<std::pair<PropertyImpl*, PropertyValue>> m_coalescedInputValues;
+        std::unordered_map<PropertyImpl*, size_t> m_coalescedInputValueIndices;
+        // Memory blocks written by other threads or processes, see LogicEngine::attachInputChannel
+        std::vector<InputChannel> m_inputChannels;
+
+        uint64_t m_updateCounter = 0u;
+        // Read once per update for the update intervals of nodes, empty for std::chrono::steady_clock
+        std::function<std::chrono::steady_clock::time_point()> m_updateClock;
+        std::chrono::steady_clock::time_point m_updateTime;
+        // Primitive outputs published at the end of each update, sorted by address (see LogicEngine::addOutputToSnapshot)
+        std::vector<const Property*> m_snapshotOutputs;
+        // Changed whenever properties are destroyed, published snapshots are invalid afterwards (see OutputSnapshotImpl)
+        std::shared_ptr<std::atomic<uint64_t>> m_outputSnapshotContentGeneration = std::make_shared<std::atomic<uint64_t>>(0u);
+        // Read by other threads, only replaced by setOutputSnapshotBufferCount
+        std::unique_ptr<OutputSnapshotBuffer> m_outputSnapshots;
+
+        // See LogicEngine::setSubgraph, not saved to files
+        Subgraphs m_subgraphs;
+
+        void applyQueuedInputValues();
+        void discardQueuedInputValues();
         void updateLinksRecursive(Property& inputProperty);
+        [[nodiscard]] bool isOutputChangeTracked(const PropertyImpl& output) const;
+        void captureOutputVersionsRecursive(const Property& outputProperty);
+        void collectChangedOutputsRecursive(const Property& outputProperty, size_t& versionIndex);
+        [[nodiscard]] bool checkOutputOfThisEngine(const Property& output, std::string_view action);
+        [[nodiscard]] bool checkLogicNodeOfThisEngine(LogicNodeImpl& logicNode);
 
+        static void SetOutputChangesSubscribedRecursive(PropertyImpl& output, bool subscribed);
+        static void SetSnapshotOutputsRecursive(const Property& output, bool published, std::vector<const Property*>& snapshotOutputs);
+        static size_t EstimateSerializedPropertySize(const PropertyImpl& property);
         static bool CheckLogicVersionFromFile(const rlogic_serialization::Version& version);
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
 
+        [[nodiscard]] bool serialize(std::string_view saveFunctionName, std::string_view saveTarget);
+
+        [[nodiscard]] bool updateNodes(bool disableDirtyTracking);
         [[nodiscard]] bool updateLogicNodeInternal(LogicNodeImpl& node, bool disableDirtyTracking);
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
+        [[nodiscard]] std::future<bool> startAsyncLoad(std::function<void(LoadedContent&)> loadFunction);
+        [[nodiscard]] bool setLoadedContent(LoadedContent& loadedContent);
+
+        static void LoadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription, LoadedContent& loadedContent);
+        static void LoadFromFile(const std::string& filename, ramses::Scene* scene, bool enableMemoryVerification, LoadedContent& loadedContent);
     };
 }
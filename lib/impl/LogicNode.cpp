@@ -44,4 +44,24 @@ namespace rlogic
         m_impl.get().setName(name);
     }
 
+    void LogicNode::setUpdateInterval(size_t updateCount)
+    {
+        m_impl.get().setUpdateInterval(updateCount);
+    }
+
+    size_t LogicNode::getUpdateInterval() const
+    {
+        return m_impl.get().getUpdateInterval();
+    }
+
+    void LogicNode::setMinimumTimeBetweenUpdates(std::chrono::milliseconds time)
+    {
+        m_impl.get().setMinimumTimeBetweenUpdates(time);
+    }
+
+    std::chrono::milliseconds LogicNode::getMinimumTimeBetweenUpdates() const
+    {
+        return m_impl.get().getMinimumTimeBetweenUpdates();
+    }
+
 }
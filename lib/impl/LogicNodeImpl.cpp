@@ -11,6 +11,8 @@
 
 #include "ramses-logic/Property.h"
 
+#include <algorithm>
+
 namespace rlogic::internal
 {
     LogicNodeImpl::LogicNodeImpl(std::string_view name) noexcept
@@ -50,6 +52,11 @@ namespace rlogic::internal
         m_name = name;
     }
 
+    bool LogicNodeImpl::acceptsOutputValuesFromApi() const
+    {
+        return false;
+    }
+
     void LogicNodeImpl::setDirty(bool dirty)
     {
         m_dirty = dirty;
@@ -60,6 +67,53 @@ namespace rlogic::internal
         return m_dirty;
     }
 
+    void LogicNodeImpl::setUpdateInterval(size_t updateCount)
+    {
+        m_updateInterval = std::max<size_t>(updateCount, 1u);
+    }
+
+    size_t LogicNodeImpl::getUpdateInterval() const
+    {
+        return m_updateInterval;
+    }
+
+    void LogicNodeImpl::setMinimumTimeBetweenUpdates(std::chrono::milliseconds time)
+    {
+        m_minimumTimeBetweenUpdates = std::max(time, std::chrono::milliseconds{0});
+    }
+
+    std::chrono::milliseconds LogicNodeImpl::getMinimumTimeBetweenUpdates() const
+    {
+        return m_minimumTimeBetweenUpdates;
+    }
+
+    bool LogicNodeImpl::isUpdateDue(uint64_t updateCounter, std::chrono::steady_clock::time_point now) const
+    {
+        // The first update is never delayed
+        if (!m_lastUpdate)
+        {
+            return true;
+        }
+
+        return (updateCounter - m_lastUpdate->updateCounter >= m_updateInterval) &&
+            (now - m_lastUpdate->time >= m_minimumTimeBetweenUpdates);
+    }
+
+    void LogicNodeImpl::setLastUpdate(uint64_t updateCounter, std::chrono::steady_clock::time_point now)
+    {
+        m_lastUpdate = LastUpdate{updateCounter, now};
+    }
+
+    void LogicNodeImpl::setSuspended(bool suspended)
+    {
+        m_suspended = suspended;
+    }
+
+    bool LogicNodeImpl::isSuspended() const
+    {
+        return m_suspended;
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput)
     {
         m_inputs = std::move(rootInput);
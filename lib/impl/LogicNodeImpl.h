@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,12 +42,28 @@ namespace rlogic::internal
 
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
 
+        // Outputs can't be set through the public API, except by nodes which compute them in C++ (while they are updated)
+        [[nodiscard]] virtual bool acceptsOutputValuesFromApi() const;
+
         [[nodiscard]] std::string_view getName() const;
         void setName(std::string_view name);
 
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        void setUpdateInterval(size_t updateCount);
+        [[nodiscard]] size_t getUpdateInterval() const;
+        void setMinimumTimeBetweenUpdates(std::chrono::milliseconds time);
+        [[nodiscard]] std::chrono::milliseconds getMinimumTimeBetweenUpdates() const;
+
+        // Checks the update interval against the last update which was recorded with setLastUpdate
+        [[nodiscard]] bool isUpdateDue(uint64_t updateCounter, std::chrono::steady_clock::time_point now) const;
+        void setLastUpdate(uint64_t updateCounter, std::chrono::steady_clock::time_point now);
+
+        // Suspended nodes are skipped by update, including the links to their inputs (see Subgraphs)
+        void setSuspended(bool suspended);
+        [[nodiscard]] bool isSuspended() const;
+
     protected:
         // Move-able (noexcept); Not copy-able
         explicit LogicNodeImpl(std::string_view name) noexcept;
@@ -60,6 +78,16 @@ namespace rlogic::internal
         std::unique_ptr<Property> m_inputs;
         std::unique_ptr<Property> m_outputs;
         bool                      m_dirty = true;
+        bool                      m_suspended = false;
+
+        struct LastUpdate
+        {
+            uint64_t updateCounter;
+            std::chrono::steady_clock::time_point time;
+        };
+        size_t                    m_updateInterval = 1u;
+        std::chrono::milliseconds m_minimumTimeBetweenUpdates{0};
+        std::optional<LastUpdate> m_lastUpdate;
 
     };
 }
@@ -25,7 +25,8 @@ namespace rlogic::internal
     std::optional<CompiledScript> LuaScriptImpl::Compile(SolState& solState, std::string_view source, std::string_view scriptName, std::string_view filename, ErrorReporting& errorReporting)
     {
         const std::string chunkname = BuildChunkName(scriptName, filename);
-        sol::load_result load_result = solState.loadScript(source, chunkname);
+        std::shared_ptr<CompiledChunk> compiledChunk = solState.getChunkCache().get(source);
+        sol::load_result load_result = solState.loadScript(source, chunkname, *compiledChunk);
 
         if (!load_result.valid())
         {
@@ -39,7 +40,7 @@ namespace rlogic::internal
         sol::environment env = solState.createEnvironment();
         env.set_on(mainFunction);
 
-        sol::protected_function_result main_result = mainFunction();
+        sol::protected_function_result main_result = solState.callWithMemoryLimit(mainFunction);
         if (!main_result.valid())
         {
             sol::error error = main_result;
@@ -63,13 +64,28 @@ namespace rlogic::internal
             return std::nullopt;
         }
 
+        // Another instance of the same script was compiled before - clone its interface instead of executing interface() again
+        if (compiledChunk->inputsTemplate && compiledChunk->outputsTemplate)
+        {
+            return CompiledScript{
+                source,
+                scriptName,
+                filename,
+                solState,
+                std::move(load_result),
+                std::make_unique<Property>(compiledChunk->inputsTemplate->deepCopy()),
+                std::make_unique<Property>(compiledChunk->outputsTemplate->deepCopy()),
+                std::move(compiledChunk)
+            };
+        }
+
         auto inputsImpl = std::make_unique<PropertyImpl>("IN", EPropertyType::Struct, EPropertySemantics::ScriptInput);
         auto outputsImpl = std::make_unique<PropertyImpl>("OUT", EPropertyType::Struct, EPropertySemantics::ScriptOutput);
 
         env["IN"]  = solState.createUserObject(LuaScriptPropertyExtractor(*inputsImpl));
         env["OUT"] = solState.createUserObject(LuaScriptPropertyExtractor(*outputsImpl));
 
-        sol::protected_function_result intfResult = intf();
+        sol::protected_function_result intfResult = solState.callWithMemoryLimit(intf);
 
         if (!intfResult.valid())
         {
@@ -78,6 +94,9 @@ namespace rlogic::internal
             return std::nullopt;
         }
 
+        compiledChunk->inputsTemplate = inputsImpl->deepCopy();
+        compiledChunk->outputsTemplate = outputsImpl->deepCopy();
+
         return CompiledScript {
             source,
             scriptName,
@@ -85,7 +104,8 @@ namespace rlogic::internal
             solState,
             std::move(load_result),
             std::make_unique<Property>(std::move(inputsImpl)),
-            std::make_unique<Property>(std::move(outputsImpl))
+            std::make_unique<Property>(std::move(outputsImpl)),
+            std::move(compiledChunk)
         };
     }
 
@@ -95,10 +115,19 @@ namespace rlogic::internal
         , m_source(compiledScript.sourceCode)
         , m_state(compiledScript.solState)
         , m_solFunction(std::move(compiledScript.mainFunction))
+        , m_compiledChunk(std::move(compiledScript.compiledChunk))
         , m_luaPrintFunction(&LuaScriptImpl::DefaultLuaPrintFunction)
     {
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
 
+        if (isCompiled())
+        {
+            initEnvironment();
+        }
+    }
+
+    void LuaScriptImpl::initEnvironment()
+    {
         sol::environment env = sol::get_environment(m_solFunction);
 
         env["IN"] = m_state.get().createUserObject(LuaScriptPropertyHandler(m_state, *getInputs()->m_impl));
@@ -112,10 +141,11 @@ namespace rlogic::internal
         // TODO Violin investigate options to save byte code, instead of plain text, e.g.:
         //sol::bytecode scriptCode = m_solFunction.dump();
 
+        // Shared strings are stored only once per file, e.g. the source of scripts which are instantiated multiple times
         auto script = rlogic_serialization::CreateLuaScript(builder,
-            builder.CreateString(luaScript.getName()),
-            builder.CreateString(luaScript.getFilename()),
-            builder.CreateString(luaScript.m_source),
+            builder.CreateSharedString(luaScript.getName().data(), luaScript.getName().size()),
+            builder.CreateSharedString(luaScript.getFilename().data(), luaScript.getFilename().size()),
+            builder.CreateSharedString(luaScript.m_source),
             PropertyImpl::Serialize(*luaScript.getInputs()->m_impl, builder, serializationMap),
             PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap)
         );
@@ -128,7 +158,8 @@ namespace rlogic::internal
         SolState& solState,
         const rlogic_serialization::LuaScript& luaScript,
         ErrorReporting& errorReporting,
-        DeserializationMap& deserializationMap)
+        DeserializationMap& deserializationMap,
+        bool deferCompilation)
     {
         // TODO Violin make optional - no need to always serialize string if not used
         if (!luaScript.name())
@@ -190,38 +221,81 @@ namespace rlogic::internal
             return nullptr;
         }
 
-        // TODO Violin we use 'name' here, and not 'chunkname' as in Create(). This is inconsistent! Investigate closer
-        sol::load_result load_result = solState.loadScript(sourceCode, name);
+        // The properties are deserialized in any case, so that links and input values work before the script is compiled
+        sol::protected_function mainFunction;
+        std::shared_ptr<CompiledChunk> compiledChunk;
+        if (!deferCompilation)
+        {
+            const std::optional<std::string> loadError = LoadSerializedSource(solState, sourceCode, BuildChunkName(name, filename), mainFunction, compiledChunk);
+            if (loadError)
+            {
+                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data: {}", name, *loadError));
+                return nullptr;
+            }
+        }
+
+        return std::make_unique<LuaScriptImpl>(
+            CompiledScript{
+                sourceCode,
+                name,
+                filename,
+                solState,
+                std::move(mainFunction),
+                std::make_unique<Property>(std::move(rootInput)),
+                std::make_unique<Property>(std::move(rootOutput)),
+                std::move(compiledChunk)
+            }
+            );
+    }
+
+    std::optional<std::string> LuaScriptImpl::LoadSerializedSource(SolState& solState, std::string_view sourceCode, std::string_view chunkname,
+        sol::protected_function& mainFunction, std::shared_ptr<CompiledChunk>& compiledChunk)
+    {
+        compiledChunk = solState.getChunkCache().get(sourceCode);
+        sol::load_result load_result = solState.loadScript(sourceCode, chunkname, *compiledChunk);
         if (!load_result.valid())
         {
             sol::error error = load_result;
-            errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data: failed parsing Lua source code:\n{}", name, error.what()));
-            return nullptr;
+            compiledChunk.reset();
+            return fmt::format("failed parsing Lua source code:\n{}", error.what());
         }
 
-        sol::protected_function mainFunction = load_result;
+        mainFunction = load_result.get<sol::protected_function>();
         sol::environment env = solState.createEnvironment();
         env.set_on(mainFunction);
 
-        sol::protected_function_result main_result = mainFunction();
+        sol::protected_function_result main_result = solState.callWithMemoryLimit(mainFunction);
         if (!main_result.valid())
         {
             sol::error error = main_result;
-            errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data: failed executing script:\n{}!", name, error.what()));
-            return nullptr;
+            mainFunction = sol::protected_function();
+            compiledChunk.reset();
+            return fmt::format("failed executing script:\n{}!", error.what());
         }
 
-        return std::make_unique<LuaScriptImpl>(
-            CompiledScript{
-                sourceCode,
-                name,
-                filename,
-                solState,
-                sol::protected_function(std::move(load_result)),
-                std::make_unique<Property>(std::move(rootInput)),
-                std::make_unique<Property>(std::move(rootOutput))
-            }
-            );
+        return std::nullopt;
+    }
+
+    bool LuaScriptImpl::isCompiled() const
+    {
+        return m_solFunction.valid();
+    }
+
+    std::optional<std::string> LuaScriptImpl::compile()
+    {
+        if (isCompiled())
+        {
+            return std::nullopt;
+        }
+
+        const std::optional<std::string> loadError = LoadSerializedSource(m_state, m_source, BuildChunkName(getName(), m_filename), m_solFunction, m_compiledChunk);
+        if (loadError)
+        {
+            return fmt::format("Failed to compile LuaScript '{}': {}", getName(), *loadError);
+        }
+
+        initEnvironment();
+        return std::nullopt;
     }
 
     std::string LuaScriptImpl::BuildChunkName(std::string_view scriptName, std::string_view fileName)
@@ -252,11 +326,25 @@ namespace rlogic::internal
         return m_filename;
     }
 
+    std::string_view LuaScriptImpl::getSourceCode() const
+    {
+        return m_source;
+    }
+
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
+        if (!isCompiled())
+        {
+            std::optional<std::string> compileError = compile();
+            if (compileError)
+            {
+                return LogicNodeRuntimeError{std::move(*compileError)};
+            }
+        }
+
         sol::environment        env  = sol::get_environment(m_solFunction);
         sol::protected_function runFunction = env["run"];
-        sol::protected_function_result result = runFunction();
+        sol::protected_function_result result = m_state.get().callWithMemoryLimit(runFunction);
 
         if (!result.valid())
         {
@@ -39,6 +39,7 @@ namespace rlogic::internal
     class SolState;
     class PropertyImpl;
     class ErrorReporting;
+    struct CompiledChunk;
 
     struct CompiledScript
     {
@@ -49,12 +50,15 @@ namespace rlogic::internal
 
         // Which Lua/sol environment holds the compiled function
         std::reference_wrapper<SolState> solState;
-        // The main function (holding interface() and run() functions)
+        // The main function (holding interface() and run() functions). Empty if compilation was deferred
         sol::protected_function mainFunction;
 
         // Parsed interface properties
         std::unique_ptr<Property> rootInput;
         std::unique_ptr<Property> rootOutput;
+
+        // Entry of the chunk cache, shared with other instances of the same source. Empty if compilation was deferred
+        std::shared_ptr<CompiledChunk> compiledChunk;
     };
 
     class LuaScriptImpl : public LogicNodeImpl
@@ -79,12 +83,19 @@ namespace rlogic::internal
             SolState& solState,
             const rlogic_serialization::LuaScript& luaScript,
             ErrorReporting& errorReporting,
-            DeserializationMap& deserializationMap);
+            DeserializationMap& deserializationMap,
+            bool deferCompilation = false);
 
         [[nodiscard]] std::string_view getFilename() const;
+        [[nodiscard]] std::string_view getSourceCode() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
 
+        // Scripts loaded with deferred compilation are compiled on first update() or by calling compile() explicitly.
+        // Returns an error message if compilation failed
+        [[nodiscard]] bool isCompiled() const;
+        [[nodiscard]] std::optional<std::string> compile();
+
         void luaPrint(sol::variadic_args args);
         void overrideLuaPrint(LuaPrintFunction luaPrintFunction);
 
@@ -93,9 +104,14 @@ namespace rlogic::internal
         std::string                             m_source;
         std::reference_wrapper<SolState>        m_state;
         sol::protected_function                 m_solFunction;
+        std::shared_ptr<CompiledChunk>          m_compiledChunk;
         LuaPrintFunction                        m_luaPrintFunction;
 
+        void initEnvironment();
+
         static std::string BuildChunkName(std::string_view scriptName, std::string_view fileName);
+        [[nodiscard]] static std::optional<std::string> LoadSerializedSource(SolState& solState, std::string_view sourceCode, std::string_view chunkname,
+            sol::protected_function& mainFunction, std::shared_ptr<CompiledChunk>& compiledChunk);
 
         static void DefaultLuaPrintFunction(std::string_view scriptName, std::string_view message);
     };
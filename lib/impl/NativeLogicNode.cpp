@@ -0,0 +1,27 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/NativeLogicNode.h"
+#include "impl/NativeLogicNodeImpl.h"
+
+namespace rlogic
+{
+    NativeLogicNode::NativeLogicNode(std::unique_ptr<internal::NativeLogicNodeImpl> impl) noexcept
+        // The impl pointer is owned by this class, but a reference to the data is passed to the base class
+        : LogicNode(std::ref(static_cast<internal::LogicNodeImpl&>(*impl)))
+        , m_nativeNode(std::move(impl))
+    {
+    }
+
+    NativeLogicNode::~NativeLogicNode() noexcept = default;
+
+    std::string_view NativeLogicNode::getTypeName() const
+    {
+        return m_nativeNode->getTypeName();
+    }
+}
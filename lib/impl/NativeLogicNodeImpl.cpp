@@ -0,0 +1,215 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/NativeLogicNodeImpl.h"
+#include "impl/PropertyImpl.h"
+
+#include "internals/ErrorReporting.h"
+#include "internals/TypeUtils.h"
+
+#include "ramses-logic/Property.h"
+
+#include "generated/NativeLogicNodeGen.h"
+
+#include "fmt/format.h"
+
+#include <unordered_set>
+
+namespace rlogic::internal
+{
+    NativeLogicNodeImpl::NativeLogicNodeImpl(std::string_view name, std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type)
+        : NativeLogicNodeImpl(name, typeName, type,
+            CreateRootProperty("IN", type->inputs, EPropertySemantics::ScriptInput),
+            CreateRootProperty("OUT", type->outputs, EPropertySemantics::ScriptOutput))
+    {
+    }
+
+    NativeLogicNodeImpl::NativeLogicNodeImpl(std::string_view name, std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
+        : LogicNodeImpl(name)
+        , m_typeName(typeName)
+        , m_type(std::move(type))
+    {
+        setRootProperties(std::make_unique<Property>(std::move(rootInput)), std::make_unique<Property>(std::move(rootOutput)));
+    }
+
+    std::optional<std::string> NativeLogicNodeImpl::ValidateType(const NativeLogicNodeType& type)
+    {
+        if (!type.update)
+        {
+            return "missing update function";
+        }
+
+        std::optional<std::string> error = ValidateDeclarations(type.inputs);
+        if (error)
+        {
+            return fmt::format("invalid inputs: {}", *error);
+        }
+
+        error = ValidateDeclarations(type.outputs);
+        if (error)
+        {
+            return fmt::format("invalid outputs: {}", *error);
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::string> NativeLogicNodeImpl::ValidateDeclarations(const std::vector<NativePropertyDeclaration>& declarations)
+    {
+        std::unordered_set<std::string_view> names;
+        for (const auto& declaration : declarations)
+        {
+            if (declaration.name.empty())
+            {
+                return "properties must have a name";
+            }
+
+            if (!names.insert(declaration.name).second)
+            {
+                return fmt::format("property '{}' is declared more than once", declaration.name);
+            }
+
+            if (!TypeUtils::IsValidType(declaration.type) || declaration.type == EPropertyType::Array)
+            {
+                return fmt::format("property '{}' has an unsupported type (only primitive types and structs are supported)", declaration.name);
+            }
+
+            if (declaration.type == EPropertyType::Struct)
+            {
+                const std::optional<std::string> childError = ValidateDeclarations(declaration.children);
+                if (childError)
+                {
+                    return childError;
+                }
+            }
+            else if (!declaration.children.empty())
+            {
+                return fmt::format("property '{}' has children but is not a struct", declaration.name);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::unique_ptr<PropertyImpl> NativeLogicNodeImpl::CreateRootProperty(std::string_view name, const std::vector<NativePropertyDeclaration>& declarations, EPropertySemantics semantics)
+    {
+        auto property = std::make_unique<PropertyImpl>(name, EPropertyType::Struct, semantics);
+        for (const auto& declaration : declarations)
+        {
+            if (declaration.type == EPropertyType::Struct)
+            {
+                property->addChild(CreateRootProperty(declaration.name, declaration.children, semantics));
+            }
+            else
+            {
+                property->addChild(std::make_unique<PropertyImpl>(declaration.name, declaration.type, semantics));
+            }
+        }
+        return property;
+    }
+
+    std::string_view NativeLogicNodeImpl::getTypeName() const
+    {
+        return m_typeName;
+    }
+
+    std::optional<LogicNodeRuntimeError> NativeLogicNodeImpl::update()
+    {
+        m_updating = true;
+        const std::optional<std::string> error = m_type->update(*getInputs(), *getOutputs());
+        m_updating = false;
+
+        if (error)
+        {
+            return LogicNodeRuntimeError{ *error };
+        }
+        return std::nullopt;
+    }
+
+    bool NativeLogicNodeImpl::acceptsOutputValuesFromApi() const
+    {
+        return m_updating;
+    }
+
+    flatbuffers::Offset<rlogic_serialization::NativeLogicNode> NativeLogicNodeImpl::Serialize(const NativeLogicNodeImpl& nativeNode, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    {
+        auto node = rlogic_serialization::CreateNativeLogicNode(builder,
+            builder.CreateSharedString(nativeNode.getName().data(), nativeNode.getName().size()),
+            builder.CreateSharedString(nativeNode.m_typeName),
+            PropertyImpl::Serialize(*nativeNode.getInputs()->m_impl, builder, serializationMap),
+            PropertyImpl::Serialize(*nativeNode.getOutputs()->m_impl, builder, serializationMap)
+        );
+        builder.Finish(node);
+
+        return node;
+    }
+
+    std::unique_ptr<NativeLogicNodeImpl> NativeLogicNodeImpl::Deserialize(
+        const rlogic_serialization::NativeLogicNode& nativeNode,
+        const NativeLogicNodeTypes& nativeLogicNodeTypes,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        if (!nativeNode.name())
+        {
+            errorReporting.add("Fatal error during loading of NativeLogicNode from serialized data: missing name!");
+            return nullptr;
+        }
+
+        if (!nativeNode.typeName())
+        {
+            errorReporting.add("Fatal error during loading of NativeLogicNode from serialized data: missing type name!");
+            return nullptr;
+        }
+
+        const std::string_view name = nativeNode.name()->string_view();
+        const std::string_view typeName = nativeNode.typeName()->string_view();
+
+        const auto typeIter = nativeLogicNodeTypes.find(std::string(typeName));
+        if (typeIter == nativeLogicNodeTypes.end())
+        {
+            errorReporting.add(fmt::format("Can't load NativeLogicNode '{}': type '{}' is not registered! Register it with registerNativeLogicNodeType() before loading", name, typeName));
+            return nullptr;
+        }
+
+        if (!nativeNode.rootInput())
+        {
+            errorReporting.add("Fatal error during loading of NativeLogicNode from serialized data: missing root input!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootInput = PropertyImpl::Deserialize(*nativeNode.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        if (!rootInput)
+        {
+            return nullptr;
+        }
+
+        if (!nativeNode.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of NativeLogicNode from serialized data: missing root output!");
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> rootOutput = PropertyImpl::Deserialize(*nativeNode.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!rootOutput)
+        {
+            return nullptr;
+        }
+
+        // The update function relies on the registered interface, so the saved one must match it exactly
+        const NativeLogicNodeType& type = *typeIter->second;
+        if (!rootInput->hasSameStructureAs(*CreateRootProperty("IN", type.inputs, EPropertySemantics::ScriptInput)) ||
+            !rootOutput->hasSameStructureAs(*CreateRootProperty("OUT", type.outputs, EPropertySemantics::ScriptOutput)))
+        {
+            errorReporting.add(fmt::format("Can't load NativeLogicNode '{}': the saved interface doesn't match the registered interface of type '{}'!", name, typeName));
+            return nullptr;
+        }
+
+        return std::unique_ptr<NativeLogicNodeImpl>(new NativeLogicNodeImpl(name, typeName, typeIter->second, std::move(rootInput), std::move(rootOutput)));
+    }
+}
@@ -0,0 +1,82 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+#include "internals/EPropertySemantics.h"
+
+#include "ramses-logic/NativeLogicNode.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace rlogic_serialization
+{
+    struct NativeLogicNode;
+}
+
+namespace flatbuffers
+{
+    class FlatBufferBuilder;
+    template<typename T> struct Offset;
+}
+
+namespace rlogic::internal
+{
+    class ErrorReporting;
+
+    // Registered types by name. Held by shared pointer, so that nodes keep their type when it's registered anew
+    using NativeLogicNodeTypes = std::unordered_map<std::string, std::shared_ptr<const NativeLogicNodeType>>;
+
+    class NativeLogicNodeImpl : public LogicNodeImpl
+    {
+    public:
+        // Returns an error message if the declared interface or the update function is invalid
+        [[nodiscard]] static std::optional<std::string> ValidateType(const NativeLogicNodeType& type);
+
+        NativeLogicNodeImpl(std::string_view name, std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type);
+        // Move-able (noexcept); Not copy-able
+        ~NativeLogicNodeImpl() noexcept override = default;
+        NativeLogicNodeImpl(NativeLogicNodeImpl&& other) noexcept = default;
+        NativeLogicNodeImpl& operator=(NativeLogicNodeImpl&& other) noexcept = default;
+        NativeLogicNodeImpl(const NativeLogicNodeImpl& other) = delete;
+        NativeLogicNodeImpl& operator=(const NativeLogicNodeImpl& other) = delete;
+
+        [[nodiscard]] std::string_view getTypeName() const;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool acceptsOutputValuesFromApi() const override;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::NativeLogicNode> Serialize(
+            const NativeLogicNodeImpl& nativeNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<NativeLogicNodeImpl> Deserialize(
+            const rlogic_serialization::NativeLogicNode& nativeNode,
+            const NativeLogicNodeTypes& nativeLogicNodeTypes,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+    private:
+        NativeLogicNodeImpl(std::string_view name, std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type, std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
+
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> CreateRootProperty(std::string_view name, const std::vector<NativePropertyDeclaration>& declarations, EPropertySemantics semantics);
+        [[nodiscard]] static std::optional<std::string> ValidateDeclarations(const std::vector<NativePropertyDeclaration>& declarations);
+
+        std::string m_typeName;
+        std::shared_ptr<const NativeLogicNodeType> m_type;
+        bool m_updating = false;
+    };
+}
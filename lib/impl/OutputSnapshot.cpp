@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/OutputSnapshot.h"
+#include "impl/OutputSnapshotImpl.h"
+
+namespace rlogic
+{
+    OutputSnapshot::OutputSnapshot() noexcept
+        : m_impl(std::make_unique<internal::OutputSnapshotImpl>())
+    {
+    }
+
+    OutputSnapshot::~OutputSnapshot() noexcept = default;
+
+    uint64_t OutputSnapshot::getUpdateCounter() const
+    {
+        return m_impl->getUpdateCounter();
+    }
+
+    template <typename T> std::optional<T> OutputSnapshot::getInternal(const Property& output) const
+    {
+        const internal::PropertyValue* value = m_impl->getValue(output);
+        if (value == nullptr || !std::holds_alternative<T>(*value))
+        {
+            return std::nullopt;
+        }
+        return std::get<T>(*value);
+    }
+
+    template RLOGIC_API std::optional<float>       OutputSnapshot::getInternal<float>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec2f>       OutputSnapshot::getInternal<vec2f>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec3f>       OutputSnapshot::getInternal<vec3f>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec4f>       OutputSnapshot::getInternal<vec4f>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<int32_t>     OutputSnapshot::getInternal<int32_t>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec2i>       OutputSnapshot::getInternal<vec2i>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec3i>       OutputSnapshot::getInternal<vec3i>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<vec4i>       OutputSnapshot::getInternal<vec4i>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<std::string> OutputSnapshot::getInternal<std::string>(const Property& /*output*/) const;
+    template RLOGIC_API std::optional<bool>        OutputSnapshot::getInternal<bool>(const Property& /*output*/) const;
+}
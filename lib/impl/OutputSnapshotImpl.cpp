@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/OutputSnapshotImpl.h"
+
+#include "ramses-logic/Property.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace rlogic::internal
+{
+    void OutputSnapshotImpl::capture(uint64_t updateCounter, const std::shared_ptr<const std::atomic<uint64_t>>& contentGeneration, const std::vector<const Property*>& outputs)
+    {
+        assert(std::is_sorted(outputs.cbegin(), outputs.cend(), std::less<>()));
+        m_updateCounter = updateCounter;
+        m_capturedContentGeneration = contentGeneration->load(std::memory_order_relaxed);
+        if (m_contentGeneration != contentGeneration)
+        {
+            m_contentGeneration = contentGeneration;
+        }
+        // Assignments keep the memory of previous captures (also of string values)
+        m_outputs = outputs;
+        m_values.resize(outputs.size());
+        for (size_t i = 0; i < outputs.size(); ++i)
+        {
+            m_values[i] = outputs[i]->m_impl->getValue();
+        }
+    }
+
+    bool OutputSnapshotImpl::isValid() const
+    {
+        return m_contentGeneration && m_contentGeneration->load(std::memory_order_acquire) == m_capturedContentGeneration;
+    }
+
+    uint64_t OutputSnapshotImpl::getUpdateCounter() const
+    {
+        return m_updateCounter;
+    }
+
+    const PropertyValue* OutputSnapshotImpl::getValue(const Property& output) const
+    {
+        // Don't rely on the addresses of properties which were destroyed in the meantime
+        if (!isValid())
+        {
+            return nullptr;
+        }
+
+        const auto iter = std::lower_bound(m_outputs.cbegin(), m_outputs.cend(), &output, std::less<>());
+        if (iter == m_outputs.cend() || *iter != &output)
+        {
+            return nullptr;
+        }
+        return &m_values[static_cast<size_t>(iter - m_outputs.cbegin())];
+    }
+}
@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/PropertyImpl.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rlogic
+{
+    class Property;
+}
+
+namespace rlogic::internal
+{
+    class OutputSnapshotImpl
+    {
+    public:
+        // Copies the current values of the outputs, which must be sorted by address. The values are only valid as long as
+        // contentGeneration keeps its current value, it changes when properties are destroyed and their addresses can be reused
+        void capture(uint64_t updateCounter, const std::shared_ptr<const std::atomic<uint64_t>>& contentGeneration, const std::vector<const Property*>& outputs);
+
+        [[nodiscard]] bool isValid() const;
+        [[nodiscard]] uint64_t getUpdateCounter() const;
+        // nullptr if the output is not contained or the snapshot is not valid anymore
+        [[nodiscard]] const PropertyValue* getValue(const Property& output) const;
+
+    private:
+        uint64_t m_updateCounter = 0u;
+        uint64_t m_capturedContentGeneration = 0u;
+        // Shared with the logic engine, which can be destroyed before its snapshots
+        std::shared_ptr<const std::atomic<uint64_t>> m_contentGeneration;
+        // Sorted by address, so that values can be found with a binary search
+        std::vector<const Property*> m_outputs;
+        std::vector<PropertyValue> m_values;
+    };
+}
@@ -73,297 +73,289 @@ namespace rlogic::internal
         m_value = std::move(initialValue);
     }
 
-    flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::Serialize(const PropertyImpl& prop, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    flatbuffers::Offset<rlogic_serialization::PropertyTree> PropertyImpl::Serialize(const PropertyImpl& prop, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
     {
-        auto result = SerializeRecursive(prop, builder, serializationMap);
-        builder.Finish(result);
-        return result;
-    }
-
-    flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::SerializeRecursive(
-        const PropertyImpl& prop,
-        flatbuffers::FlatBufferBuilder& builder,
-        SerializationMap& serializationMap)
-    {
-        std::vector<flatbuffers::Offset<rlogic_serialization::Property>> child_vector;
-        child_vector.reserve(prop.m_children.size());
+        std::vector<const PropertyImpl*> properties{ &prop };
+        std::vector<rlogic_serialization::PropertyRecord> records;
+        std::vector<float> floatValues;
+        std::vector<int32_t> intValues;
+        std::vector<uint8_t> boolValues;
+        std::vector<uint32_t> stringValues;
+
+        // Breadth-first traversal, so that the children of each property end up next to each other
+        for (size_t i = 0; i < properties.size(); ++i)
+        {
+            const PropertyImpl& current = *properties[i];
 
-        std::transform(prop.m_children.begin(), prop.m_children.end(), std::back_inserter(child_vector), [&builder, &serializationMap](const std::vector<std::unique_ptr<Property>>::value_type& child) {
-            return SerializeRecursive(*child->m_impl, builder, serializationMap);
-            });
+            uint32_t dataIndex = 0u;
+            uint32_t childCount = 0u;
 
-        // Assume primitive property, override only for struct/arrays based on m_type
-        rlogic_serialization::EPropertyRootType propertyRootType = rlogic_serialization::EPropertyRootType::Primitive;
-        rlogic_serialization::PropertyValue valueType = rlogic_serialization::PropertyValue::NONE;
-        flatbuffers::Offset<void> valueOffset;
+            switch (current.m_type)
+            {
+            case EPropertyType::Float:
+                dataIndex = static_cast<uint32_t>(floatValues.size());
+                floatValues.push_back(current.getValueAs<float>());
+                break;
+            case EPropertyType::Vec2f:
+            {
+                dataIndex = static_cast<uint32_t>(floatValues.size());
+                const auto& value = current.getValueAs<vec2f>();
+                floatValues.insert(floatValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Vec3f:
+            {
+                dataIndex = static_cast<uint32_t>(floatValues.size());
+                const auto& value = current.getValueAs<vec3f>();
+                floatValues.insert(floatValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Vec4f:
+            {
+                dataIndex = static_cast<uint32_t>(floatValues.size());
+                const auto& value = current.getValueAs<vec4f>();
+                floatValues.insert(floatValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Int32:
+                dataIndex = static_cast<uint32_t>(intValues.size());
+                intValues.push_back(current.getValueAs<int32_t>());
+                break;
+            case EPropertyType::Vec2i:
+            {
+                dataIndex = static_cast<uint32_t>(intValues.size());
+                const auto& value = current.getValueAs<vec2i>();
+                intValues.insert(intValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Vec3i:
+            {
+                dataIndex = static_cast<uint32_t>(intValues.size());
+                const auto& value = current.getValueAs<vec3i>();
+                intValues.insert(intValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Vec4i:
+            {
+                dataIndex = static_cast<uint32_t>(intValues.size());
+                const auto& value = current.getValueAs<vec4i>();
+                intValues.insert(intValues.end(), value.cbegin(), value.cend());
+                break;
+            }
+            case EPropertyType::Bool:
+                dataIndex = static_cast<uint32_t>(boolValues.size());
+                boolValues.push_back(current.getValueAs<bool>() ? 1u : 0u);
+                break;
+            case EPropertyType::String:
+                dataIndex = static_cast<uint32_t>(stringValues.size());
+                stringValues.push_back(serializationMap.storeString(current.getValueAs<std::string>()));
+                break;
+            case EPropertyType::Array:
+            case EPropertyType::Struct:
+                dataIndex = static_cast<uint32_t>(properties.size());
+                childCount = static_cast<uint32_t>(current.m_children.size());
+                for (const auto& child : current.m_children)
+                {
+                    properties.push_back(child->m_impl.get());
+                }
+                break;
+            }
 
-        switch (prop.m_type)
-        {
-        case EPropertyType::Bool:
-        {
-            const rlogic_serialization::bool_s bool_struct(prop.getValueAs<bool>());
-            valueOffset = builder.CreateStruct(bool_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::bool_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Float:
-        {
-            const rlogic_serialization::float_s float_struct(prop.getValueAs<float>());
-            valueOffset = builder.CreateStruct(float_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::float_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec2f:
-        {
-            const auto& valueVec2f = prop.getValueAs<vec2f>();
-            const rlogic_serialization::vec2f_s vec2f_struct(valueVec2f[0], valueVec2f[1]);
-            valueOffset = builder.CreateStruct(vec2f_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec2f_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec3f:
-        {
-            const auto& valueVec3f = prop.getValueAs<vec3f>();
-            const rlogic_serialization::vec3f_s vec3f_struct(valueVec3f[0], valueVec3f[1], valueVec3f[2]);
-            valueOffset = builder.CreateStruct(vec3f_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec3f_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec4f:
-        {
-            const auto& valueVec4f = prop.getValueAs<vec4f>();
-            const rlogic_serialization::vec4f_s vec4f_struct(valueVec4f[0], valueVec4f[1], valueVec4f[2], valueVec4f[3]);
-            valueOffset = builder.CreateStruct(vec4f_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec4f_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Int32:
-        {
-            const rlogic_serialization::int32_s int32_struct(prop.getValueAs<int32_t>());
-            valueOffset = builder.CreateStruct(int32_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::int32_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec2i:
-        {
-            const auto& valueVec2i = prop.getValueAs<vec2i>();
-            const rlogic_serialization::vec2i_s vec2i_struct(valueVec2i[0], valueVec2i[1]);
-            valueOffset = builder.CreateStruct(vec2i_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec2i_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec3i:
-        {
-            const auto& valueVec3i = prop.getValueAs<vec3i>();
-            const rlogic_serialization::vec3i_s vec3i_struct(valueVec3i[0], valueVec3i[1], valueVec3i[2]);
-            valueOffset = builder.CreateStruct(vec3i_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec3i_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Vec4i:
-        {
-            const auto& valueVec4i = prop.getValueAs<vec4i>();
-            const rlogic_serialization::vec4i_s vec4i_struct(valueVec4i[0], valueVec4i[1], valueVec4i[2], valueVec4i[3]);
-            valueOffset = builder.CreateStruct(vec4i_struct).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::vec4i_s>::enum_value;
-        }
-        break;
-        case EPropertyType::String:
-        {
-            valueOffset = rlogic_serialization::Createstring_s(builder, builder.CreateString(prop.getValueAs<std::string>())).Union();
-            valueType = rlogic_serialization::PropertyValueTraits<rlogic_serialization::string_s>::enum_value;
-        }
-        break;
-        case EPropertyType::Array:
-            propertyRootType = rlogic_serialization::EPropertyRootType::Array;
-            break;
-        case EPropertyType::Struct:
-            propertyRootType = rlogic_serialization::EPropertyRootType::Struct;
-            break;
+            records.emplace_back(
+                ConvertEPropertyTypeToSerializationType(current.m_type),
+                serializationMap.storeString(current.m_name),
+                dataIndex,
+                childCount);
         }
 
-        auto propertyFB = rlogic_serialization::CreateProperty(builder,
-            builder.CreateString(prop.m_name),
-            propertyRootType,
-            builder.CreateVector(child_vector),
-            valueType,
-            valueOffset
+        // Value vectors which are not used are not stored at all
+        auto propertyTree = rlogic_serialization::CreatePropertyTree(builder,
+            builder.CreateVectorOfStructs(records),
+            floatValues.empty() ? 0 : builder.CreateVector(floatValues),
+            intValues.empty() ? 0 : builder.CreateVector(intValues),
+            boolValues.empty() ? 0 : builder.CreateVector(boolValues),
+            stringValues.empty() ? 0 : builder.CreateVector(stringValues)
         );
 
-        serializationMap.storePropertyOffset(prop, propertyFB);
+        for (size_t i = 0; i < properties.size(); ++i)
+        {
+            serializationMap.storePropertyLocation(*properties[i], propertyTree, static_cast<uint32_t>(i));
+        }
 
-        return propertyFB;
+        builder.Finish(propertyTree);
+        return propertyTree;
     }
 
     std::unique_ptr<PropertyImpl> PropertyImpl::Deserialize(
-        const rlogic_serialization::Property& prop,
+        const rlogic_serialization::PropertyTree& propertyTree,
         EPropertySemantics semantics,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap)
     {
-        // TODO Violin we can make name optional - e.g. array fields don't need a name, no need to serialize empty strings
-        if (!prop.name())
+        const auto* records = propertyTree.records();
+        if (!records || records->size() == 0u)
         {
-            errorReporting.add("Fatal error during loading of Property from serialized data: missing name!");
+            errorReporting.add("Fatal error during loading of Property from serialized data: missing property records!");
             return nullptr;
         }
 
-        const std::string_view propName = prop.name()->string_view();
-        const std::optional convertedType = ConvertSerializationTypeToEPropertyType(prop.rootType(), prop.value_type());
+        const auto* floatValues = propertyTree.floatValues();
+        const auto* intValues = propertyTree.intValues();
+        const auto* boolValues = propertyTree.boolValues();
+        const auto* stringValues = propertyTree.stringValues();
 
-        if (!convertedType)
+        auto hasValues = [](const auto* values, uint32_t index, uint32_t componentCount)
         {
-            errorReporting.add("Fatal error during loading of Property from serialized data: invalid type!");
-            return nullptr;
-        }
+            return values != nullptr && static_cast<size_t>(index) + componentCount <= values->size();
+        };
 
-        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(propName, *convertedType, semantics));
+        const size_t recordCount = records->size();
+        std::vector<std::unique_ptr<PropertyImpl>> properties(recordCount);
+        std::vector<PropertyImpl*> propertiesByIndex(recordCount, nullptr);
 
-        // If primitive: set value; otherwise load children
-        if (prop.rootType() == rlogic_serialization::EPropertyRootType::Primitive)
+        // Children are always stored after their parent, create them first by iterating backwards
+        for (size_t i = recordCount; i-- > 0u;)
         {
-            // TODO Violin investigate possibilities to unit-test enum mismatches (and perhaps collapse
-            // the if-s in the switch below if possible)
-            switch (prop.value_type())
+            const rlogic_serialization::PropertyRecord& record = *records->Get(static_cast<flatbuffers::uoffset_t>(i));
+
+            const std::optional<EPropertyType> convertedType = ConvertSerializationTypeToEPropertyType(record.type());
+            if (!convertedType)
+            {
+                errorReporting.add("Fatal error during loading of Property from serialized data: invalid type!");
+                return nullptr;
+            }
+
+            const std::optional<std::string_view> name = deserializationMap.resolveString(record.nameIndex());
+            if (!name)
+            {
+                errorReporting.add("Fatal error during loading of Property from serialized data: invalid name index!");
+                return nullptr;
+            }
+
+            std::unique_ptr<PropertyImpl> impl(new PropertyImpl(*name, *convertedType, semantics));
+            const uint32_t dataIndex = record.dataIndex();
+            bool validValue = true;
+
+            switch (*convertedType)
             {
-            case rlogic_serialization::PropertyValue::float_s:
-                if (!prop.value_as_float_s())
+            case EPropertyType::Float:
+                validValue = hasValues(floatValues, dataIndex, 1u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = floatValues->Get(dataIndex);
                 }
-                impl->m_value = prop.value_as_float_s()->v();
                 break;
-            case rlogic_serialization::PropertyValue::vec2f_s:
-            {
-                auto vec2fValue = prop.value_as_vec2f_s();
-                if (!vec2fValue)
+            case EPropertyType::Vec2f:
+                validValue = hasValues(floatValues, dataIndex, 2u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec2f{ floatValues->Get(dataIndex), floatValues->Get(dataIndex + 1) };
                 }
-                impl->m_value         = vec2f{vec2fValue->x(), vec2fValue->y()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::vec3f_s:
-            {
-                auto vec3fValue = prop.value_as_vec3f_s();
-                if (!vec3fValue)
+            case EPropertyType::Vec3f:
+                validValue = hasValues(floatValues, dataIndex, 3u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec3f{ floatValues->Get(dataIndex), floatValues->Get(dataIndex + 1), floatValues->Get(dataIndex + 2) };
                 }
-                impl->m_value         = vec3f{vec3fValue->x(), vec3fValue->y(), vec3fValue->z()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::vec4f_s:
-            {
-                auto vec4fValue = prop.value_as_vec4f_s();
-                if (!vec4fValue)
+            case EPropertyType::Vec4f:
+                validValue = hasValues(floatValues, dataIndex, 4u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec4f{ floatValues->Get(dataIndex), floatValues->Get(dataIndex + 1), floatValues->Get(dataIndex + 2), floatValues->Get(dataIndex + 3) };
                 }
-                impl->m_value         = vec4f{vec4fValue->x(), vec4fValue->y(), vec4fValue->z(), vec4fValue->w()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::int32_s:
-                if (!prop.value_as_int32_s())
+            case EPropertyType::Int32:
+                validValue = hasValues(intValues, dataIndex, 1u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = intValues->Get(dataIndex);
                 }
-                impl->m_value = prop.value_as_int32_s()->v();
                 break;
-            case rlogic_serialization::PropertyValue::vec2i_s:
-            {
-                auto vec2iValue = prop.value_as_vec2i_s();
-                if (!vec2iValue)
+            case EPropertyType::Vec2i:
+                validValue = hasValues(intValues, dataIndex, 2u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec2i{ intValues->Get(dataIndex), intValues->Get(dataIndex + 1) };
                 }
-                impl->m_value         = vec2i{vec2iValue->x(), vec2iValue->y()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::vec3i_s:
-            {
-                auto vec3iValue = prop.value_as_vec3i_s();
-                if (!vec3iValue)
+            case EPropertyType::Vec3i:
+                validValue = hasValues(intValues, dataIndex, 3u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec3i{ intValues->Get(dataIndex), intValues->Get(dataIndex + 1), intValues->Get(dataIndex + 2) };
                 }
-                impl->m_value         = vec3i{vec3iValue->x(), vec3iValue->y(), vec3iValue->z()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::vec4i_s:
-            {
-                auto vec4iValue = prop.value_as_vec4i_s();
-                if (!vec4iValue)
+            case EPropertyType::Vec4i:
+                validValue = hasValues(intValues, dataIndex, 4u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = vec4i{ intValues->Get(dataIndex), intValues->Get(dataIndex + 1), intValues->Get(dataIndex + 2), intValues->Get(dataIndex + 3) };
                 }
-                impl->m_value         = vec4i{vec4iValue->x(), vec4iValue->y(), vec4iValue->z(), vec4iValue->w()};
                 break;
-            }
-            case rlogic_serialization::PropertyValue::string_s:
-                if (!prop.value_as_string_s())
+            case EPropertyType::Bool:
+                validValue = hasValues(boolValues, dataIndex, 1u);
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = (boolValues->Get(dataIndex) != 0u);
                 }
-                impl->m_value = prop.value_as_string_s()->v()->str();
                 break;
-            case rlogic_serialization::PropertyValue::bool_s:
-                if (!prop.value_as_bool_s())
+            case EPropertyType::String:
+            {
+                const std::optional<std::string_view> stringValue = hasValues(stringValues, dataIndex, 1u) ? deserializationMap.resolveString(stringValues->Get(dataIndex)) : std::nullopt;
+                validValue = stringValue.has_value();
+                if (validValue)
                 {
-                    errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!");
-                    return nullptr;
+                    impl->m_value = std::string(*stringValue);
                 }
-                impl->m_value = prop.value_as_bool_s()->v();
                 break;
-            case rlogic_serialization::PropertyValue::NONE:
-            default:
-                assert(false && "Should never reach this line - invalid types should be handled in ConvertSerializationTypeToEPropertyType above");
-                return nullptr;
-            }
-        }
-        else
-        {
-            // Invalid types are handled above
-            assert (prop.rootType() == rlogic_serialization::EPropertyRootType::Struct || prop.rootType() == rlogic_serialization::EPropertyRootType::Array);
-
-            if (!prop.children())
-            {
-                errorReporting.add("Fatal error during loading of Property from serialized data: complex type has no child type info!");
-                return nullptr;
             }
-
-            for (const auto* child : *prop.children())
+            case EPropertyType::Array:
+            case EPropertyType::Struct:
             {
-                if (!child)
+                const size_t firstChild = dataIndex;
+                const size_t childrenEnd = firstChild + record.childCount();
+                if (record.childCount() != 0u && (firstChild <= i || childrenEnd > recordCount))
                 {
-                    // TODO Violin find ways to unit-test this case
                     errorReporting.add("Fatal error during loading of Property from serialized data: corrupt child data!");
                     return nullptr;
                 }
 
-                std::unique_ptr<PropertyImpl> deserializedChild = PropertyImpl::Deserialize(*child, semantics, errorReporting, deserializationMap);
-
-                if (!deserializedChild)
+                for (size_t childIndex = firstChild; childIndex < childrenEnd; ++childIndex)
                 {
-                    return nullptr;
+                    // Each child can only have a single parent
+                    if (!properties[childIndex])
+                    {
+                        errorReporting.add("Fatal error during loading of Property from serialized data: corrupt child data!");
+                        return nullptr;
+                    }
+                    impl->addChild(std::move(properties[childIndex]));
                 }
+                break;
+            }
+            }
 
-                impl->addChild(std::move(deserializedChild));
+            if (!validValue)
+            {
+                errorReporting.add("Fatal error during loading of Property from serialized data: invalid value index!");
+                return nullptr;
             }
+
+            propertiesByIndex[i] = impl.get();
+            properties[i] = std::move(impl);
+        }
+
+        // Records which are not referenced by any parent indicate corrupted data
+        if (std::any_of(properties.cbegin() + 1, properties.cend(), [](const auto& p) { return p != nullptr; }))
+        {
+            errorReporting.add("Fatal error during loading of Property from serialized data: corrupt child data!");
+            return nullptr;
         }
 
-        deserializationMap.storePropertyImpl(prop, *impl);
+        deserializationMap.storePropertyTree(propertyTree, std::move(propertiesByIndex));
 
-        return impl;
+        return std::move(properties[0]);
     }
 
     size_t PropertyImpl::getChildCount() const
@@ -469,7 +461,8 @@ namespace rlogic::internal
 
     bool PropertyImpl::setValue_PublicApi(PropertyValue value)
     {
-        if (m_semantics == EPropertySemantics::ScriptOutput)
+        const bool isOutput = (m_semantics == EPropertySemantics::ScriptOutput);
+        if (isOutput && !(m_logicNode && m_logicNode->acceptsOutputValuesFromApi()))
         {
             LOG_ERROR(fmt::format("Cannot set property '{}' which is an output.", m_name));
             return false;
@@ -493,7 +486,8 @@ namespace rlogic::internal
             return false;
         }
 
-        setValue(std::move(value), true);
+        // Outputs don't mark their own node dirty, same as when set by scripts
+        setValue(std::move(value), !isOutput);
 
         return true;
     }
@@ -523,6 +517,7 @@ namespace rlogic::internal
             if (m_value != value)
             {
                 m_value = std::move(value);
+                ++m_changeVersion;
                 m_logicNode->setDirty(true);
             }
 
@@ -533,9 +528,31 @@ namespace rlogic::internal
                 m_logicNode->setDirty(true);
             }
         }
-        else
+        else if (m_value != value)
+        {
+            // Outputs don't mark their node dirty, but increase the version so that links and change tracking see the change
+            m_value = std::move(value);
+            ++m_changeVersion;
+        }
+    }
+
+    void PropertyImpl::restoreSnapshotValue(PropertyValue value, bool bindingInputHasNewValue)
+    {
+        assert(m_value.index() == value.index());
+        assert(TypeUtils::IsPrimitiveType(m_type));
+
+        const bool valueChanged = (m_value != value);
+        if (valueChanged)
         {
             m_value = std::move(value);
+            ++m_changeVersion;
+        }
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            // The bound Ramses object holds the value which was set before restoring, it has to receive
+            // the restored value on next update. A value which was pending before restoring is kept pending too.
+            m_bindingInputHasNewValue = m_bindingInputHasNewValue || bindingInputHasNewValue || valueChanged;
         }
     }
 
@@ -596,9 +613,42 @@ namespace rlogic::internal
         return deepCopy;
     }
 
+    bool PropertyImpl::hasSameStructureAs(const PropertyImpl& other) const
+    {
+        if (m_name != other.m_name || m_type != other.m_type || m_children.size() != other.m_children.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_children.size(); ++i)
+        {
+            if (!m_children[i]->m_impl->hasSameStructureAs(*other.m_children[i]->m_impl))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     const PropertyValue& PropertyImpl::getValue() const
     {
         return m_value;
     }
 
+    uint64_t PropertyImpl::getChangeVersion() const
+    {
+        return m_changeVersion;
+    }
+
+    void PropertyImpl::setOutputChangesSubscribed(bool subscribed)
+    {
+        m_outputChangesSubscribed = subscribed;
+    }
+
+    bool PropertyImpl::isOutputChangesSubscribed() const
+    {
+        return m_outputChangesSubscribed;
+    }
+
 }
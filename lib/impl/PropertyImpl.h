@@ -14,6 +14,7 @@
 #include "internals/DeserializationMap.h"
 
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,7 +28,7 @@ namespace rlogic
 }
 namespace rlogic_serialization
 {
-    struct Property;
+    struct PropertyTree;
 }
 
 namespace flatbuffers
@@ -49,13 +50,14 @@ namespace rlogic::internal
         PropertyImpl(std::string_view name, EPropertyType type, EPropertySemantics semantics);
         PropertyImpl(std::string_view name, EPropertyType type, EPropertySemantics semantics, PropertyValue initialValue);
 
-        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> Serialize(
+        // Serializes the property and all its children as a flat property tree
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::PropertyTree> Serialize(
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap);
 
         [[nodiscard]] static std::unique_ptr<PropertyImpl> Deserialize(
-            const rlogic_serialization::Property& prop,
+            const rlogic_serialization::PropertyTree& propertyTree,
             EPropertySemantics semantics,
             ErrorReporting& errorReporting,
             DeserializationMap& deserializationMap);
@@ -71,6 +73,9 @@ namespace rlogic::internal
         // Creates a data copy of itself and its children on new memory
         [[nodiscard]] std::unique_ptr<PropertyImpl> deepCopy() const;
 
+        // Compares names and types of itself and all children, ignoring values
+        [[nodiscard]] bool hasSameStructureAs(const PropertyImpl& other) const;
+
         [[nodiscard]] size_t getChildCount() const;
         [[nodiscard]] EPropertyType getType() const;
         [[nodiscard]] std::string_view getName() const;
@@ -102,8 +107,13 @@ namespace rlogic::internal
         // Generic setter. Can optionally skip dirty-check
         void setValue(PropertyValue value, bool checkDirty = true);
 
+        // Restores a value captured in a value snapshot, without marking the logic node dirty
+        void restoreSnapshotValue(PropertyValue value, bool bindingInputHasNewValue);
+
         // Generic getter for use in other non-template code
         [[nodiscard]] const PropertyValue& getValue() const;
+        // Increases with every change of the value, links use it to skip sources which didn't change since the last propagation
+        [[nodiscard]] uint64_t getChangeVersion() const;
         // std::get wrapper for use in template code
         template <typename T>
         [[nodiscard]] const T& getValueAs() const
@@ -111,6 +121,10 @@ namespace rlogic::internal
             return std::get<T>(m_value);
         }
 
+        // Outputs can be subscribed individually to be reported by LogicEngine::getChangedOutputs()
+        void setOutputChangesSubscribed(bool subscribed);
+        [[nodiscard]] bool isOutputChangesSubscribed() const;
+
         // Design smells (can fix by changing class design and topology)
         void setIsLinkedInput(bool isLinkedInput);
         void setLogicNode(LogicNodeImpl& logicNode);
@@ -121,16 +135,13 @@ namespace rlogic::internal
         EPropertyType                                   m_type;
         std::vector<std::unique_ptr<Property>>          m_children;
         PropertyValue                                   m_value;
+        uint64_t                                        m_changeVersion = 0u;
 
         // TODO Violin/Sven consider solving this more elegantly
         LogicNodeImpl*                                  m_logicNode = nullptr;
         bool m_bindingInputHasNewValue = false;
         bool m_isLinkedInput = false;
+        bool m_outputChangesSubscribed = false;
         EPropertySemantics                              m_semantics;
-
-        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> SerializeRecursive(
-            const PropertyImpl& prop,
-            flatbuffers::FlatBufferBuilder& builder,
-            SerializationMap& serializationMap);
     };
 }
@@ -87,7 +87,7 @@ namespace rlogic::internal
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(binding.m_ramsesAppearance, builder);
 
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
-            builder.CreateString(binding.getName()),
+            builder.CreateSharedString(binding.getName().data(), binding.getName().size()),
             ramsesReference,
             // TODO Violin don't serialize these - they carry no useful information and are redundant
             PropertyImpl::Serialize(*binding.getInputs()->m_impl, builder, serializationMap));
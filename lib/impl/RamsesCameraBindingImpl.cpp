@@ -78,7 +78,7 @@ namespace rlogic::internal
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(cameraBinding.m_ramsesCamera, builder);
 
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
-            builder.CreateString(cameraBinding.getName()),
+            builder.CreateSharedString(cameraBinding.getName().data(), cameraBinding.getName().size()),
             ramsesReference,
             // TODO Violin don't serialize these - they carry no useful information and are redundant
             PropertyImpl::Serialize(*cameraBinding.getInputs()->m_impl, builder, serializationMap));
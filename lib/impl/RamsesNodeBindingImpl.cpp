@@ -45,7 +45,7 @@ namespace rlogic::internal
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(nodeBinding.m_ramsesNode, builder);
 
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
-            builder.CreateString(nodeBinding.getName()),
+            builder.CreateSharedString(nodeBinding.getName().data(), nodeBinding.getName().size()),
             ramsesReference,
             // TODO Violin don't serialize inputs - it's better to re-create them on the fly, they are uniquely defined and don't need serialization
             PropertyImpl::Serialize(*nodeBinding.getInputs()->m_impl, builder, serializationMap));
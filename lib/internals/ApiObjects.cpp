@@ -16,12 +16,18 @@
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include "impl/PropertyImpl.h"
 #include "impl/LuaScriptImpl.h"
 #include "impl/RamsesNodeBindingImpl.h"
 #include "impl/RamsesAppearanceBindingImpl.h"
 #include "impl/RamsesCameraBindingImpl.h"
+#include "impl/NativeLogicNodeImpl.h"
+#include "impl/AnimationNodeImpl.h"
+#include "impl/ExpressionNodeImpl.h"
 
 #include "ramses-client-api/Node.h"
 #include "ramses-client-api/Appearance.h"
@@ -34,6 +40,9 @@
 #include "generated/RamsesCameraBindingGen.h"
 #include "generated/RamsesNodeBindingGen.h"
 #include "generated/LinkGen.h"
+#include "generated/NativeLogicNodeGen.h"
+#include "generated/AnimationNodeGen.h"
+#include "generated/ExpressionNodeGen.h"
 
 #include "fmt/format.h"
 
@@ -77,10 +86,35 @@ namespace rlogic::internal
         return binding;
     }
 
+    NativeLogicNode* ApiObjects::createNativeLogicNode(std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type, std::string_view name)
+    {
+        m_nativeLogicNodes.emplace_back(std::make_unique<NativeLogicNode>(std::make_unique<NativeLogicNodeImpl>(name, typeName, std::move(type))));
+        NativeLogicNode* nativeNode = m_nativeLogicNodes.back().get();
+        registerLogicNode(*nativeNode);
+        return nativeNode;
+    }
+
+    AnimationNode* ApiObjects::createAnimationNode(const AnimationChannels& channels, std::string_view name)
+    {
+        m_animationNodes.emplace_back(std::make_unique<AnimationNode>(std::make_unique<AnimationNodeImpl>(name, channels)));
+        AnimationNode* animationNode = m_animationNodes.back().get();
+        registerLogicNode(*animationNode);
+        return animationNode;
+    }
+
+    ExpressionNode* ApiObjects::createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, ExpressionProgram program, std::string_view name)
+    {
+        m_expressionNodes.emplace_back(std::make_unique<ExpressionNode>(std::make_unique<ExpressionNodeImpl>(name, source, inputs, outputs, std::move(program))));
+        ExpressionNode* expressionNode = m_expressionNodes.back().get();
+        registerLogicNode(*expressionNode);
+        return expressionNode;
+    }
+
     void ApiObjects::registerLogicNode(LogicNode& logicNode)
     {
         m_reverseImplMapping.emplace(std::make_pair(&logicNode.m_impl.get(), &logicNode));
         m_logicNodeDependencies.addNode(logicNode.m_impl);
+        m_structureHash.reset();
     }
 
     void ApiObjects::unregisterLogicNode(LogicNode& logicNode)
@@ -91,6 +125,17 @@ namespace rlogic::internal
         m_reverseImplMapping.erase(implIter);
 
         m_logicNodeDependencies.removeNode(logicNodeImpl);
+        m_structureHash.reset();
+    }
+
+    std::optional<uint64_t> ApiObjects::getCachedStructureHash() const
+    {
+        return m_structureHash;
+    }
+
+    void ApiObjects::setCachedStructureHash(uint64_t structureHash) const
+    {
+        m_structureHash = structureHash;
     }
 
     bool ApiObjects::destroy(LogicNode& logicNode, ErrorReporting& errorReporting)
@@ -128,6 +173,30 @@ namespace rlogic::internal
             }
         }
 
+        {
+            auto nativeLogicNode = dynamic_cast<NativeLogicNode*>(&logicNode);
+            if (nullptr != nativeLogicNode)
+            {
+                return destroyInternal(*nativeLogicNode, errorReporting);
+            }
+        }
+
+        {
+            auto animationNode = dynamic_cast<AnimationNode*>(&logicNode);
+            if (nullptr != animationNode)
+            {
+                return destroyInternal(*animationNode, errorReporting);
+            }
+        }
+
+        {
+            auto expressionNode = dynamic_cast<ExpressionNode*>(&logicNode);
+            if (nullptr != expressionNode)
+            {
+                return destroyInternal(*expressionNode, errorReporting);
+            }
+        }
+
         errorReporting.add(fmt::format("Tried to destroy object '{}' with unknown type", logicNode.getName()), logicNode);
         return false;
     }
@@ -143,11 +212,7 @@ namespace rlogic::internal
             return false;
         }
 
-        auto implIter = m_reverseImplMapping.find(&luaScript.m_impl.get());
-        assert(implIter != m_reverseImplMapping.end());
-        m_reverseImplMapping.erase(implIter);
-
-        m_logicNodeDependencies.removeNode(luaScript.m_impl);
+        unregisterLogicNode(luaScript);
         m_scripts.erase(scriptIter);
         return true;
     }
@@ -207,6 +272,60 @@ namespace rlogic::internal
         return true;
     }
 
+    bool ApiObjects::destroyInternal(NativeLogicNode& nativeLogicNode, ErrorReporting& errorReporting)
+    {
+        auto nodeIter = find_if(m_nativeLogicNodes.begin(), m_nativeLogicNodes.end(), [&](const std::unique_ptr<NativeLogicNode>& nativeNode) {
+            return nativeNode.get() == &nativeLogicNode;
+        });
+
+        if (nodeIter == m_nativeLogicNodes.end())
+        {
+            errorReporting.add("Can't find NativeLogicNode in logic engine!");
+            return false;
+        }
+
+        unregisterLogicNode(nativeLogicNode);
+        m_nativeLogicNodes.erase(nodeIter);
+
+        return true;
+    }
+
+    bool ApiObjects::destroyInternal(AnimationNode& animationNode, ErrorReporting& errorReporting)
+    {
+        auto nodeIter = find_if(m_animationNodes.begin(), m_animationNodes.end(), [&](const std::unique_ptr<AnimationNode>& node) {
+            return node.get() == &animationNode;
+        });
+
+        if (nodeIter == m_animationNodes.end())
+        {
+            errorReporting.add("Can't find AnimationNode in logic engine!");
+            return false;
+        }
+
+        unregisterLogicNode(animationNode);
+        m_animationNodes.erase(nodeIter);
+
+        return true;
+    }
+
+    bool ApiObjects::destroyInternal(ExpressionNode& expressionNode, ErrorReporting& errorReporting)
+    {
+        auto nodeIter = find_if(m_expressionNodes.begin(), m_expressionNodes.end(), [&](const std::unique_ptr<ExpressionNode>& node) {
+            return node.get() == &expressionNode;
+        });
+
+        if (nodeIter == m_expressionNodes.end())
+        {
+            errorReporting.add("Can't find ExpressionNode in logic engine!");
+            return false;
+        }
+
+        unregisterLogicNode(expressionNode);
+        m_expressionNodes.erase(nodeIter);
+
+        return true;
+    }
+
     bool ApiObjects::checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const
     {
         // Optional because it's OK that no Ramses object is referenced at all (and thus no ramses scene)
@@ -306,6 +425,36 @@ namespace rlogic::internal
         return m_ramsesCameraBindings;
     }
 
+    NativeLogicNodesContainer& ApiObjects::getNativeLogicNodes()
+    {
+        return m_nativeLogicNodes;
+    }
+
+    const NativeLogicNodesContainer& ApiObjects::getNativeLogicNodes() const
+    {
+        return m_nativeLogicNodes;
+    }
+
+    AnimationNodesContainer& ApiObjects::getAnimationNodes()
+    {
+        return m_animationNodes;
+    }
+
+    const AnimationNodesContainer& ApiObjects::getAnimationNodes() const
+    {
+        return m_animationNodes;
+    }
+
+    ExpressionNodesContainer& ApiObjects::getExpressionNodes()
+    {
+        return m_expressionNodes;
+    }
+
+    const ExpressionNodesContainer& ApiObjects::getExpressionNodes() const
+    {
+        return m_expressionNodes;
+    }
+
     LogicNodeDependencies& ApiObjects::getLogicNodeDependencies()
     {
         return m_logicNodeDependencies;
@@ -370,6 +519,36 @@ namespace rlogic::internal
                 return RamsesCameraBindingImpl::Serialize(*it->m_cameraBinding, builder, serializationMap);
             });
 
+        std::vector<flatbuffers::Offset<rlogic_serialization::NativeLogicNode>> nativeNodes;
+        nativeNodes.reserve(apiObjects.m_nativeLogicNodes.size());
+
+        std::transform(apiObjects.m_nativeLogicNodes.begin(),
+            apiObjects.m_nativeLogicNodes.end(),
+            std::back_inserter(nativeNodes),
+            [&builder, &serializationMap](const std::vector<std::unique_ptr<NativeLogicNode>>::value_type& it) {
+                return NativeLogicNodeImpl::Serialize(*it->m_nativeNode, builder, serializationMap);
+            });
+
+        std::vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> animationNodes;
+        animationNodes.reserve(apiObjects.m_animationNodes.size());
+
+        std::transform(apiObjects.m_animationNodes.begin(),
+            apiObjects.m_animationNodes.end(),
+            std::back_inserter(animationNodes),
+            [&builder, &serializationMap](const std::vector<std::unique_ptr<AnimationNode>>::value_type& it) {
+                return AnimationNodeImpl::Serialize(*it->m_animationNode, builder, serializationMap);
+            });
+
+        std::vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> expressionNodes;
+        expressionNodes.reserve(apiObjects.m_expressionNodes.size());
+
+        std::transform(apiObjects.m_expressionNodes.begin(),
+            apiObjects.m_expressionNodes.end(),
+            std::back_inserter(expressionNodes),
+            [&builder, &serializationMap](const std::vector<std::unique_ptr<ExpressionNode>>::value_type& it) {
+                return ExpressionNodeImpl::Serialize(*it->m_expressionNode, builder, serializationMap);
+            });
+
         const LinksMap& allLinks = apiObjects.m_logicNodeDependencies.getLinks();
 
         std::vector<flatbuffers::Offset<rlogic_serialization::Link>> links;
@@ -377,9 +556,16 @@ namespace rlogic::internal
 
         for (const auto& link : allLinks)
         {
+            const SerializedPropertyLocation source = serializationMap.resolvePropertyLocation(*link.second.source);
+            const SerializedPropertyLocation target = serializationMap.resolvePropertyLocation(*link.first);
             links.emplace_back(rlogic_serialization::CreateLink(builder,
-                serializationMap.resolvePropertyOffset(*link.second),
-                serializationMap.resolvePropertyOffset(*link.first)));
+                source.tree,
+                source.index,
+                target.tree,
+                target.index,
+                static_cast<rlogic_serialization::ELinkKind>(link.second.kind),
+                link.second.sourceComponent,
+                link.second.targetComponent));
         }
 
         const auto logicEngine = rlogic_serialization::CreateApiObjects(
@@ -388,7 +574,11 @@ namespace rlogic::internal
             builder.CreateVector(ramsesnodebindings),
             builder.CreateVector(ramsesappearancebindings),
             builder.CreateVector(ramsescamerabindings),
-            builder.CreateVector(links)
+            builder.CreateVector(links),
+            builder.CreateVectorOfStrings(serializationMap.getStrings()),
+            builder.CreateVector(nativeNodes),
+            builder.CreateVector(animationNodes),
+            builder.CreateVector(expressionNodes)
         );
 
         builder.Finish(logicEngine);
@@ -401,7 +591,9 @@ namespace rlogic::internal
         const rlogic_serialization::ApiObjects& apiObjects,
         const IRamsesObjectResolver& ramsesResolver,
         const std::string& dataSourceDescription,
-        ErrorReporting& errorReporting)
+        ErrorReporting& errorReporting,
+        bool deferScriptCompilation,
+        const NativeLogicNodeTypes& nativeLogicNodeTypes)
     {
         // Collect data here, only return if no error occurred
         ApiObjects deserialized;
@@ -439,6 +631,25 @@ namespace rlogic::internal
             return std::nullopt;
         }
 
+        if (!apiObjects.strings())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing strings container!");
+            return std::nullopt;
+        }
+
+        std::vector<std::string_view> strings;
+        strings.reserve(apiObjects.strings()->size());
+        for (const auto* str : *apiObjects.strings())
+        {
+            if (!str)
+            {
+                errorReporting.add("Fatal error during loading from serialized data: corrupt string data!");
+                return std::nullopt;
+            }
+            strings.emplace_back(str->string_view());
+        }
+        deserializationMap.storeStrings(std::move(strings));
+
         const auto& luascripts = *apiObjects.luaScripts();
         deserialized.m_scripts.reserve(luascripts.size());
 
@@ -447,7 +658,7 @@ namespace rlogic::internal
             // TODO Violin find ways to unit-test this case - also for other container types
             // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
             assert (script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(solState, *script, errorReporting, deserializationMap);
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(solState, *script, errorReporting, deserializationMap, deferScriptCompilation);
 
             if (deserializedScript)
             {
@@ -520,6 +731,75 @@ namespace rlogic::internal
             }
         }
 
+        // Optional, because files without native nodes don't need the container
+        if (apiObjects.nativeNodes())
+        {
+            const auto& nativeNodes = *apiObjects.nativeNodes();
+            deserialized.m_nativeLogicNodes.reserve(nativeNodes.size());
+
+            for (const auto* nativeNode : nativeNodes)
+            {
+                assert(nativeNode);
+                std::unique_ptr<NativeLogicNodeImpl> deserializedNode = NativeLogicNodeImpl::Deserialize(*nativeNode, nativeLogicNodeTypes, errorReporting, deserializationMap);
+
+                if (deserializedNode)
+                {
+                    deserialized.m_nativeLogicNodes.emplace_back(std::make_unique<NativeLogicNode>(std::move(deserializedNode)));
+                    deserialized.registerLogicNode(*deserialized.m_nativeLogicNodes.back());
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Optional, because files without animation nodes don't need the container
+        if (apiObjects.animationNodes())
+        {
+            const auto& animationNodes = *apiObjects.animationNodes();
+            deserialized.m_animationNodes.reserve(animationNodes.size());
+
+            for (const auto* animationNode : animationNodes)
+            {
+                assert(animationNode);
+                std::unique_ptr<AnimationNodeImpl> deserializedNode = AnimationNodeImpl::Deserialize(*animationNode, errorReporting, deserializationMap);
+
+                if (deserializedNode)
+                {
+                    deserialized.m_animationNodes.emplace_back(std::make_unique<AnimationNode>(std::move(deserializedNode)));
+                    deserialized.registerLogicNode(*deserialized.m_animationNodes.back());
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Optional, because files without expression nodes don't need the container
+        if (apiObjects.expressionNodes())
+        {
+            const auto& expressionNodes = *apiObjects.expressionNodes();
+            deserialized.m_expressionNodes.reserve(expressionNodes.size());
+
+            for (const auto* expressionNode : expressionNodes)
+            {
+                assert(expressionNode);
+                std::unique_ptr<ExpressionNodeImpl> deserializedNode = ExpressionNodeImpl::Deserialize(*expressionNode, errorReporting, deserializationMap);
+
+                if (deserializedNode)
+                {
+                    deserialized.m_expressionNodes.emplace_back(std::make_unique<ExpressionNode>(std::move(deserializedNode)));
+                    deserialized.registerLogicNode(*deserialized.m_expressionNodes.back());
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
         const auto& links = *apiObjects.links();
 
         // TODO Violin move this code (serialization parts too) to LogicNodeDependencies
@@ -527,24 +807,40 @@ namespace rlogic::internal
         {
             assert(rLink);
 
-            if (!rLink->sourceProperty())
+            if (!rLink->sourceTree())
             {
                 errorReporting.add("Fatal error during loading from serialized data: missing link source property!");
                 return std::nullopt;
             }
 
-            if (!rLink->targetProperty())
+            if (!rLink->targetTree())
             {
                 errorReporting.add("Fatal error during loading from serialized data: missing link target property!");
                 return std::nullopt;
             }
 
-            const rlogic_serialization::Property* sourceProp = rLink->sourceProperty();
-            const rlogic_serialization::Property* targetProp = rLink->targetProperty();
+            PropertyImpl* sourceProp = deserializationMap.resolvePropertyImpl(*rLink->sourceTree(), rLink->sourceIndex());
+            PropertyImpl* targetProp = deserializationMap.resolvePropertyImpl(*rLink->targetTree(), rLink->targetIndex());
+
+            if (!sourceProp || !targetProp)
+            {
+                errorReporting.add("Fatal error during loading from serialized data: link refers to an unknown property!");
+                return std::nullopt;
+            }
+
+            if (flatbuffers::IsOutRange(rLink->kind(), rlogic_serialization::ELinkKind::MIN, rlogic_serialization::ELinkKind::MAX))
+            {
+                errorReporting.add("Fatal error during loading from serialized data: invalid link kind!");
+                return std::nullopt;
+            }
 
+            // Component indices and type conversions are validated by link() the same way as when they were created
             const bool success = deserialized.m_logicNodeDependencies.link(
-                deserializationMap.resolvePropertyImpl(*sourceProp),
-                deserializationMap.resolvePropertyImpl(*targetProp),
+                *sourceProp,
+                *targetProp,
+                static_cast<ELinkKind>(rLink->kind()),
+                rLink->sourceComponent(),
+                rLink->targetComponent(),
                 errorReporting);
             // TODO Violin handle (and unit test!) this error properly. Consider these error cases:
             // - maliciously forged properties (not attached to any node anywhere)
@@ -554,8 +850,8 @@ namespace rlogic::internal
                 errorReporting.add(
                     fmt::format("Fatal error during loading from {}! Could not link property '{}' to property '{}'!",
                         dataSourceDescription,
-                        sourceProp->name()->string_view(),
-                        targetProp->name()->string_view()
+                        sourceProp->getName(),
+                        targetProp->getName()
                     ));
                 return std::nullopt;
             }
@@ -570,6 +866,9 @@ namespace rlogic::internal
         // TODO Violin improve internal management of logic nodes so that we don't have to loop over three
         // different containers below which all call a method on LogicNode
         return std::any_of(m_scripts.cbegin(), m_scripts.cend(), [](const auto& s) { return s->m_impl.get().isDirty(); })
+            || std::any_of(m_nativeLogicNodes.cbegin(), m_nativeLogicNodes.cend(), [](const auto& n) { return n->m_impl.get().isDirty(); })
+            || std::any_of(m_animationNodes.cbegin(), m_animationNodes.cend(), [](const auto& n) { return n->m_impl.get().isDirty(); })
+            || std::any_of(m_expressionNodes.cbegin(), m_expressionNodes.cend(), [](const auto& n) { return n->m_impl.get().isDirty(); })
             || bindingsDirty();
     }
 
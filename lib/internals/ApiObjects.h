@@ -9,10 +9,15 @@
 #pragma once
 
 #include "LogicNodeDependencies.h"
+#include "impl/NativeLogicNodeImpl.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include <vector>
 #include <memory>
 #include <string_view>
+#include <optional>
+#include <cstdint>
 
 namespace ramses
 {
@@ -29,6 +34,9 @@ namespace rlogic
     class RamsesNodeBinding;
     class RamsesAppearanceBinding;
     class RamsesCameraBinding;
+    class NativeLogicNode;
+    class AnimationNode;
+    class ExpressionNode;
 }
 
 namespace rlogic_serialization
@@ -46,11 +54,15 @@ namespace rlogic::internal
 {
     class SolState;
     class IRamsesObjectResolver;
+    struct ExpressionProgram;
 
     using ScriptsContainer = std::vector<std::unique_ptr<LuaScript>>;
     using NodeBindingsContainer = std::vector<std::unique_ptr<RamsesNodeBinding>>;
     using AppearanceBindingsContainer = std::vector<std::unique_ptr<RamsesAppearanceBinding>>;
     using CameraBindingsContainer = std::vector<std::unique_ptr<RamsesCameraBinding>>;
+    using NativeLogicNodesContainer = std::vector<std::unique_ptr<NativeLogicNode>>;
+    using AnimationNodesContainer = std::vector<std::unique_ptr<AnimationNode>>;
+    using ExpressionNodesContainer = std::vector<std::unique_ptr<ExpressionNode>>;
 
     class ApiObjects
     {
@@ -72,13 +84,18 @@ namespace rlogic::internal
             const rlogic_serialization::ApiObjects& apiObjects,
             const IRamsesObjectResolver& ramsesResolver,
             const std::string& dataSourceDescription,
-            ErrorReporting& errorReporting);
+            ErrorReporting& errorReporting,
+            bool deferScriptCompilation = false,
+            const NativeLogicNodeTypes& nativeLogicNodeTypes = NativeLogicNodeTypes());
 
         // Create/destroy API objects
         LuaScript* createLuaScript(SolState& solState, std::string_view source, std::string_view filename, std::string_view scriptName, ErrorReporting& errorReporting);
         RamsesNodeBinding* createRamsesNodeBinding(ramses::Node& ramsesNode, std::string_view name);
         RamsesAppearanceBinding* createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name);
         RamsesCameraBinding* createRamsesCameraBinding(ramses::Camera& ramsesCamera, std::string_view name);
+        NativeLogicNode* createNativeLogicNode(std::string_view typeName, std::shared_ptr<const NativeLogicNodeType> type, std::string_view name);
+        AnimationNode* createAnimationNode(const AnimationChannels& channels, std::string_view name);
+        ExpressionNode* createExpressionNode(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs, ExpressionProgram program, std::string_view name);
         bool destroy(LogicNode& logicNode, ErrorReporting& errorReporting);
 
         // Invariance checks
@@ -93,12 +110,23 @@ namespace rlogic::internal
         [[nodiscard]] const AppearanceBindingsContainer& getAppearanceBindings() const;
         [[nodiscard]] CameraBindingsContainer& getCameraBindings();
         [[nodiscard]] const CameraBindingsContainer& getCameraBindings() const;
+        [[nodiscard]] NativeLogicNodesContainer& getNativeLogicNodes();
+        [[nodiscard]] const NativeLogicNodesContainer& getNativeLogicNodes() const;
+        [[nodiscard]] AnimationNodesContainer& getAnimationNodes();
+        [[nodiscard]] const AnimationNodesContainer& getAnimationNodes() const;
+        [[nodiscard]] ExpressionNodesContainer& getExpressionNodes();
+        [[nodiscard]] const ExpressionNodesContainer& getExpressionNodes() const;
 
         [[nodiscard]] const LogicNodeDependencies& getLogicNodeDependencies() const;
         [[nodiscard]] LogicNodeDependencies& getLogicNodeDependencies();
 
         [[nodiscard]] LogicNode* getApiObject(LogicNodeImpl& impl) const;
 
+        // Cache of ValueSnapshot::ComputeStructureHash, reset whenever a logic node is added or removed
+        // (the properties of a node don't change after it was created)
+        [[nodiscard]] std::optional<uint64_t> getCachedStructureHash() const;
+        void setCachedStructureHash(uint64_t structureHash) const;
+
         // Internally used
         [[nodiscard]] bool isDirty() const;
         [[nodiscard]] bool bindingsDirty() const;
@@ -116,13 +144,20 @@ namespace rlogic::internal
         [[nodiscard]] bool destroyInternal(LuaScript& luaScript, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(RamsesAppearanceBinding& ramsesAppearanceBinding, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(RamsesCameraBinding& ramsesCameraBinding, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(NativeLogicNode& nativeLogicNode, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(AnimationNode& animationNode, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(ExpressionNode& expressionNode, ErrorReporting& errorReporting);
 
         ScriptsContainer                    m_scripts;
         NodeBindingsContainer               m_ramsesNodeBindings;
         AppearanceBindingsContainer         m_ramsesAppearanceBindings;
         CameraBindingsContainer             m_ramsesCameraBindings;
+        NativeLogicNodesContainer           m_nativeLogicNodes;
+        AnimationNodesContainer             m_animationNodes;
+        ExpressionNodesContainer            m_expressionNodes;
         LogicNodeDependencies               m_logicNodeDependencies;
 
         std::unordered_map<LogicNodeImpl*, LogicNode*> m_reverseImplMapping;
+        mutable std::optional<uint64_t> m_structureHash;
     };
 }
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Bounded lock-free queue (Vyukov's array based queue). Any number of threads can push and pop. Each cell carries a
+    // sequence number which tells producers and consumers whose turn it is, so that neither side ever waits for a lock.
+    // The payloads of the cells are constructed once and reused, push and pop access the payload of the claimed cell
+    // in place (e.g. to copy a string into memory which the cell already owns)
+    template <typename Payload>
+    class BoundedMpmcQueue
+    {
+    public:
+        // Capacity is rounded up to the next power of two
+        explicit BoundedMpmcQueue(size_t capacity)
+            : m_cells(RoundUpToPowerOfTwo(capacity < 2u ? 2u : capacity))
+            , m_mask(m_cells.size() - 1u)
+        {
+            for (size_t i = 0; i < m_cells.size(); ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // Not copy-able and not move-able (producers hold references to it)
+        BoundedMpmcQueue(const BoundedMpmcQueue& other) = delete;
+        BoundedMpmcQueue& operator=(const BoundedMpmcQueue& other) = delete;
+        BoundedMpmcQueue(BoundedMpmcQueue&& other) = delete;
+        BoundedMpmcQueue& operator=(BoundedMpmcQueue&& other) = delete;
+        ~BoundedMpmcQueue() noexcept = default;
+
+        // Thread-safe, calls write(Payload&) for the claimed cell, returns false if the queue is full
+        template <typename Writer>
+        [[nodiscard]] bool push(Writer&& write)
+        {
+            size_t position = m_pushPosition.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0)
+                {
+                    // Cell is free for this position, claim it
+                    if (m_pushPosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // Cell still holds a payload of the previous round -> queue is full
+                    return false;
+                }
+                else
+                {
+                    // Another producer claimed this position
+                    position = m_pushPosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            write(cell->payload);
+            cell->sequence.store(position + 1u, std::memory_order_release);
+            return true;
+        }
+
+        // Thread-safe, calls read(Payload&) for the claimed cell, returns false if the queue is empty
+        template <typename Reader>
+        [[nodiscard]] bool pop(Reader&& read)
+        {
+            size_t position = m_popPosition.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1u);
+                if (difference == 0)
+                {
+                    if (m_popPosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // Payload for this position not published yet -> queue is empty
+                    return false;
+                }
+                else
+                {
+                    position = m_popPosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            read(cell->payload);
+            // Free the cell for the push of the next round
+            cell->sequence.store(position + m_mask + 1u, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] size_t capacity() const
+        {
+            return m_cells.size();
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0u};
+            Payload payload;
+        };
+
+        static size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1u;
+            while (result < value)
+            {
+                result <<= 1u;
+            }
+            return result;
+        }
+
+        // Producer and consumer positions on separate cache lines, so that they don't slow down each other
+        static constexpr size_t CacheLineSize = 64u;
+
+        std::vector<Cell> m_cells;
+        size_t m_mask = 0u;
+        alignas(CacheLineSize) std::atomic<size_t> m_pushPosition{0u};
+        alignas(CacheLineSize) std::atomic<size_t> m_popPosition{0u};
+    };
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/CompiledChunkCache.h"
+
+#include "ramses-logic/Property.h"
+
+namespace rlogic::internal
+{
+    CompiledChunkCache::CompiledChunkCache()
+        : m_chunks(std::make_shared<ChunkMap>())
+    {
+    }
+
+    std::shared_ptr<CompiledChunk> CompiledChunkCache::get(std::string_view source)
+    {
+        const auto existingChunk = m_chunks->find(source);
+        if (existingChunk != m_chunks->end())
+        {
+            // Never expired, the deleter removes entries when their last user releases them
+            return existingChunk->second.lock();
+        }
+
+        std::weak_ptr<ChunkMap> chunks = m_chunks;
+        std::shared_ptr<CompiledChunk> chunk(new CompiledChunk{std::string(source), {}, nullptr, nullptr}, [chunks](CompiledChunk* unusedChunk) {
+            if (const std::shared_ptr<ChunkMap> chunkMap = chunks.lock())
+            {
+                chunkMap->erase(unusedChunk->source);
+            }
+            delete unusedChunk;
+        });
+        m_chunks->emplace(chunk->source, chunk);
+        return chunk;
+    }
+
+    size_t CompiledChunkCache::size() const
+    {
+        return m_chunks->size();
+    }
+}
@@ -0,0 +1,51 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/PropertyImpl.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <memory>
+
+namespace rlogic::internal
+{
+    struct CompiledChunk
+    {
+        // Key of the cache entry
+        std::string source;
+        // Precompiled main chunk, empty until the source was parsed successfully once. The chunk name in it is
+        // the one of the first script, SolState::loadScript replaces it with the name of the loaded script
+        std::string bytecode;
+        // Interface properties as extracted by interface(), empty until extracted once.
+        // New instances of the same script get a deep copy instead of executing interface() again
+        std::unique_ptr<PropertyImpl> inputsTemplate;
+        std::unique_ptr<PropertyImpl> outputsTemplate;
+    };
+
+    // Caches the results of script compilation for scripts with identical source code (independent of their names),
+    // so that further instances of the same script are created without parsing the source again.
+    // Entries are shared by the scripts which use them and removed when the last of them releases its entry, so that
+    // sources which failed to compile and sources of destroyed scripts don't stay in memory
+    class CompiledChunkCache
+    {
+    public:
+        CompiledChunkCache();
+
+        // Returns the existing entry or creates an empty one
+        [[nodiscard]] std::shared_ptr<CompiledChunk> get(std::string_view source);
+        [[nodiscard]] size_t size() const;
+
+    private:
+        // Keys refer to the source of their entry. Entries can outlive the cache, they only remove themselves while it exists
+        using ChunkMap = std::unordered_map<std::string_view, std::weak_ptr<CompiledChunk>>;
+        std::shared_ptr<ChunkMap> m_chunks;
+    };
+}
@@ -9,10 +9,14 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
+#include <string_view>
+#include <optional>
+#include <cassert>
 
 namespace rlogic_serialization
 {
-    struct Property;
+    struct PropertyTree;
 }
 
 namespace rlogic::internal
@@ -23,21 +27,41 @@ namespace rlogic::internal
     class DeserializationMap
     {
     public:
-        void storePropertyImpl(const rlogic_serialization::Property& flatbufferObject, PropertyImpl& impl)
+        // Properties are stored in the order of the records of their tree
+        void storePropertyTree(const rlogic_serialization::PropertyTree& flatbufferObject, std::vector<PropertyImpl*> impls)
         {
-            assert(m_properties.find(&flatbufferObject) == m_properties.end() && "never try to store the same object twice");
-            m_properties.emplace(std::make_pair(&flatbufferObject, &impl));
+            assert(m_propertyTrees.find(&flatbufferObject) == m_propertyTrees.end() && "never try to store the same object twice");
+            m_propertyTrees.emplace(std::make_pair(&flatbufferObject, std::move(impls)));
         }
 
-        PropertyImpl& resolvePropertyImpl(const rlogic_serialization::Property& flatbufferObject) const
+        // Returns nullptr if the tree was not deserialized or has no property with this index
+        [[nodiscard]] PropertyImpl* resolvePropertyImpl(const rlogic_serialization::PropertyTree& flatbufferObject, uint32_t index) const
         {
-            auto iter = m_properties.find(&flatbufferObject);
-            assert(iter != m_properties.end() && iter->second != nullptr);
-            return *iter->second;
+            auto iter = m_propertyTrees.find(&flatbufferObject);
+            if (iter == m_propertyTrees.end() || index >= iter->second.size())
+            {
+                return nullptr;
+            }
+            return iter->second[index];
+        }
+
+        void storeStrings(std::vector<std::string_view> strings)
+        {
+            m_strings = std::move(strings);
+        }
+
+        [[nodiscard]] std::optional<std::string_view> resolveString(uint32_t index) const
+        {
+            if (index >= m_strings.size())
+            {
+                return std::nullopt;
+            }
+            return m_strings[index];
         }
 
     private:
-        std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
+        std::unordered_map<const rlogic_serialization::PropertyTree*, std::vector<PropertyImpl*>> m_propertyTrees;
+        std::vector<std::string_view> m_strings;
     };
 
 }
@@ -0,0 +1,1380 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ExpressionCompiler.h"
+#include "internals/TypeUtils.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        enum class ETokenType
+        {
+            Number,
+            Identifier,
+            Plus,
+            Minus,
+            Star,
+            Slash,
+            Percent,
+            Less,
+            LessEqual,
+            Greater,
+            GreaterEqual,
+            Equal,
+            NotEqual,
+            Assign,
+            LeftParenthesis,
+            RightParenthesis,
+            Comma,
+            Dot,
+            Semicolon,
+            End
+        };
+
+        struct Token
+        {
+            ETokenType type = ETokenType::End;
+            std::string_view text;
+            size_t line = 1u;
+            size_t column = 1u;
+        };
+
+        // Register which holds the value of a (sub-)expression at runtime and the type of the value
+        struct Operand
+        {
+            uint16_t reg = 0u;
+            EPropertyType type = EPropertyType::Float;
+        };
+
+        constexpr size_t MaxRegisterCount = std::numeric_limits<uint16_t>::max();
+
+        bool IsFloatType(EPropertyType type)
+        {
+            return type == EPropertyType::Float || type == EPropertyType::Vec2f || type == EPropertyType::Vec3f || type == EPropertyType::Vec4f;
+        }
+
+        bool IsNumericType(EPropertyType type)
+        {
+            return IsFloatType(type) || type == EPropertyType::Int32;
+        }
+
+        EPropertyType FloatTypeOfSize(size_t size)
+        {
+            switch (size)
+            {
+            case 2u:
+                return EPropertyType::Vec2f;
+            case 3u:
+                return EPropertyType::Vec3f;
+            case 4u:
+                return EPropertyType::Vec4f;
+            default:
+                return EPropertyType::Float;
+            }
+        }
+
+        // Names of the types as they are called in expressions
+        std::string_view TypeName(EPropertyType type)
+        {
+            switch (type)
+            {
+            case EPropertyType::Float:
+                return "float";
+            case EPropertyType::Vec2f:
+                return "vec2";
+            case EPropertyType::Vec3f:
+                return "vec3";
+            case EPropertyType::Vec4f:
+                return "vec4";
+            case EPropertyType::Int32:
+                return "int";
+            case EPropertyType::Bool:
+                return "bool";
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                break;
+            }
+            return "unsupported type";
+        }
+
+        std::string TypeNames(const std::vector<Operand>& operands)
+        {
+            std::string names;
+            for (size_t i = 0; i < operands.size(); ++i)
+            {
+                if (i > 0)
+                {
+                    names += (i + 1 == operands.size()) ? " and " : ", ";
+                }
+                names += TypeName(operands[i].type);
+            }
+            return names;
+        }
+
+        bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        bool IsIdentifierStart(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        bool IsIdentifierCharacter(char c)
+        {
+            return IsIdentifierStart(c) || IsDigit(c);
+        }
+
+        bool IsIdentifier(std::string_view text)
+        {
+            return !text.empty() && IsIdentifierStart(text.front()) && std::all_of(text.cbegin(), text.cend(), IsIdentifierCharacter);
+        }
+
+        bool IsKeyword(std::string_view text)
+        {
+            return text == "and" || text == "or" || text == "not" || text == "true" || text == "false";
+        }
+
+        std::string FormatError(const Token& token, std::string_view message)
+        {
+            return fmt::format("line {}, column {}: {}", token.line, token.column, message);
+        }
+
+        std::string Describe(const Token& token)
+        {
+            if (token.type == ETokenType::End)
+            {
+                return "end of source";
+            }
+            return fmt::format("'{}'", token.text);
+        }
+
+        std::optional<std::vector<Token>> Tokenize(std::string_view source, std::string& errorMessage)
+        {
+            std::vector<Token> tokens;
+            size_t line = 1u;
+            size_t lineStart = 0u;
+            size_t pos = 0u;
+
+            const auto isAt = [&source, &pos](size_t offset, char c) {
+                return pos + offset < source.size() && source[pos + offset] == c;
+            };
+            const auto isDigitAt = [&source, &pos](size_t offset) {
+                return pos + offset < source.size() && IsDigit(source[pos + offset]);
+            };
+            const auto skipDigits = [&source, &pos]() {
+                while (pos < source.size() && IsDigit(source[pos]))
+                {
+                    ++pos;
+                }
+            };
+
+            while (pos < source.size())
+            {
+                const char c = source[pos];
+                if (c == '\n')
+                {
+                    ++pos;
+                    ++line;
+                    lineStart = pos;
+                    continue;
+                }
+                if (c == ' ' || c == '\t' || c == '\r')
+                {
+                    ++pos;
+                    continue;
+                }
+                // Comments start with '--' (like in Lua) and end at the end of the line
+                if (c == '-' && isAt(1u, '-'))
+                {
+                    while (pos < source.size() && source[pos] != '\n')
+                    {
+                        ++pos;
+                    }
+                    continue;
+                }
+
+                Token token;
+                token.line = line;
+                token.column = pos - lineStart + 1u;
+                const size_t start = pos;
+
+                if (IsIdentifierStart(c))
+                {
+                    token.type = ETokenType::Identifier;
+                    while (pos < source.size() && IsIdentifierCharacter(source[pos]))
+                    {
+                        ++pos;
+                    }
+                }
+                else if (IsDigit(c) || (c == '.' && isDigitAt(1u)))
+                {
+                    token.type = ETokenType::Number;
+                    skipDigits();
+                    if (isAt(0u, '.'))
+                    {
+                        ++pos;
+                        skipDigits();
+                    }
+                    if (isAt(0u, 'e') || isAt(0u, 'E'))
+                    {
+                        ++pos;
+                        if (isAt(0u, '+') || isAt(0u, '-'))
+                        {
+                            ++pos;
+                        }
+                        if (!isDigitAt(0u))
+                        {
+                            errorMessage = FormatError(token, "malformed number");
+                            return std::nullopt;
+                        }
+                        skipDigits();
+                    }
+                    if (pos < source.size() && (IsIdentifierCharacter(source[pos]) || source[pos] == '.'))
+                    {
+                        errorMessage = FormatError(token, "malformed number");
+                        return std::nullopt;
+                    }
+                }
+                else
+                {
+                    const char next = (pos + 1 < source.size()) ? source[pos + 1] : '\0';
+                    pos += (next == '=') ? 2u : 1u;
+                    switch (c)
+                    {
+                    case '<':
+                        token.type = (next == '=') ? ETokenType::LessEqual : ETokenType::Less;
+                        break;
+                    case '>':
+                        token.type = (next == '=') ? ETokenType::GreaterEqual : ETokenType::Greater;
+                        break;
+                    case '=':
+                        token.type = (next == '=') ? ETokenType::Equal : ETokenType::Assign;
+                        break;
+                    case '~':
+                    case '!':
+                        if (next != '=')
+                        {
+                            errorMessage = FormatError(token, fmt::format("unexpected character '{}'", c));
+                            return std::nullopt;
+                        }
+                        token.type = ETokenType::NotEqual;
+                        break;
+                    default:
+                        // All other operators consist of a single character
+                        pos = start + 1u;
+                        switch (c)
+                        {
+                        case '+':
+                            token.type = ETokenType::Plus;
+                            break;
+                        case '-':
+                            token.type = ETokenType::Minus;
+                            break;
+                        case '*':
+                            token.type = ETokenType::Star;
+                            break;
+                        case '/':
+                            token.type = ETokenType::Slash;
+                            break;
+                        case '%':
+                            token.type = ETokenType::Percent;
+                            break;
+                        case '(':
+                            token.type = ETokenType::LeftParenthesis;
+                            break;
+                        case ')':
+                            token.type = ETokenType::RightParenthesis;
+                            break;
+                        case ',':
+                            token.type = ETokenType::Comma;
+                            break;
+                        case '.':
+                            token.type = ETokenType::Dot;
+                            break;
+                        case ';':
+                            token.type = ETokenType::Semicolon;
+                            break;
+                        default:
+                            errorMessage = FormatError(token, fmt::format("unexpected character '{}'", c));
+                            return std::nullopt;
+                        }
+                    }
+                }
+
+                token.text = source.substr(start, pos - start);
+                tokens.push_back(token);
+            }
+
+            Token end;
+            end.line = line;
+            end.column = pos - lineStart + 1u;
+            tokens.push_back(end);
+            return tokens;
+        }
+
+        // Recursive descent parser which emits the instructions while parsing. Operator precedence (from lowest to highest)
+        // is the same as in Lua: or, and, comparisons, + -, * / %, unary - and not, component selection (.x)
+        class Compiler
+        {
+        public:
+            Compiler(std::vector<Token> tokens, const ExpressionVariables& inputs, const ExpressionVariables& outputs)
+                : m_tokens(std::move(tokens))
+                , m_inputs(inputs)
+                , m_outputs(outputs)
+            {
+            }
+
+            [[nodiscard]] bool compile()
+            {
+                m_program.registers.resize(m_inputs.size());
+                m_program.outputRegisters.resize(m_outputs.size());
+                m_assigned.assign(m_outputs.size(), false);
+
+                while (peek().type != ETokenType::End)
+                {
+                    if (!compileAssignment())
+                    {
+                        return false;
+                    }
+                    match(ETokenType::Semicolon);
+                }
+
+                for (size_t i = 0; i < m_outputs.size(); ++i)
+                {
+                    if (!m_assigned[i])
+                    {
+                        m_error = fmt::format("output '{}' is not assigned", m_outputs[i].name);
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            [[nodiscard]] ExpressionProgram takeProgram()
+            {
+                return std::move(m_program);
+            }
+
+            [[nodiscard]] const std::string& getError() const
+            {
+                return m_error;
+            }
+
+        private:
+            [[nodiscard]] const Token& peek() const
+            {
+                return m_tokens[m_current];
+            }
+
+            [[nodiscard]] bool peekKeyword(std::string_view keyword) const
+            {
+                return peek().type == ETokenType::Identifier && peek().text == keyword;
+            }
+
+            const Token& advance()
+            {
+                const Token& token = m_tokens[m_current];
+                if (token.type != ETokenType::End)
+                {
+                    ++m_current;
+                }
+                return token;
+            }
+
+            bool match(ETokenType type)
+            {
+                if (peek().type != type)
+                {
+                    return false;
+                }
+                advance();
+                return true;
+            }
+
+            [[nodiscard]] bool expect(ETokenType type, std::string_view expected)
+            {
+                if (match(type))
+                {
+                    return true;
+                }
+                error(peek(), fmt::format("expected {} but found {}", expected, Describe(peek())));
+                return false;
+            }
+
+            // Keeps the first error, which is the cause of all following ones
+            std::nullopt_t error(const Token& token, std::string_view message)
+            {
+                if (m_error.empty())
+                {
+                    m_error = FormatError(token, message);
+                }
+                return std::nullopt;
+            }
+
+            [[nodiscard]] bool compileAssignment()
+            {
+                const Token& target = advance();
+                if (target.type != ETokenType::Identifier || target.text != "OUT")
+                {
+                    error(target, fmt::format("expected an assignment to an output (OUT.name = ...) but found {}", Describe(target)));
+                    return false;
+                }
+                if (!expect(ETokenType::Dot, "'.'"))
+                {
+                    return false;
+                }
+
+                const Token& name = advance();
+                if (name.type != ETokenType::Identifier)
+                {
+                    error(name, fmt::format("expected the name of an output but found {}", Describe(name)));
+                    return false;
+                }
+                const auto outputIter = std::find_if(m_outputs.cbegin(), m_outputs.cend(), [&name](const ExpressionVariable& output) { return output.name == name.text; });
+                if (outputIter == m_outputs.cend())
+                {
+                    error(name, fmt::format("unknown output '{}'", name.text));
+                    return false;
+                }
+                const auto outputIndex = static_cast<size_t>(outputIter - m_outputs.cbegin());
+                if (m_assigned[outputIndex])
+                {
+                    error(name, fmt::format("output '{}' is assigned more than once", name.text));
+                    return false;
+                }
+                if (!expect(ETokenType::Assign, "'='"))
+                {
+                    return false;
+                }
+
+                const Token& expressionStart = peek();
+                std::optional<Operand> value = compileExpression();
+                if (value && value->type == EPropertyType::Int32 && outputIter->type == EPropertyType::Float)
+                {
+                    value = toFloat(*value);
+                }
+                if (!value)
+                {
+                    return false;
+                }
+                if (value->type != outputIter->type)
+                {
+                    error(expressionStart, fmt::format("can't assign a value of type {} to output '{}' of type {}", TypeName(value->type), name.text, TypeName(outputIter->type)));
+                    return false;
+                }
+
+                m_program.outputRegisters[outputIndex] = value->reg;
+                m_assigned[outputIndex] = true;
+                return true;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileExpression()
+            {
+                return compileNested([this]() { return compileOr(); });
+            }
+
+            // Parentheses, function arguments and unary operators are compiled recursively. The sources can come from
+            // files, thus the nesting is limited (like in Lua) instead of letting a malicious source overflow the stack
+            template <typename CompileFunction>
+            [[nodiscard]] std::optional<Operand> compileNested(CompileFunction compileFunction)
+            {
+                if (m_nestingDepth == MaxNestingDepth)
+                {
+                    return error(peek(), fmt::format("expression is nested too deeply (more than {} levels)", MaxNestingDepth));
+                }
+                ++m_nestingDepth;
+                std::optional<Operand> operand = compileFunction();
+                --m_nestingDepth;
+                return operand;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileOr()
+            {
+                std::optional<Operand> left = compileAnd();
+                while (left && peekKeyword("or"))
+                {
+                    const Token& op = advance();
+                    const size_t rightBegin = m_program.instructions.size();
+                    const std::optional<Operand> right = compileAnd();
+                    if (!right)
+                    {
+                        return std::nullopt;
+                    }
+                    // The right operand is only evaluated if the left one doesn't decide the result already (like in Lua)
+                    if (!insertJump(op, EExpressionOpCode::JumpIfTrue, left->reg, rightBegin, m_program.instructions.size()))
+                    {
+                        return std::nullopt;
+                    }
+                    left = compileLogical(op, EExpressionOpCode::BoolOr, *left, *right);
+                }
+                return left;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileAnd()
+            {
+                std::optional<Operand> left = compileComparison();
+                while (left && peekKeyword("and"))
+                {
+                    const Token& op = advance();
+                    const size_t rightBegin = m_program.instructions.size();
+                    const std::optional<Operand> right = compileComparison();
+                    if (!right)
+                    {
+                        return std::nullopt;
+                    }
+                    // The right operand is only evaluated if the left one doesn't decide the result already (like in Lua)
+                    if (!insertJump(op, EExpressionOpCode::JumpIfFalse, left->reg, rightBegin, m_program.instructions.size()))
+                    {
+                        return std::nullopt;
+                    }
+                    left = compileLogical(op, EExpressionOpCode::BoolAnd, *left, *right);
+                }
+                return left;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileComparison()
+            {
+                std::optional<Operand> left = compileAdditive();
+                while (left)
+                {
+                    const ETokenType type = peek().type;
+                    if (type != ETokenType::Less && type != ETokenType::LessEqual && type != ETokenType::Greater && type != ETokenType::GreaterEqual
+                        && type != ETokenType::Equal && type != ETokenType::NotEqual)
+                    {
+                        break;
+                    }
+                    const Token& op = advance();
+                    const std::optional<Operand> right = compileAdditive();
+                    if (!right)
+                    {
+                        return std::nullopt;
+                    }
+                    left = compileCompare(op, *left, *right);
+                }
+                return left;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileAdditive()
+            {
+                std::optional<Operand> left = compileMultiplicative();
+                while (left && (peek().type == ETokenType::Plus || peek().type == ETokenType::Minus))
+                {
+                    const Token& op = advance();
+                    const std::optional<Operand> right = compileMultiplicative();
+                    if (!right)
+                    {
+                        return std::nullopt;
+                    }
+                    left = compileArithmetic(op, *left, *right);
+                }
+                return left;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileMultiplicative()
+            {
+                std::optional<Operand> left = compileUnary();
+                while (left && (peek().type == ETokenType::Star || peek().type == ETokenType::Slash || peek().type == ETokenType::Percent))
+                {
+                    const Token& op = advance();
+                    const std::optional<Operand> right = compileUnary();
+                    if (!right)
+                    {
+                        return std::nullopt;
+                    }
+                    left = compileArithmetic(op, *left, *right);
+                }
+                return left;
+            }
+
+            [[nodiscard]] std::optional<Operand> compileUnary()
+            {
+                if (peek().type == ETokenType::Minus)
+                {
+                    const Token& op = advance();
+                    const std::optional<Operand> operand = compileNested([this]() { return compileUnary(); });
+                    if (!operand)
+                    {
+                        return std::nullopt;
+                    }
+                    if (operand->type == EPropertyType::Int32)
+                    {
+                        return emit(EExpressionOpCode::IntNegate, EPropertyType::Int32, 1u, operand->reg);
+                    }
+                    if (IsFloatType(operand->type))
+                    {
+                        return emit(EExpressionOpCode::FloatNegate, operand->type, TypeUtils::ComponentsSizeForPropertyType(operand->type), operand->reg);
+                    }
+                    return error(op, fmt::format("'-' can't be applied to {}", TypeName(operand->type)));
+                }
+
+                if (peekKeyword("not"))
+                {
+                    const Token& op = advance();
+                    const std::optional<Operand> operand = compileNested([this]() { return compileUnary(); });
+                    if (!operand)
+                    {
+                        return std::nullopt;
+                    }
+                    if (operand->type != EPropertyType::Bool)
+                    {
+                        return error(op, fmt::format("'not' can't be applied to {}", TypeName(operand->type)));
+                    }
+                    return emit(EExpressionOpCode::BoolNot, EPropertyType::Bool, 1u, operand->reg);
+                }
+
+                return compilePostfix();
+            }
+
+            [[nodiscard]] std::optional<Operand> compilePostfix()
+            {
+                std::optional<Operand> operand = compilePrimary();
+                while (operand && match(ETokenType::Dot))
+                {
+                    const Token& components = advance();
+                    if (components.type != ETokenType::Identifier)
+                    {
+                        return error(components, fmt::format("expected vector components but found {}", Describe(components)));
+                    }
+                    operand = compileSwizzle(components, *operand);
+                }
+                return operand;
+            }
+
+            [[nodiscard]] std::optional<Operand> compilePrimary()
+            {
+                const Token& token = advance();
+                switch (token.type)
+                {
+                case ETokenType::Number:
+                    return compileNumber(token);
+                case ETokenType::LeftParenthesis:
+                {
+                    std::optional<Operand> value = compileExpression();
+                    if (!value || !expect(ETokenType::RightParenthesis, "')'"))
+                    {
+                        return std::nullopt;
+                    }
+                    return value;
+                }
+                case ETokenType::Identifier:
+                    if (token.text == "true" || token.text == "false")
+                    {
+                        ExpressionValue value;
+                        value.integer = (token.text == "true") ? 1 : 0;
+                        return addConstant(value, EPropertyType::Bool);
+                    }
+                    if (token.text == "IN")
+                    {
+                        return compileInput();
+                    }
+                    if (token.text == "OUT")
+                    {
+                        return error(token, "outputs can't be read");
+                    }
+                    if (IsKeyword(token.text))
+                    {
+                        break;
+                    }
+                    if (peek().type == ETokenType::LeftParenthesis)
+                    {
+                        return compileCall(token);
+                    }
+                    return error(token, fmt::format("unknown identifier '{}' (inputs are accessed as IN.name)", token.text));
+                case ETokenType::Plus:
+                case ETokenType::Minus:
+                case ETokenType::Star:
+                case ETokenType::Slash:
+                case ETokenType::Percent:
+                case ETokenType::Less:
+                case ETokenType::LessEqual:
+                case ETokenType::Greater:
+                case ETokenType::GreaterEqual:
+                case ETokenType::Equal:
+                case ETokenType::NotEqual:
+                case ETokenType::Assign:
+                case ETokenType::RightParenthesis:
+                case ETokenType::Comma:
+                case ETokenType::Dot:
+                case ETokenType::Semicolon:
+                case ETokenType::End:
+                    break;
+                }
+                return error(token, fmt::format("expected an expression but found {}", Describe(token)));
+            }
+
+            [[nodiscard]] std::optional<Operand> compileNumber(const Token& token)
+            {
+                ExpressionValue value;
+                if (token.text.find_first_of(".eE") != std::string_view::npos)
+                {
+                    const std::string text(token.text);
+                    const float number = std::strtof(text.c_str(), nullptr);
+                    if (!std::isfinite(number))
+                    {
+                        return error(token, fmt::format("number {} is out of range", token.text));
+                    }
+                    value.components.fill(number);
+                    return addConstant(value, EPropertyType::Float);
+                }
+
+                int32_t number = 0;
+                const auto result = std::from_chars(token.text.data(), token.text.data() + token.text.size(), number);
+                if (result.ec != std::errc())
+                {
+                    return error(token, fmt::format("integer {} is out of range (use a float literal instead)", token.text));
+                }
+                value.integer = number;
+                return addConstant(value, EPropertyType::Int32);
+            }
+
+            [[nodiscard]] std::optional<Operand> compileInput()
+            {
+                if (!expect(ETokenType::Dot, "'.'"))
+                {
+                    return std::nullopt;
+                }
+                const Token& name = advance();
+                if (name.type != ETokenType::Identifier)
+                {
+                    return error(name, fmt::format("expected the name of an input but found {}", Describe(name)));
+                }
+                const auto inputIter = std::find_if(m_inputs.cbegin(), m_inputs.cend(), [&name](const ExpressionVariable& input) { return input.name == name.text; });
+                if (inputIter == m_inputs.cend())
+                {
+                    return error(name, fmt::format("unknown input '{}'", name.text));
+                }
+                // The registers of the inputs come first
+                return Operand{ static_cast<uint16_t>(inputIter - m_inputs.cbegin()), inputIter->type };
+            }
+
+            [[nodiscard]] std::optional<Operand> compileSwizzle(const Token& components, const Operand& operand)
+            {
+                const size_t operandSize = IsFloatType(operand.type) ? TypeUtils::ComponentsSizeForPropertyType(operand.type) : 0u;
+                if (operandSize < 2u)
+                {
+                    return error(components, fmt::format("components can only be selected from vectors, not from {}", TypeName(operand.type)));
+                }
+                if (components.text.size() > 4u)
+                {
+                    return error(components, fmt::format("can't select more than 4 components ('{}')", components.text));
+                }
+
+                constexpr std::string_view componentNames = "xyzw";
+                uint16_t mask = 0u;
+                for (size_t i = 0; i < components.text.size(); ++i)
+                {
+                    const size_t index = componentNames.find(components.text[i]);
+                    if (index >= operandSize)
+                    {
+                        return error(components, fmt::format("{} has no component '{}'", TypeName(operand.type), components.text[i]));
+                    }
+                    mask = static_cast<uint16_t>(mask | (index << (2u * i)));
+                }
+
+                const size_t size = components.text.size();
+                return emit(EExpressionOpCode::Swizzle, FloatTypeOfSize(size), size, operand.reg, mask);
+            }
+
+            [[nodiscard]] std::optional<Operand> compileCall(const Token& function)
+            {
+                std::vector<Operand> arguments;
+                // Index of the first instruction of each argument, followed by the end of the last argument
+                std::vector<size_t> argumentBegins;
+                if (!expect(ETokenType::LeftParenthesis, "'('"))
+                {
+                    return std::nullopt;
+                }
+                if (!match(ETokenType::RightParenthesis))
+                {
+                    do
+                    {
+                        argumentBegins.push_back(m_program.instructions.size());
+                        const std::optional<Operand> argument = compileExpression();
+                        if (!argument)
+                        {
+                            return std::nullopt;
+                        }
+                        arguments.push_back(*argument);
+                    } while (match(ETokenType::Comma));
+
+                    if (!expect(ETokenType::RightParenthesis, "')'"))
+                    {
+                        return std::nullopt;
+                    }
+                }
+                argumentBegins.push_back(m_program.instructions.size());
+                return compileFunction(function, arguments, argumentBegins);
+            }
+
+            [[nodiscard]] std::optional<Operand> compileFunction(const Token& function, std::vector<Operand>& arguments, const std::vector<size_t>& argumentBegins)
+            {
+                // Functions which are applied to each component of float vectors
+                static const std::unordered_map<std::string_view, EExpressionOpCode> unaryFunctions = {
+                    {"floor", EExpressionOpCode::FloatFloor},
+                    {"ceil", EExpressionOpCode::FloatCeil},
+                    {"sqrt", EExpressionOpCode::FloatSqrt},
+                    {"sin", EExpressionOpCode::FloatSin},
+                    {"cos", EExpressionOpCode::FloatCos},
+                    {"tan", EExpressionOpCode::FloatTan},
+                    {"asin", EExpressionOpCode::FloatAsin},
+                    {"acos", EExpressionOpCode::FloatAcos},
+                    {"atan", EExpressionOpCode::FloatAtan},
+                    {"exp", EExpressionOpCode::FloatExp},
+                    {"log", EExpressionOpCode::FloatLog},
+                };
+                static const std::unordered_map<std::string_view, EExpressionOpCode> binaryFunctions = {
+                    {"pow", EExpressionOpCode::FloatPower},
+                    {"atan2", EExpressionOpCode::FloatAtan2},
+                };
+
+                const std::string_view name = function.text;
+
+                if (const auto unaryFunction = unaryFunctions.find(name); unaryFunction != unaryFunctions.cend())
+                {
+                    if (!checkArgumentCount(function, arguments, 1u) || !unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    return emitFloat(unaryFunction->second, arguments);
+                }
+
+                if (const auto binaryFunction = binaryFunctions.find(name); binaryFunction != binaryFunctions.cend())
+                {
+                    if (!checkArgumentCount(function, arguments, 2u) || !unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    return emitFloat(binaryFunction->second, arguments);
+                }
+
+                if (name == "abs")
+                {
+                    if (!checkArgumentCount(function, arguments, 1u))
+                    {
+                        return std::nullopt;
+                    }
+                    if (arguments[0].type == EPropertyType::Int32)
+                    {
+                        return emit(EExpressionOpCode::IntAbs, EPropertyType::Int32, 1u, arguments[0].reg);
+                    }
+                    if (!unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    return emitFloat(EExpressionOpCode::FloatAbs, arguments);
+                }
+
+                if (name == "min" || name == "max" || name == "clamp")
+                {
+                    const bool isClamp = (name == "clamp");
+                    if (!checkArgumentCount(function, arguments, isClamp ? 3u : 2u))
+                    {
+                        return std::nullopt;
+                    }
+                    if (std::all_of(arguments.cbegin(), arguments.cend(), [](const Operand& argument) { return argument.type == EPropertyType::Int32; }))
+                    {
+                        const EExpressionOpCode opCode = isClamp ? EExpressionOpCode::IntClamp : (name == "min" ? EExpressionOpCode::IntMin : EExpressionOpCode::IntMax);
+                        return emit(opCode, EPropertyType::Int32, 1u, arguments[0].reg, arguments[1].reg, isClamp ? arguments[2].reg : 0u);
+                    }
+                    if (!unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    return emitFloat(isClamp ? EExpressionOpCode::FloatClamp : (name == "min" ? EExpressionOpCode::FloatMin : EExpressionOpCode::FloatMax), arguments);
+                }
+
+                if (name == "lerp")
+                {
+                    if (!checkArgumentCount(function, arguments, 3u) || !unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    return emitFloat(EExpressionOpCode::FloatLerp, arguments);
+                }
+
+                if (name == "select")
+                {
+                    if (!checkArgumentCount(function, arguments, 3u))
+                    {
+                        return std::nullopt;
+                    }
+                    if (arguments[0].type != EPropertyType::Bool)
+                    {
+                        return error(function, fmt::format("the condition of 'select' must be bool, not {}", TypeName(arguments[0].type)));
+                    }
+                    std::vector<Operand> values = { arguments[1], arguments[2] };
+                    if (values[0].type != values[1].type && !unifyFloats(function, values))
+                    {
+                        return std::nullopt;
+                    }
+                    // Only the chosen value is evaluated, thus the other one can't fail (e.g. select(IN.b ~= 0, IN.a % IN.b, 0)).
+                    // The conversions of unifyFloats() can't fail and are evaluated for both values
+                    if (!insertJump(function, EExpressionOpCode::Jump, 0u, argumentBegins[2], argumentBegins[3])
+                        || !insertJump(function, EExpressionOpCode::JumpIfFalse, arguments[0].reg, argumentBegins[1], argumentBegins[2] + 1u))
+                    {
+                        return std::nullopt;
+                    }
+                    return emit(EExpressionOpCode::Select, values[0].type, 4u, arguments[0].reg, values[0].reg, values[1].reg);
+                }
+
+                if (name == "length" || name == "normalize")
+                {
+                    if (!checkArgumentCount(function, arguments, 1u) || !unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    const size_t size = TypeUtils::ComponentsSizeForPropertyType(arguments[0].type);
+                    return (name == "length") ?
+                        emit(EExpressionOpCode::Length, EPropertyType::Float, size, arguments[0].reg) :
+                        emit(EExpressionOpCode::Normalize, arguments[0].type, size, arguments[0].reg);
+                }
+
+                if (name == "dot" || name == "distance" || name == "cross")
+                {
+                    if (!checkArgumentCount(function, arguments, 2u) || !unifyFloats(function, arguments))
+                    {
+                        return std::nullopt;
+                    }
+                    // Scalars are not expanded to vectors for these functions
+                    const bool isCross = (name == "cross");
+                    if (arguments[0].type != arguments[1].type || (isCross && arguments[0].type != EPropertyType::Vec3f))
+                    {
+                        return error(function, fmt::format("'{}' can't be applied to {}", name, TypeNames(arguments)));
+                    }
+                    const size_t size = TypeUtils::ComponentsSizeForPropertyType(arguments[0].type);
+                    if (isCross)
+                    {
+                        return emit(EExpressionOpCode::Cross, EPropertyType::Vec3f, size, arguments[0].reg, arguments[1].reg);
+                    }
+                    return emit(name == "dot" ? EExpressionOpCode::Dot : EExpressionOpCode::Distance, EPropertyType::Float, size, arguments[0].reg, arguments[1].reg);
+                }
+
+                if (name == "vec2" || name == "vec3" || name == "vec4")
+                {
+                    return compileVectorConstructor(function, arguments);
+                }
+
+                if (name == "int")
+                {
+                    if (!checkArgumentCount(function, arguments, 1u))
+                    {
+                        return std::nullopt;
+                    }
+                    switch (arguments[0].type)
+                    {
+                    case EPropertyType::Int32:
+                        return arguments[0];
+                    case EPropertyType::Bool:
+                        // Booleans are stored as integer 0 or 1 already
+                        return Operand{ arguments[0].reg, EPropertyType::Int32 };
+                    case EPropertyType::Float:
+                        return emit(EExpressionOpCode::FloatToInt, EPropertyType::Int32, 1u, arguments[0].reg);
+                    default:
+                        return error(function, fmt::format("'int' can't be applied to {}", TypeName(arguments[0].type)));
+                    }
+                }
+
+                if (name == "float")
+                {
+                    if (!checkArgumentCount(function, arguments, 1u))
+                    {
+                        return std::nullopt;
+                    }
+                    switch (arguments[0].type)
+                    {
+                    case EPropertyType::Float:
+                        return arguments[0];
+                    case EPropertyType::Int32:
+                    case EPropertyType::Bool:
+                        return emit(EExpressionOpCode::IntToFloat, EPropertyType::Float, 1u, arguments[0].reg);
+                    default:
+                        return error(function, fmt::format("'float' can't be applied to {}", TypeName(arguments[0].type)));
+                    }
+                }
+
+                return error(function, fmt::format("unknown function '{}'", name));
+            }
+
+            [[nodiscard]] std::optional<Operand> compileVectorConstructor(const Token& function, std::vector<Operand>& arguments)
+            {
+                const size_t size = static_cast<size_t>(function.text.back() - '0');
+                const EPropertyType type = FloatTypeOfSize(size);
+
+                if (arguments.size() == 1u && (arguments[0].type == EPropertyType::Float || arguments[0].type == EPropertyType::Int32))
+                {
+                    const std::optional<Operand> scalar = toFloat(arguments[0]);
+                    if (!scalar)
+                    {
+                        return std::nullopt;
+                    }
+                    return emit(EExpressionOpCode::Splat, type, size, scalar->reg);
+                }
+
+                size_t componentCount = 0u;
+                for (auto& argument : arguments)
+                {
+                    if (!IsNumericType(argument.type))
+                    {
+                        return error(function, fmt::format("'{}' can't be constructed from {}", function.text, TypeNames(arguments)));
+                    }
+                    const std::optional<Operand> converted = toFloat(argument);
+                    if (!converted)
+                    {
+                        return std::nullopt;
+                    }
+                    argument = *converted;
+                    componentCount += TypeUtils::ComponentsSizeForPropertyType(argument.type);
+                }
+                if (componentCount != size)
+                {
+                    return error(function, fmt::format("'{}' needs {} components but got {}", function.text, size, componentCount));
+                }
+
+                const std::optional<uint16_t> target = allocateRegister(function);
+                if (!target)
+                {
+                    return std::nullopt;
+                }
+                uint16_t offset = 0u;
+                for (const auto& argument : arguments)
+                {
+                    ExpressionInstruction instruction;
+                    instruction.opCode = EExpressionOpCode::Insert;
+                    instruction.size = static_cast<uint8_t>(TypeUtils::ComponentsSizeForPropertyType(argument.type));
+                    instruction.target = *target;
+                    instruction.operand0 = argument.reg;
+                    instruction.operand1 = offset;
+                    m_program.instructions.push_back(instruction);
+                    offset = static_cast<uint16_t>(offset + instruction.size);
+                }
+                return Operand{ *target, type };
+            }
+
+            [[nodiscard]] std::optional<Operand> compileLogical(const Token& op, EExpressionOpCode opCode, const Operand& left, const Operand& right)
+            {
+                if (left.type != EPropertyType::Bool || right.type != EPropertyType::Bool)
+                {
+                    return error(op, fmt::format("'{}' can't be applied to {} and {}", op.text, TypeName(left.type), TypeName(right.type)));
+                }
+                return emit(opCode, EPropertyType::Bool, 1u, left.reg, right.reg);
+            }
+
+            [[nodiscard]] std::optional<Operand> compileCompare(const Token& op, const Operand& left, const Operand& right)
+            {
+                const bool isEquality = (op.type == ETokenType::Equal || op.type == ETokenType::NotEqual);
+
+                if (left.type == right.type && (left.type == EPropertyType::Int32 || (isEquality && left.type == EPropertyType::Bool)))
+                {
+                    switch (op.type)
+                    {
+                    case ETokenType::Equal:
+                        return emit(EExpressionOpCode::IntEqual, EPropertyType::Bool, 1u, left.reg, right.reg);
+                    case ETokenType::NotEqual:
+                        return emit(EExpressionOpCode::IntNotEqual, EPropertyType::Bool, 1u, left.reg, right.reg);
+                    case ETokenType::Less:
+                        return emit(EExpressionOpCode::IntLess, EPropertyType::Bool, 1u, left.reg, right.reg);
+                    case ETokenType::LessEqual:
+                        return emit(EExpressionOpCode::IntLessEqual, EPropertyType::Bool, 1u, left.reg, right.reg);
+                    case ETokenType::Greater:
+                        return emit(EExpressionOpCode::IntLess, EPropertyType::Bool, 1u, right.reg, left.reg);
+                    default:
+                        return emit(EExpressionOpCode::IntLessEqual, EPropertyType::Bool, 1u, right.reg, left.reg);
+                    }
+                }
+
+                std::vector<Operand> operands = { left, right };
+                // Vectors can only be compared for equality and only with vectors of the same size
+                const bool comparable = IsNumericType(left.type) && IsNumericType(right.type)
+                    && (isEquality ? (TypeUtils::ComponentsSizeForPropertyType(left.type) == TypeUtils::ComponentsSizeForPropertyType(right.type))
+                                   : (TypeUtils::ComponentsSizeForPropertyType(left.type) == 1u && TypeUtils::ComponentsSizeForPropertyType(right.type) == 1u));
+                if (!comparable)
+                {
+                    return error(op, fmt::format("'{}' can't be applied to {}", op.text, TypeNames(operands)));
+                }
+                if (!unifyFloats(op, operands))
+                {
+                    return std::nullopt;
+                }
+
+                const uint16_t a = operands[0].reg;
+                const uint16_t b = operands[1].reg;
+                const size_t size = TypeUtils::ComponentsSizeForPropertyType(operands[0].type);
+                switch (op.type)
+                {
+                case ETokenType::Equal:
+                    return emit(EExpressionOpCode::FloatEqual, EPropertyType::Bool, size, a, b);
+                case ETokenType::NotEqual:
+                    return emit(EExpressionOpCode::FloatNotEqual, EPropertyType::Bool, size, a, b);
+                case ETokenType::Less:
+                    return emit(EExpressionOpCode::FloatLess, EPropertyType::Bool, size, a, b);
+                case ETokenType::LessEqual:
+                    return emit(EExpressionOpCode::FloatLessEqual, EPropertyType::Bool, size, a, b);
+                case ETokenType::Greater:
+                    return emit(EExpressionOpCode::FloatLess, EPropertyType::Bool, size, b, a);
+                default:
+                    return emit(EExpressionOpCode::FloatLessEqual, EPropertyType::Bool, size, b, a);
+                }
+            }
+
+            [[nodiscard]] std::optional<Operand> compileArithmetic(const Token& op, const Operand& left, const Operand& right)
+            {
+                // Like in Lua, '/' always divides floats
+                if (left.type == EPropertyType::Int32 && right.type == EPropertyType::Int32 && op.type != ETokenType::Slash)
+                {
+                    switch (op.type)
+                    {
+                    case ETokenType::Plus:
+                        return emit(EExpressionOpCode::IntAdd, EPropertyType::Int32, 1u, left.reg, right.reg);
+                    case ETokenType::Minus:
+                        return emit(EExpressionOpCode::IntSubtract, EPropertyType::Int32, 1u, left.reg, right.reg);
+                    case ETokenType::Star:
+                        return emit(EExpressionOpCode::IntMultiply, EPropertyType::Int32, 1u, left.reg, right.reg);
+                    default:
+                        return emit(EExpressionOpCode::IntModulo, EPropertyType::Int32, 1u, left.reg, right.reg);
+                    }
+                }
+
+                std::vector<Operand> operands = { left, right };
+                if (!unifyFloats(op, operands))
+                {
+                    return std::nullopt;
+                }
+                switch (op.type)
+                {
+                case ETokenType::Plus:
+                    return emitFloat(EExpressionOpCode::FloatAdd, operands);
+                case ETokenType::Minus:
+                    return emitFloat(EExpressionOpCode::FloatSubtract, operands);
+                case ETokenType::Star:
+                    return emitFloat(EExpressionOpCode::FloatMultiply, operands);
+                case ETokenType::Slash:
+                    return emitFloat(EExpressionOpCode::FloatDivide, operands);
+                default:
+                    return emitFloat(EExpressionOpCode::FloatModulo, operands);
+                }
+            }
+
+            [[nodiscard]] bool checkArgumentCount(const Token& function, const std::vector<Operand>& arguments, size_t expected)
+            {
+                if (arguments.size() != expected)
+                {
+                    error(function, fmt::format("'{}' expects {} argument(s) but got {}", function.text, expected, arguments.size()));
+                    return false;
+                }
+                return true;
+            }
+
+            // Converts integers to floats and expands scalars to the size of the vector operands,
+            // so that the operands can be processed component by component
+            [[nodiscard]] bool unifyFloats(const Token& op, std::vector<Operand>& operands)
+            {
+                size_t size = 1u;
+                for (const auto& operand : operands)
+                {
+                    const size_t operandSize = TypeUtils::ComponentsSizeForPropertyType(operand.type);
+                    if (!IsNumericType(operand.type) || (operandSize != 1u && size != 1u && operandSize != size))
+                    {
+                        error(op, fmt::format("'{}' can't be applied to {}", op.text, TypeNames(operands)));
+                        return false;
+                    }
+                    size = std::max(size, operandSize);
+                }
+
+                for (auto& operand : operands)
+                {
+                    std::optional<Operand> converted = toFloat(operand);
+                    if (converted && size > 1u && converted->type == EPropertyType::Float)
+                    {
+                        converted = emit(EExpressionOpCode::Splat, FloatTypeOfSize(size), size, converted->reg);
+                    }
+                    if (!converted)
+                    {
+                        return false;
+                    }
+                    operand = *converted;
+                }
+                return true;
+            }
+
+            [[nodiscard]] std::optional<Operand> toFloat(const Operand& operand)
+            {
+                if (operand.type == EPropertyType::Int32)
+                {
+                    return emit(EExpressionOpCode::IntToFloat, EPropertyType::Float, 1u, operand.reg);
+                }
+                return operand;
+            }
+
+            // Emits a float instruction for operands unified by unifyFloats()
+            [[nodiscard]] std::optional<Operand> emitFloat(EExpressionOpCode opCode, const std::vector<Operand>& operands)
+            {
+                const EPropertyType type = operands[0].type;
+                return emit(opCode, type, TypeUtils::ComponentsSizeForPropertyType(type),
+                    operands[0].reg,
+                    operands.size() > 1u ? operands[1].reg : 0u,
+                    operands.size() > 2u ? operands[2].reg : 0u);
+            }
+
+            [[nodiscard]] std::optional<Operand> emit(EExpressionOpCode opCode, EPropertyType resultType, size_t size, uint16_t operand0, uint16_t operand1 = 0u, uint16_t operand2 = 0u)
+            {
+                const std::optional<uint16_t> target = allocateRegister(peek());
+                if (!target)
+                {
+                    return std::nullopt;
+                }
+
+                ExpressionInstruction instruction;
+                instruction.opCode = opCode;
+                instruction.size = static_cast<uint8_t>(size);
+                instruction.target = *target;
+                instruction.operand0 = operand0;
+                instruction.operand1 = operand1;
+                instruction.operand2 = operand2;
+                m_program.instructions.push_back(instruction);
+
+                return Operand{ *target, resultType };
+            }
+
+            // Inserts a jump before the instructions [begin, end) which skips them. The instructions behind 'begin' are moved,
+            // which is fine because jumps are relative and never leave the (sub-)expression which contains them
+            [[nodiscard]] bool insertJump(const Token& token, EExpressionOpCode opCode, uint16_t condition, size_t begin, size_t end)
+            {
+                const size_t skippedCount = end - begin;
+                if (skippedCount > std::numeric_limits<uint16_t>::max())
+                {
+                    error(token, "expression is too complex");
+                    return false;
+                }
+
+                ExpressionInstruction instruction;
+                instruction.opCode = opCode;
+                instruction.operand0 = condition;
+                instruction.operand1 = static_cast<uint16_t>(skippedCount);
+                m_program.instructions.insert(m_program.instructions.cbegin() + static_cast<std::ptrdiff_t>(begin), instruction);
+                return true;
+            }
+
+            [[nodiscard]] std::optional<Operand> addConstant(const ExpressionValue& value, EPropertyType type)
+            {
+                const std::optional<uint16_t> reg = allocateRegister(peek());
+                if (!reg)
+                {
+                    return std::nullopt;
+                }
+                m_program.registers[*reg] = value;
+                return Operand{ *reg, type };
+            }
+
+            [[nodiscard]] std::optional<uint16_t> allocateRegister(const Token& token)
+            {
+                if (m_program.registers.size() >= MaxRegisterCount)
+                {
+                    return error(token, "expression is too complex");
+                }
+                m_program.registers.emplace_back();
+                return static_cast<uint16_t>(m_program.registers.size() - 1u);
+            }
+
+            std::vector<Token> m_tokens;
+            size_t m_current = 0u;
+            size_t m_nestingDepth = 0u;
+            static constexpr size_t MaxNestingDepth = 200u;
+            const ExpressionVariables& m_inputs;
+            const ExpressionVariables& m_outputs;
+            ExpressionProgram m_program;
+            std::vector<bool> m_assigned;
+            std::string m_error;
+        };
+
+        std::optional<std::string> ValidateVariables(const ExpressionVariables& variables, std::string_view kind)
+        {
+            std::unordered_set<std::string_view> names;
+            for (const auto& variable : variables)
+            {
+                if (!IsIdentifier(variable.name) || IsKeyword(variable.name))
+                {
+                    return fmt::format("{} name '{}' is not a valid identifier", kind, variable.name);
+                }
+                if (!names.insert(variable.name).second)
+                {
+                    return fmt::format("{} '{}' is declared more than once", kind, variable.name);
+                }
+                if (!ExpressionCompiler::IsSupportedType(variable.type))
+                {
+                    return fmt::format("{} '{}' has an unsupported type (only Float, Vec2f, Vec3f, Vec4f, Int32 and Bool are supported)", kind, variable.name);
+                }
+            }
+            return std::nullopt;
+        }
+    }
+
+    bool ExpressionCompiler::IsSupportedType(EPropertyType type)
+    {
+        return IsNumericType(type) || type == EPropertyType::Bool;
+    }
+
+    ExpressionCompilationResult ExpressionCompiler::Compile(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs)
+    {
+        ExpressionCompilationResult result;
+
+        if (outputs.empty())
+        {
+            result.errorMessage = "expression node needs at least one output";
+            return result;
+        }
+
+        if (inputs.size() >= MaxRegisterCount)
+        {
+            result.errorMessage = "too many inputs";
+            return result;
+        }
+
+        for (const auto& error : { ValidateVariables(inputs, "input"), ValidateVariables(outputs, "output") })
+        {
+            if (error)
+            {
+                result.errorMessage = *error;
+                return result;
+            }
+        }
+
+        std::optional<std::vector<Token>> tokens = Tokenize(source, result.errorMessage);
+        if (!tokens)
+        {
+            return result;
+        }
+
+        Compiler compiler(std::move(*tokens), inputs, outputs);
+        if (!compiler.compile())
+        {
+            result.errorMessage = compiler.getError();
+            return result;
+        }
+
+        result.program = compiler.takeProgram();
+        return result;
+    }
+}
@@ -0,0 +1,38 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/ExpressionProgram.h"
+
+#include "ramses-logic/ExpressionNode.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    struct ExpressionCompilationResult
+    {
+        std::optional<ExpressionProgram> program;
+        // Set if the program could not be compiled
+        std::string errorMessage;
+    };
+
+    // Parses the source of an expression node and translates it to a register program in a single pass,
+    // i.e. without building a syntax tree. Types are resolved at compile time, so the program doesn't have
+    // to check them when it's executed.
+    class ExpressionCompiler
+    {
+    public:
+        [[nodiscard]] static ExpressionCompilationResult Compile(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs);
+
+        [[nodiscard]] static bool IsSupportedType(EPropertyType type);
+    };
+}
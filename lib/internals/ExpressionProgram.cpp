@@ -0,0 +1,320 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ExpressionProgram.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        template <typename Function>
+        void Unary(ExpressionValue& target, const ExpressionValue& a, size_t size, Function function)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                target.components[i] = function(a.components[i]);
+            }
+        }
+
+        template <typename Function>
+        void Binary(ExpressionValue& target, const ExpressionValue& a, const ExpressionValue& b, size_t size, Function function)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                target.components[i] = function(a.components[i], b.components[i]);
+            }
+        }
+
+        template <typename Function>
+        void Ternary(ExpressionValue& target, const ExpressionValue& a, const ExpressionValue& b, const ExpressionValue& c, size_t size, Function function)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                target.components[i] = function(a.components[i], b.components[i], c.components[i]);
+            }
+        }
+
+        float Dot(const ExpressionValue& a, const ExpressionValue& b, size_t size)
+        {
+            float result = 0.f;
+            for (size_t i = 0; i < size; ++i)
+            {
+                result += a.components[i] * b.components[i];
+            }
+            return result;
+        }
+
+        bool Equal(const ExpressionValue& a, const ExpressionValue& b, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (a.components[i] != b.components[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Integer arithmetic wraps around on overflow (like in Lua) instead of being undefined
+        int32_t Wrap(uint32_t value)
+        {
+            return static_cast<int32_t>(value);
+        }
+
+        uint32_t Bits(int32_t value)
+        {
+            return static_cast<uint32_t>(value);
+        }
+    }
+
+    std::optional<std::string> ExpressionProgram::execute()
+    {
+        for (size_t index = 0; index < instructions.size(); ++index)
+        {
+            const ExpressionInstruction& instruction = instructions[index];
+            ExpressionValue& target = registers[instruction.target];
+            const ExpressionValue& a = registers[instruction.operand0];
+            const ExpressionValue& b = registers[instruction.operand1];
+            const ExpressionValue& c = registers[instruction.operand2];
+            const size_t size = instruction.size;
+
+            switch (instruction.opCode)
+            {
+            case EExpressionOpCode::FloatAdd:
+                Binary(target, a, b, size, [](float x, float y) { return x + y; });
+                break;
+            case EExpressionOpCode::FloatSubtract:
+                Binary(target, a, b, size, [](float x, float y) { return x - y; });
+                break;
+            case EExpressionOpCode::FloatMultiply:
+                Binary(target, a, b, size, [](float x, float y) { return x * y; });
+                break;
+            case EExpressionOpCode::FloatDivide:
+                Binary(target, a, b, size, [](float x, float y) { return x / y; });
+                break;
+            case EExpressionOpCode::FloatModulo:
+                // Same as in Lua, the result has the sign of the divisor
+                Binary(target, a, b, size, [](float x, float y) { return x - std::floor(x / y) * y; });
+                break;
+            case EExpressionOpCode::FloatMin:
+                Binary(target, a, b, size, [](float x, float y) { return std::min(x, y); });
+                break;
+            case EExpressionOpCode::FloatMax:
+                Binary(target, a, b, size, [](float x, float y) { return std::max(x, y); });
+                break;
+            case EExpressionOpCode::FloatPower:
+                Binary(target, a, b, size, [](float x, float y) { return std::pow(x, y); });
+                break;
+            case EExpressionOpCode::FloatAtan2:
+                Binary(target, a, b, size, [](float x, float y) { return std::atan2(x, y); });
+                break;
+            case EExpressionOpCode::FloatClamp:
+                Ternary(target, a, b, c, size, [](float x, float low, float high) { return std::min(std::max(x, low), high); });
+                break;
+            case EExpressionOpCode::FloatLerp:
+                Ternary(target, a, b, c, size, [](float x, float y, float t) { return x + (y - x) * t; });
+                break;
+            case EExpressionOpCode::FloatNegate:
+                Unary(target, a, size, [](float x) { return -x; });
+                break;
+            case EExpressionOpCode::FloatAbs:
+                Unary(target, a, size, [](float x) { return std::abs(x); });
+                break;
+            case EExpressionOpCode::FloatFloor:
+                Unary(target, a, size, [](float x) { return std::floor(x); });
+                break;
+            case EExpressionOpCode::FloatCeil:
+                Unary(target, a, size, [](float x) { return std::ceil(x); });
+                break;
+            case EExpressionOpCode::FloatSqrt:
+                Unary(target, a, size, [](float x) { return std::sqrt(x); });
+                break;
+            case EExpressionOpCode::FloatSin:
+                Unary(target, a, size, [](float x) { return std::sin(x); });
+                break;
+            case EExpressionOpCode::FloatCos:
+                Unary(target, a, size, [](float x) { return std::cos(x); });
+                break;
+            case EExpressionOpCode::FloatTan:
+                Unary(target, a, size, [](float x) { return std::tan(x); });
+                break;
+            case EExpressionOpCode::FloatAsin:
+                Unary(target, a, size, [](float x) { return std::asin(x); });
+                break;
+            case EExpressionOpCode::FloatAcos:
+                Unary(target, a, size, [](float x) { return std::acos(x); });
+                break;
+            case EExpressionOpCode::FloatAtan:
+                Unary(target, a, size, [](float x) { return std::atan(x); });
+                break;
+            case EExpressionOpCode::FloatExp:
+                Unary(target, a, size, [](float x) { return std::exp(x); });
+                break;
+            case EExpressionOpCode::FloatLog:
+                Unary(target, a, size, [](float x) { return std::log(x); });
+                break;
+            case EExpressionOpCode::FloatLess:
+                target.integer = (a.components[0] < b.components[0]) ? 1 : 0;
+                break;
+            case EExpressionOpCode::FloatLessEqual:
+                target.integer = (a.components[0] <= b.components[0]) ? 1 : 0;
+                break;
+            case EExpressionOpCode::FloatEqual:
+                target.integer = Equal(a, b, size) ? 1 : 0;
+                break;
+            case EExpressionOpCode::FloatNotEqual:
+                target.integer = Equal(a, b, size) ? 0 : 1;
+                break;
+            case EExpressionOpCode::IntAdd:
+                target.integer = Wrap(Bits(a.integer) + Bits(b.integer));
+                break;
+            case EExpressionOpCode::IntSubtract:
+                target.integer = Wrap(Bits(a.integer) - Bits(b.integer));
+                break;
+            case EExpressionOpCode::IntMultiply:
+                target.integer = Wrap(Bits(a.integer) * Bits(b.integer));
+                break;
+            case EExpressionOpCode::IntModulo:
+            {
+                if (b.integer == 0)
+                {
+                    return "integer modulo by zero";
+                }
+                // -1 is handled separately, because INT32_MIN % -1 overflows
+                int32_t result = (b.integer == -1) ? 0 : a.integer % b.integer;
+                // Same as in Lua, the result has the sign of the divisor
+                if (result != 0 && ((result < 0) != (b.integer < 0)))
+                {
+                    result += b.integer;
+                }
+                target.integer = result;
+                break;
+            }
+            case EExpressionOpCode::IntMin:
+                target.integer = std::min(a.integer, b.integer);
+                break;
+            case EExpressionOpCode::IntMax:
+                target.integer = std::max(a.integer, b.integer);
+                break;
+            case EExpressionOpCode::IntClamp:
+                target.integer = std::min(std::max(a.integer, b.integer), c.integer);
+                break;
+            case EExpressionOpCode::IntNegate:
+                target.integer = Wrap(0u - Bits(a.integer));
+                break;
+            case EExpressionOpCode::IntAbs:
+                target.integer = (a.integer < 0) ? Wrap(0u - Bits(a.integer)) : a.integer;
+                break;
+            case EExpressionOpCode::IntLess:
+                target.integer = (a.integer < b.integer) ? 1 : 0;
+                break;
+            case EExpressionOpCode::IntLessEqual:
+                target.integer = (a.integer <= b.integer) ? 1 : 0;
+                break;
+            case EExpressionOpCode::IntEqual:
+                target.integer = (a.integer == b.integer) ? 1 : 0;
+                break;
+            case EExpressionOpCode::IntNotEqual:
+                target.integer = (a.integer != b.integer) ? 1 : 0;
+                break;
+            case EExpressionOpCode::BoolAnd:
+                target.integer = a.integer & b.integer;
+                break;
+            case EExpressionOpCode::BoolOr:
+                target.integer = a.integer | b.integer;
+                break;
+            case EExpressionOpCode::BoolNot:
+                target.integer = 1 - a.integer;
+                break;
+            case EExpressionOpCode::IntToFloat:
+                target.components[0] = static_cast<float>(a.integer);
+                break;
+            case EExpressionOpCode::FloatToInt:
+            {
+                const float value = std::trunc(a.components[0]);
+                // Float to int conversion of values which don't fit is undefined behavior, thus the range check
+                if (!(value >= static_cast<float>(std::numeric_limits<int32_t>::min()) && value < static_cast<float>(std::numeric_limits<int32_t>::max())))
+                {
+                    return fmt::format("can't convert {} to an integer", a.components[0]);
+                }
+                target.integer = static_cast<int32_t>(value);
+                break;
+            }
+            case EExpressionOpCode::Splat:
+                target.components.fill(a.components[0]);
+                break;
+            case EExpressionOpCode::Swizzle:
+            {
+                const std::array<float, 4> source = a.components;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    target.components[i] = source[(instruction.operand1 >> (2u * i)) & 3u];
+                }
+                break;
+            }
+            case EExpressionOpCode::Insert:
+                for (size_t i = 0; i < size; ++i)
+                {
+                    target.components[instruction.operand1 + i] = a.components[i];
+                }
+                break;
+            case EExpressionOpCode::Length:
+                target.components[0] = std::sqrt(Dot(a, a, size));
+                break;
+            case EExpressionOpCode::Distance:
+            {
+                ExpressionValue difference;
+                Binary(difference, a, b, size, [](float x, float y) { return x - y; });
+                target.components[0] = std::sqrt(Dot(difference, difference, size));
+                break;
+            }
+            case EExpressionOpCode::Dot:
+                target.components[0] = Dot(a, b, size);
+                break;
+            case EExpressionOpCode::Normalize:
+            {
+                // Zero vectors stay zero instead of becoming NaN
+                const float length = std::sqrt(Dot(a, a, size));
+                const float inverseLength = (length > 0.f) ? 1.f / length : 0.f;
+                Unary(target, a, size, [inverseLength](float x) { return x * inverseLength; });
+                break;
+            }
+            case EExpressionOpCode::Cross:
+            {
+                const std::array<float, 4> x = a.components;
+                const std::array<float, 4> y = b.components;
+                target.components[0] = x[1] * y[2] - x[2] * y[1];
+                target.components[1] = x[2] * y[0] - x[0] * y[2];
+                target.components[2] = x[0] * y[1] - x[1] * y[0];
+                break;
+            }
+            case EExpressionOpCode::Select:
+                target = (a.integer != 0) ? b : c;
+                break;
+            case EExpressionOpCode::Jump:
+                index += instruction.operand1;
+                break;
+            case EExpressionOpCode::JumpIfFalse:
+                index += (a.integer == 0) ? instruction.operand1 : 0u;
+                break;
+            case EExpressionOpCode::JumpIfTrue:
+                index += (a.integer != 0) ? instruction.operand1 : 0u;
+                break;
+            }
+        }
+
+        return std::nullopt;
+    }
+}
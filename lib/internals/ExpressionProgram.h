@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Register of an expression program. Floats and float vectors use the components, integers and
+    // booleans (0 or 1) use the integer
+    struct ExpressionValue
+    {
+        std::array<float, 4> components{};
+        int32_t integer = 0;
+    };
+
+    // Float instructions work on the first 'size' components of their operands, the others are undefined
+    enum class EExpressionOpCode : uint8_t
+    {
+        FloatAdd,
+        FloatSubtract,
+        FloatMultiply,
+        FloatDivide,
+        FloatModulo,
+        FloatMin,
+        FloatMax,
+        FloatPower,
+        FloatAtan2,
+        FloatClamp,
+        FloatLerp,
+        FloatNegate,
+        FloatAbs,
+        FloatFloor,
+        FloatCeil,
+        FloatSqrt,
+        FloatSin,
+        FloatCos,
+        FloatTan,
+        FloatAsin,
+        FloatAcos,
+        FloatAtan,
+        FloatExp,
+        FloatLog,
+        FloatLess,
+        FloatLessEqual,
+        FloatEqual,
+        FloatNotEqual,
+        IntAdd,
+        IntSubtract,
+        IntMultiply,
+        IntModulo,
+        IntMin,
+        IntMax,
+        IntClamp,
+        IntNegate,
+        IntAbs,
+        IntLess,
+        IntLessEqual,
+        IntEqual,
+        IntNotEqual,
+        BoolAnd,
+        BoolOr,
+        BoolNot,
+        IntToFloat,
+        FloatToInt,
+        // target = operand0.components[0] in all components
+        Splat,
+        // target.components[i] = operand0.components[(operand1 >> 2i) & 3]
+        Swizzle,
+        // target.components[operand1 + i] = operand0.components[i]
+        Insert,
+        Length,
+        Distance,
+        Dot,
+        Normalize,
+        Cross,
+        // target = operand0 ? operand1 : operand2
+        Select,
+        // Skip the next operand1 instructions (if operand0 is false/true for the conditional jumps)
+        Jump,
+        JumpIfFalse,
+        JumpIfTrue
+    };
+
+    struct ExpressionInstruction
+    {
+        EExpressionOpCode opCode = EExpressionOpCode::FloatAdd;
+        uint8_t size = 1u;
+        uint16_t target = 0u;
+        uint16_t operand0 = 0u;
+        uint16_t operand1 = 0u;
+        uint16_t operand2 = 0u;
+    };
+
+    // Compiled expressions of an expression node (see ExpressionCompiler). The first registers hold the inputs
+    // (in order of declaration) and are written before each execution, followed by constants and temporaries.
+    // Temporaries are never shared, thus instructions never read a register after it was overwritten. The branches of
+    // select(), 'and' and 'or' which are not taken are jumped over, their registers keep values of earlier executions.
+    struct ExpressionProgram
+    {
+        // Returns an error message if the program can't be evaluated for the current inputs
+        [[nodiscard]] std::optional<std::string> execute();
+
+        std::vector<ExpressionValue> registers;
+        std::vector<ExpressionInstruction> instructions;
+        // Register which holds the value of each output (in order of declaration) after execution
+        std::vector<uint16_t> outputRegisters;
+    };
+}
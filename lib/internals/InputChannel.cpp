@@ -0,0 +1,144 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/InputChannel.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+namespace rlogic::internal
+{
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Input channel words must have the size of uint32");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Input channels require lock-free 32 bit atomics to be usable across processes");
+
+    namespace
+    {
+        template <typename T>
+        T FromWord(uint32_t word)
+        {
+            static_assert(sizeof(T) == sizeof(uint32_t));
+            T value;
+            std::memcpy(&value, &word, sizeof(uint32_t));
+            return value;
+        }
+
+        template <typename T, size_t N>
+        std::array<T, N> FromWords(const std::vector<uint32_t>& words, size_t firstWord)
+        {
+            std::array<T, N> values{};
+            for (size_t i = 0; i < N; ++i)
+            {
+                values[i] = FromWord<T>(words[firstWord + i]);
+            }
+            return values;
+        }
+
+        PropertyValue ToPropertyValue(EPropertyType type, const std::vector<uint32_t>& words, size_t firstWord)
+        {
+            switch (type)
+            {
+            case EPropertyType::Float:
+                return FromWord<float>(words[firstWord]);
+            case EPropertyType::Vec2f:
+                return FromWords<float, 2>(words, firstWord);
+            case EPropertyType::Vec3f:
+                return FromWords<float, 3>(words, firstWord);
+            case EPropertyType::Vec4f:
+                return FromWords<float, 4>(words, firstWord);
+            case EPropertyType::Int32:
+                return FromWord<int32_t>(words[firstWord]);
+            case EPropertyType::Vec2i:
+                return FromWords<int32_t, 2>(words, firstWord);
+            case EPropertyType::Vec3i:
+                return FromWords<int32_t, 3>(words, firstWord);
+            case EPropertyType::Vec4i:
+                return FromWords<int32_t, 4>(words, firstWord);
+            case EPropertyType::Bool:
+                return words[firstWord] != 0u;
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                break;
+            }
+
+            assert(false && "Type not supported by input channels, must be rejected when attaching!");
+            return false;
+        }
+    }
+
+    InputChannel::InputChannel(const void* memory, size_t size, std::vector<Field> fields)
+        : m_words(static_cast<const std::atomic<uint32_t>*>(memory))
+        , m_wordCount(size / WordSize)
+        , m_fields(std::move(fields))
+        , m_readBuffer(m_wordCount, 0u)
+    {
+    }
+
+    bool InputChannel::read(uint32_t& sequence)
+    {
+        sequence = m_words[0].load(std::memory_order_acquire);
+        if ((sequence & 1u) != 0u)
+        {
+            // Writer is in the middle of an update
+            return false;
+        }
+
+        // Acquire loads, so that the counter can't be checked again before all values are read
+        for (const Field& field : m_fields)
+        {
+            for (size_t word = field.firstWord; word < field.firstWord + field.wordCount; ++word)
+            {
+                m_readBuffer[word] = m_words[word].load(std::memory_order_acquire);
+            }
+        }
+
+        return m_words[0].load(std::memory_order_relaxed) == sequence;
+    }
+
+    bool InputChannel::apply()
+    {
+        for (size_t attempt = 0; attempt < MaxReadAttempts; ++attempt)
+        {
+            uint32_t sequence = 0u;
+            if (!read(sequence))
+            {
+                continue;
+            }
+
+            if (sequence == m_appliedSequence)
+            {
+                // Nothing written since last time
+                return true;
+            }
+
+            for (const Field& field : m_fields)
+            {
+                // Same checks and logs as Property::set, the property could have been linked after attaching the channel
+                (void)field.property->setValue_PublicApi(ToPropertyValue(field.property->getType(), m_readBuffer, field.firstWord));
+            }
+            m_appliedSequence = sequence;
+            return true;
+        }
+
+        return false;
+    }
+
+    void InputChannel::removeFieldsOf(const LogicNodeImpl& logicNode)
+    {
+        m_fields.erase(std::remove_if(m_fields.begin(), m_fields.end(), [&logicNode](const Field& field) {
+            return &field.property->getLogicNode() == &logicNode;
+        }), m_fields.end());
+    }
+
+    const void* InputChannel::getMemory() const
+    {
+        return m_words;
+    }
+}
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/PropertyImpl.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+
+    // Reads input values from a memory block which is written by another thread or process (usually shared memory).
+    // The block is protected by a sequence lock: the first word is a counter which the writer increments before
+    // (to an odd value) and after (to an even value) writing. All accesses are atomic word accesses, so there are
+    // no locks and no system calls involved, and readers never see values of an incomplete write
+    class InputChannel
+    {
+    public:
+        struct Field
+        {
+            size_t firstWord = 0u;
+            size_t wordCount = 0u;
+            PropertyImpl* property = nullptr;
+        };
+
+        InputChannel(const void* memory, size_t size, std::vector<Field> fields);
+
+        // Applies the values of the block to the properties if the writer published a new version since the last call.
+        // Returns false if the block was being written during each attempt to read it, then the values are applied
+        // with one of the next calls
+        bool apply();
+
+        void removeFieldsOf(const LogicNodeImpl& logicNode);
+
+        [[nodiscard]] const void* getMemory() const;
+
+        static constexpr size_t WordSize = sizeof(uint32_t);
+        static constexpr size_t MaxReadAttempts = 4u;
+
+    private:
+        const std::atomic<uint32_t>* m_words = nullptr;
+        size_t m_wordCount = 0u;
+        std::vector<Field> m_fields;
+        // Values of all fields, read together before the sequence counter is checked again
+        std::vector<uint32_t> m_readBuffer;
+        // Wider than the counter, so that the first apply() always applies the values
+        uint64_t m_appliedSequence = std::numeric_limits<uint64_t>::max();
+
+        bool read(uint32_t& sequence);
+    };
+}
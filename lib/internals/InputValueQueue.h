@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/BoundedMpmcQueue.h"
+#include "impl/PropertyImpl.h"
+
+namespace rlogic::internal
+{
+    struct QueuedInputValue
+    {
+        PropertyImpl* property = nullptr;
+        PropertyValue value;
+    };
+
+    // Property values queued by any thread (see LogicEngine::enqueueInputValue) and popped by the update thread
+    class InputValueQueue : public BoundedMpmcQueue<QueuedInputValue>
+    {
+    public:
+        using BoundedMpmcQueue::BoundedMpmcQueue;
+
+        [[nodiscard]] bool push(PropertyImpl& property, PropertyValue value)
+        {
+            return BoundedMpmcQueue::push([&property, &value](QueuedInputValue& queuedValue) {
+                queuedValue.property = &property;
+                queuedValue.value = std::move(value);
+            });
+        }
+
+        [[nodiscard]] bool pop(PropertyImpl*& property, PropertyValue& value)
+        {
+            return BoundedMpmcQueue::pop([&property, &value](QueuedInputValue& queuedValue) {
+                property = queuedValue.property;
+                value = std::move(queuedValue.value);
+            });
+        }
+    };
+}
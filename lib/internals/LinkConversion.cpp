@@ -0,0 +1,147 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LinkConversion.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        double ReadComponent(const PropertyValue& value, size_t index)
+        {
+            return std::visit([index](const auto& typedValue) -> double {
+                using ValueType = std::decay_t<decltype(typedValue)>;
+                if constexpr (std::is_same_v<ValueType, std::string>)
+                {
+                    assert(false && "Strings can't be converted");
+                    return 0.0;
+                }
+                else if constexpr (std::is_same_v<ValueType, bool>)
+                {
+                    return typedValue ? 1.0 : 0.0;
+                }
+                else if constexpr (std::is_arithmetic_v<ValueType>)
+                {
+                    return static_cast<double>(typedValue);
+                }
+                else
+                {
+                    return static_cast<double>(typedValue[index]);
+                }
+            }, value);
+        }
+
+        template <typename T>
+        T ConvertComponent(double component)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return component != 0.0;
+            }
+            else if constexpr (std::is_same_v<T, int32_t>)
+            {
+                // Out of range float to int conversion is undefined behavior, thus saturate explicitly
+                if (std::isnan(component))
+                {
+                    return 0;
+                }
+                const double truncated = std::trunc(component);
+                if (truncated <= static_cast<double>(std::numeric_limits<int32_t>::min()))
+                {
+                    return std::numeric_limits<int32_t>::min();
+                }
+                if (truncated >= static_cast<double>(std::numeric_limits<int32_t>::max()))
+                {
+                    return std::numeric_limits<int32_t>::max();
+                }
+                return static_cast<int32_t>(truncated);
+            }
+            else
+            {
+                return static_cast<T>(component);
+            }
+        }
+
+        void WriteComponent(PropertyValue& value, size_t index, double component)
+        {
+            std::visit([index, component](auto& typedValue) {
+                using ValueType = std::decay_t<decltype(typedValue)>;
+                if constexpr (std::is_same_v<ValueType, std::string>)
+                {
+                    assert(false && "Strings can't be converted");
+                }
+                else if constexpr (std::is_arithmetic_v<ValueType>)
+                {
+                    typedValue = ConvertComponent<ValueType>(component);
+                }
+                else
+                {
+                    typedValue[index] = ConvertComponent<typename ValueType::value_type>(component);
+                }
+            }, value);
+        }
+    }
+
+    size_t LinkConversion::GetComponentCount(EPropertyType type)
+    {
+        switch (type)
+        {
+        case EPropertyType::Float:
+        case EPropertyType::Int32:
+        case EPropertyType::Bool:
+            return 1u;
+        case EPropertyType::Vec2f:
+        case EPropertyType::Vec2i:
+            return 2u;
+        case EPropertyType::Vec3f:
+        case EPropertyType::Vec3i:
+            return 3u;
+        case EPropertyType::Vec4f:
+        case EPropertyType::Vec4i:
+            return 4u;
+        case EPropertyType::String:
+        case EPropertyType::Struct:
+        case EPropertyType::Array:
+            break;
+        }
+        return 0u;
+    }
+
+    bool LinkConversion::CanConvert(EPropertyType sourceType, EPropertyType targetType)
+    {
+        const size_t componentCount = GetComponentCount(sourceType);
+        return componentCount != 0u && componentCount == GetComponentCount(targetType);
+    }
+
+    void LinkConversion::Apply(const PropertyLink& link, PropertyValue& targetValue)
+    {
+        const PropertyValue& sourceValue = link.source->getValue();
+        switch (link.kind)
+        {
+        case ELinkKind::Direct:
+            targetValue = sourceValue;
+            break;
+        case ELinkKind::Conversion:
+        {
+            const size_t componentCount = GetComponentCount(link.source->getType());
+            for (size_t i = 0u; i < componentCount; ++i)
+            {
+                WriteComponent(targetValue, i, ReadComponent(sourceValue, i));
+            }
+            break;
+        }
+        case ELinkKind::Component:
+            WriteComponent(targetValue, link.targetComponent, ReadComponent(sourceValue, link.sourceComponent));
+            break;
+        }
+    }
+}
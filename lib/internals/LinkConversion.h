@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/LogicNodeConnector.h"
+#include "impl/PropertyImpl.h"
+
+namespace rlogic::internal
+{
+    // Value conversions executed by converting and component links during link propagation
+    class LinkConversion
+    {
+    public:
+        // Returns the number of components which can be converted (0 for types which can't be converted, e.g. strings)
+        [[nodiscard]] static size_t GetComponentCount(EPropertyType type);
+
+        // Numbers, booleans and numeric vectors can be converted into each other if they have the same number of components
+        [[nodiscard]] static bool CanConvert(EPropertyType sourceType, EPropertyType targetType);
+
+        // Writes the value of the link's source into targetValue. Float to integer conversion truncates
+        // and saturates at the limits of int32 (NaN becomes 0), numbers convert to true if they are not zero
+        static void Apply(const PropertyLink& link, PropertyValue& targetValue);
+    };
+}
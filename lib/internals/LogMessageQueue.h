@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/BoundedMpmcQueue.h"
+#include "ramses-logic/ELogMessageType.h"
+
+#include <string>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    // Each cell keeps its string, so that messages up to ReservedMessageSize don't allocate memory
+    struct QueuedLogMessage
+    {
+        static constexpr size_t ReservedMessageSize = 256u;
+
+        QueuedLogMessage()
+        {
+            message.reserve(ReservedMessageSize);
+        }
+
+        ELogMessageType messageType = ELogMessageType::Info;
+        std::string message;
+    };
+
+    // Log messages pushed by any thread with asynchronous logging and popped by the output thread of the logger
+    class LogMessageQueue : public BoundedMpmcQueue<QueuedLogMessage>
+    {
+    public:
+        using BoundedMpmcQueue::BoundedMpmcQueue;
+
+        [[nodiscard]] bool push(ELogMessageType messageType, std::string_view message)
+        {
+            return BoundedMpmcQueue::push([messageType, message](QueuedLogMessage& queuedMessage) {
+                queuedMessage.messageType = messageType;
+                // Reuses the memory of the cell's string
+                queuedMessage.message.assign(message);
+            });
+        }
+
+        [[nodiscard]] bool pop(ELogMessageType& messageType, std::string& message)
+        {
+            return BoundedMpmcQueue::pop([&messageType, &message](const QueuedLogMessage& queuedMessage) {
+                messageType = queuedMessage.messageType;
+                message.assign(queuedMessage.message);
+            });
+        }
+    };
+}
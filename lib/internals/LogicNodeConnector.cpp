@@ -20,20 +20,134 @@
 namespace rlogic::internal
 {
 
-    bool LogicNodeConnector::link(const PropertyImpl& output, const PropertyImpl& input)
+    bool LogicNodeConnector::link(const PropertyImpl& output, const PropertyImpl& input, ELinkKind kind, uint8_t sourceComponent, uint8_t targetComponent)
     {
         assert(TypeUtils::IsPrimitiveType(output.getType()));
         assert(TypeUtils::IsPrimitiveType(input.getType()));
 
-        if (m_links.end() != m_links.find(&input))
+        if (isLinkedByParent(input))
         {
             return false;
         }
-        m_links.insert({&input, &output});
+
+        const auto [linksBegin, linksEnd] = m_links.equal_range(&input);
+        for (auto iter = linksBegin; iter != linksEnd; ++iter)
+        {
+            // Component links can share an input as long as each of them writes a different component
+            const PropertyLink& existingLink = iter->second;
+            if (kind != ELinkKind::Component || existingLink.kind != ELinkKind::Component || existingLink.targetComponent == targetComponent)
+            {
+                return false;
+            }
+        }
+        m_links.insert({&input, PropertyLink{&output, kind, sourceComponent, targetComponent, NotPropagatedVersion, {}}});
 
         return true;
     }
 
+    namespace
+    {
+        void CollectLeaves(const PropertyImpl& output, PropertyImpl& input, LinkedLeaves& leaves)
+        {
+            assert(output.getChildCount() == input.getChildCount());
+            for (size_t i = 0; i < input.getChildCount(); ++i)
+            {
+                const PropertyImpl& outputChild = *output.getChild(i)->m_impl;
+                PropertyImpl& inputChild = *input.getChild(i)->m_impl;
+                if (TypeUtils::CanHaveChildren(inputChild.getType()))
+                {
+                    CollectLeaves(outputChild, inputChild, leaves);
+                }
+                else
+                {
+                    leaves.push_back(LinkedLeaf{&outputChild, &inputChild, NotPropagatedVersion});
+                }
+            }
+        }
+    }
+
+    bool LogicNodeConnector::linkComplex(const PropertyImpl& output, PropertyImpl& input)
+    {
+        assert(TypeUtils::CanHaveChildren(output.getType()));
+        assert(TypeUtils::CanHaveChildren(input.getType()));
+
+        if (isLinkedByParent(input) || isLinkedRecursive(input))
+        {
+            return false;
+        }
+
+        PropertyLink link{&output, ELinkKind::Direct, 0u, 0u, NotPropagatedVersion, {}};
+        CollectLeaves(output, input, link.leaves);
+        for (const auto& leaf : link.leaves)
+        {
+            m_leavesLinkedByParent.emplace(leaf.target, &input);
+        }
+        m_links.insert({&input, std::move(link)});
+
+        return true;
+    }
+
+    bool LogicNodeConnector::isLinkedByParent(const PropertyImpl& input) const
+    {
+        if (TypeUtils::CanHaveChildren(input.getType()))
+        {
+            // Structs and arrays are covered by a parent link if their children are
+            for (size_t i = 0; i < input.getChildCount(); ++i)
+            {
+                if (isLinkedByParent(*input.getChild(i)->m_impl))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return m_leavesLinkedByParent.find(&input) != m_leavesLinkedByParent.end();
+    }
+
+    bool LogicNodeConnector::isLinkedRecursive(const PropertyImpl& input) const
+    {
+        if (m_links.find(&input) != m_links.end())
+        {
+            return true;
+        }
+        for (size_t i = 0; i < input.getChildCount(); ++i)
+        {
+            if (isLinkedRecursive(*input.getChild(i)->m_impl))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    LinksMap::iterator LogicNodeConnector::eraseLink(LinksMap::iterator link)
+    {
+        for (const auto& leaf : link->second.leaves)
+        {
+            m_leavesLinkedByParent.erase(leaf.target);
+        }
+        return m_links.erase(link);
+    }
+
+    size_t LogicNodeConnector::unlink(const PropertyImpl& output, const PropertyImpl& input)
+    {
+        size_t removedLinks = 0u;
+        auto [iter, linksEnd] = m_links.equal_range(&input);
+        while (iter != linksEnd)
+        {
+            if (iter->second.source == &output)
+            {
+                iter = eraseLink(iter);
+                ++removedLinks;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return removedLinks;
+    }
+
     bool LogicNodeConnector::unlinkPrimitiveInput(const PropertyImpl& input)
     {
         assert(TypeUtils::IsPrimitiveType(input.getType()));
@@ -44,6 +158,12 @@ namespace rlogic::internal
     {
         if (TypeUtils::CanHaveChildren(input.getType()))
         {
+            const auto linkIter = m_links.find(&input);
+            if (linkIter != m_links.end())
+            {
+                eraseLink(linkIter);
+            }
+
             for (size_t i = 0; i < input.getChildCount(); ++i)
             {
                 unlinkInputRecursive(*input.getChild(i)->m_impl);
@@ -58,27 +178,24 @@ namespace rlogic::internal
 
     void LogicNodeConnector::unlinkOutputRecursive(const PropertyImpl& output)
     {
-        if (TypeUtils::CanHaveChildren(output.getType()))
+        // Remove all links which use this output as source for their corresponding input value (structs and arrays can be sources too)
+        for (auto iter = m_links.begin(); iter != m_links.end();)
         {
-            for (size_t i = 0; i < output.getChildCount(); ++i)
+            if (iter->second.source == &output)
             {
-                unlinkOutputRecursive(*output.getChild(i)->m_impl);
+                iter = eraseLink(iter);
+            }
+            else
+            {
+                ++iter;
             }
         }
-        else
+
+        if (TypeUtils::CanHaveChildren(output.getType()))
         {
-            assert(TypeUtils::IsPrimitiveType(output.getType()));
-            // Remove all links which uses this primitive output as source for their corresponding input value
-            for (auto iter = m_links.begin(); iter != m_links.end();)
+            for (size_t i = 0; i < output.getChildCount(); ++i)
             {
-                if (iter->second == &output)
-                {
-                    iter = m_links.erase(iter);
-                }
-                else
-                {
-                    ++iter;
-                }
+                unlinkOutputRecursive(*output.getChild(i)->m_impl);
             }
         }
     }
@@ -107,11 +224,23 @@ namespace rlogic::internal
         const auto iter = m_links.find(&input);
         if (iter != m_links.end())
         {
-            return iter->second;
+            return iter->second.source;
         }
         return nullptr;
     }
 
+    void LogicNodeConnector::resetPropagatedVersions() const
+    {
+        for (const auto& link : m_links)
+        {
+            link.second.propagatedVersion = NotPropagatedVersion;
+            for (const LinkedLeaf& leaf : link.second.leaves)
+            {
+                leaf.propagatedVersion = NotPropagatedVersion;
+            }
+        }
+    }
+
     bool LogicNodeConnector::isLinked(const LogicNodeImpl& logicNode) const
     {
         auto inputs = logicNode.getInputs();
@@ -137,7 +266,7 @@ namespace rlogic::internal
             const auto child = input.getChild(i);
             if (TypeUtils::CanHaveChildren(child->getType()))
             {
-                if(isInputLinked(*child->m_impl))
+                if (m_links.end() != m_links.find(child->m_impl.get()) || isInputLinked(*child->m_impl))
                 {
                     return true;
                 }
@@ -161,23 +290,17 @@ namespace rlogic::internal
         {
             const auto child = output.getChild(i);
 
-            if (TypeUtils::CanHaveChildren(child->getType()))
+            // check if a output of this node is an input of another node (structs and arrays can be linked too)
+            if (m_links.end() != std::find_if(m_links.begin(), m_links.end(), [child](const LinksMap::value_type& it) {
+                    return it.second.source == child->m_impl.get();
+                }))
             {
-                if (isOutputLinked(*child->m_impl))
-                {
-                    return true;
-                }
+                return true;
             }
-            else
+
+            if (TypeUtils::CanHaveChildren(child->getType()) && isOutputLinked(*child->m_impl))
             {
-                assert(TypeUtils::IsPrimitiveType(child->getType()));
-                // check if a output of this node is an input of another node
-                if (m_links.end() != std::find_if(m_links.begin(), m_links.end(), [child](const std::unordered_map<const PropertyImpl*, const PropertyImpl*>::value_type& it) {
-                        return it.second == child->m_impl.get();
-                    }))
-                {
-                    return true;
-                }
+                return true;
             }
         }
         return false;
@@ -12,22 +12,75 @@
 #include <unordered_map>
 
 #include <optional>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace rlogic::internal
 {
     class PropertyImpl;
     class LogicNodeImpl;
 
-    using LinksMap = std::unordered_map<const PropertyImpl*, const PropertyImpl*>;
+    enum class ELinkKind : uint8_t
+    {
+        // Copies the value of the source property, source and target have the same type
+        Direct = 0,
+        // Converts the value of the source property component-wise to the type of the target
+        Conversion = 1,
+        // Converts a single component of the source and writes it into a single component of the target
+        Component = 2,
+    };
+
+    // Change version of a link which never propagated a value, guarantees that new links are always executed once
+    constexpr uint64_t NotPropagatedVersion = std::numeric_limits<uint64_t>::max();
+
+    // Primitive source and target property of a linked struct/array
+    struct LinkedLeaf
+    {
+        const PropertyImpl* source = nullptr;
+        PropertyImpl* target = nullptr;
+        mutable uint64_t propagatedVersion = NotPropagatedVersion;
+    };
+
+    using LinkedLeaves = std::vector<LinkedLeaf>;
+
+    struct PropertyLink
+    {
+        const PropertyImpl* source = nullptr;
+        ELinkKind kind = ELinkKind::Direct;
+        uint8_t sourceComponent = 0;
+        uint8_t targetComponent = 0;
+        // Change version of the source which was last propagated over this link. Links are skipped as long as
+        // the source keeps its version. Mutable because it's execution state, not part of the link topology
+        mutable uint64_t propagatedVersion = NotPropagatedVersion;
+        // Only used by links of structs and arrays: all primitive children of source and target, flattened
+        // once when linking so that propagation is a single loop instead of a recursive traversal
+        LinkedLeaves leaves;
+    };
+
+    // Key is the linked input. An input has either exactly one direct/converting link, or one component link
+    // per linked component (e.g. a VEC3F assembled from three floats). Structs and arrays are linked with a
+    // single direct link on the struct/array itself
+    using LinksMap = std::unordered_multimap<const PropertyImpl*, PropertyLink>;
 
     class LogicNodeConnector
     {
     public:
-        [[nodiscard]] bool link(const PropertyImpl& output, const PropertyImpl& input);
+        [[nodiscard]] bool link(const PropertyImpl& output, const PropertyImpl& input, ELinkKind kind = ELinkKind::Direct, uint8_t sourceComponent = 0u, uint8_t targetComponent = 0u);
+        // Removes all links from output to input, returns the number of removed links
+        size_t unlink(const PropertyImpl& output, const PropertyImpl& input);
+        // Links all children of output to the children of input with the same structure
+        [[nodiscard]] bool linkComplex(const PropertyImpl& output, PropertyImpl& input);
+        // True if the property receives its value from a link of one of its parent structs/arrays
+        [[nodiscard]] bool isLinkedByParent(const PropertyImpl& input) const;
+        // True if the struct/array or any of its children is linked
+        [[nodiscard]] bool isLinkedRecursive(const PropertyImpl& input) const;
         bool unlinkPrimitiveInput(const PropertyImpl& input);
         void unlinkAll(const LogicNodeImpl& logicNode);
         [[nodiscard]] bool isLinked(const LogicNodeImpl& logicNode) const;
         [[nodiscard]] const PropertyImpl* getLinkedOutput(const PropertyImpl& input) const;
+        // All links propagate again in the next update, needed when their targets were overwritten (e.g. by restoring a snapshot)
+        void resetPropagatedVersions() const;
 
         // TODO Violin refactor this (class should not have to expose internal data). Currently still used for serialization
         [[nodiscard]] const LinksMap& getLinks() const
@@ -37,6 +90,10 @@ namespace rlogic::internal
 
     private:
         LinksMap m_links;
+        // Primitive inputs which are written by a struct/array link, mapped to the linked struct/array
+        std::unordered_map<const PropertyImpl*, const PropertyImpl*> m_leavesLinkedByParent;
+
+        LinksMap::iterator eraseLink(LinksMap::iterator link);
 
         [[nodiscard]] bool isInputLinked(PropertyImpl& input) const;
         [[nodiscard]] bool isOutputLinked(PropertyImpl& output) const;
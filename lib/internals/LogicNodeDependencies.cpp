@@ -15,12 +15,43 @@
 
 #include "internals/ErrorReporting.h"
 #include "internals/TypeUtils.h"
+#include "internals/LinkConversion.h"
 
 #include <cassert>
 #include "fmt/format.h"
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        // Compares the structure of two structs/arrays, but not their own names
+        bool HaveSameChildren(const PropertyImpl& output, const PropertyImpl& input)
+        {
+            if (output.getType() != input.getType() || output.getChildCount() != input.getChildCount())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < input.getChildCount(); ++i)
+            {
+                if (!output.getChild(i)->m_impl->hasSameStructureAs(*input.getChild(i)->m_impl))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Children of linked structs and arrays are treated like linked inputs, i.e. they can't be set
+        void SetIsLinkedInputRecursive(PropertyImpl& input, bool isLinkedInput)
+        {
+            input.setIsLinkedInput(isLinkedInput);
+            for (size_t i = 0; i < input.getChildCount(); ++i)
+            {
+                SetIsLinkedInputRecursive(*input.getChild(i)->m_impl, isLinkedInput);
+            }
+        }
+    }
 
     void LogicNodeDependencies::addNode(LogicNodeImpl& node)
     {
@@ -64,12 +95,22 @@ namespace rlogic::internal
         return m_logicNodeConnector.getLinkedOutput(inputProperty);
     }
 
+    void LogicNodeDependencies::resetPropagatedLinkVersions() const
+    {
+        m_logicNodeConnector.resetPropagatedVersions();
+    }
+
     const LinksMap& LogicNodeDependencies::getLinks() const
     {
         return m_logicNodeConnector.getLinks();
     }
 
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting)
+    {
+        return link(output, input, ELinkKind::Direct, 0u, 0u, errorReporting);
+    }
+
+    bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, ELinkKind kind, size_t sourceComponent, size_t targetComponent, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
         {
@@ -97,7 +138,7 @@ namespace rlogic::internal
             return false;
         }
 
-        if (output.getType() != input.getType())
+        if (kind == ELinkKind::Direct && output.getType() != input.getType())
         {
             errorReporting.add(fmt::format("Types of source property '{}:{}' does not match target property '{}:{}'",
                 output.getName(),
@@ -107,17 +148,71 @@ namespace rlogic::internal
             return false;
         }
 
-        // No need to also test input type, above check already makes sure output and input are of the same type
-        if (!TypeUtils::IsPrimitiveType(output.getType()))
+        const bool isComplexLink = TypeUtils::CanHaveChildren(input.getType());
+        if (isComplexLink && kind == ELinkKind::Direct)
+        {
+            const Property* rootOutputs = output.getLogicNode().getOutputs();
+            if (&input == input.getLogicNode().getInputs()->m_impl.get() || (nullptr != rootOutputs && &output == rootOutputs->m_impl.get()))
+            {
+                errorReporting.add("Can't link the root inputs or outputs of a LogicNode, link their children instead");
+                return false;
+            }
+
+            if (!HaveSameChildren(output, input))
+            {
+                errorReporting.add(fmt::format("Can't link property '{}' to property '{}', structs and arrays can only be linked if their children have the same names and types",
+                    output.getName(),
+                    input.getName()));
+                return false;
+            }
+        }
+
+        if (kind == ELinkKind::Conversion && !LinkConversion::CanConvert(output.getType(), input.getType()))
         {
-            errorReporting.add(fmt::format("Can't link properties of complex types directly, currently only primitive properties can be linked"));
+            errorReporting.add(fmt::format("Can't convert source property '{}:{}' to target property '{}:{}' (only numbers, booleans and numeric vectors with the same number of components can be converted)",
+                output.getName(),
+                GetLuaPrimitiveTypeName(output.getType()),
+                input.getName(),
+                GetLuaPrimitiveTypeName(input.getType())));
             return false;
         }
 
+        if (kind == ELinkKind::Component)
+        {
+            const size_t sourceComponentCount = LinkConversion::GetComponentCount(output.getType());
+            const size_t targetComponentCount = LinkConversion::GetComponentCount(input.getType());
+            if (sourceComponent >= sourceComponentCount || targetComponent >= targetComponentCount)
+            {
+                errorReporting.add(fmt::format("Can't link component {} of source property '{}:{}' to component {} of target property '{}:{}' (component index out of range or type has no components)",
+                    sourceComponent,
+                    output.getName(),
+                    GetLuaPrimitiveTypeName(output.getType()),
+                    targetComponent,
+                    input.getName(),
+                    GetLuaPrimitiveTypeName(input.getType())));
+                return false;
+            }
+        }
+
         auto& targetNode = input.getLogicNode();
         auto& node = output.getLogicNode();
 
-        if (!m_logicNodeConnector.link(output, input))
+        if (m_logicNodeConnector.isLinkedByParent(input))
+        {
+            errorReporting.add(fmt::format("The property '{}' of LogicNode '{}' is already linked as a part of a linked struct or array", input.getName(), targetNode.getName()));
+            return false;
+        }
+
+        if (isComplexLink && m_logicNodeConnector.isLinkedRecursive(input) && m_logicNodeConnector.getLinkedOutput(input) == nullptr)
+        {
+            errorReporting.add(fmt::format("The property '{}' of LogicNode '{}' has linked children, unlink them before linking the whole struct or array", input.getName(), targetNode.getName()));
+            return false;
+        }
+
+        const bool linked = isComplexLink ?
+            m_logicNodeConnector.linkComplex(output, input) :
+            m_logicNodeConnector.link(output, input, kind, static_cast<uint8_t>(sourceComponent), static_cast<uint8_t>(targetComponent));
+        if (!linked)
         {
             errorReporting.add(fmt::format("The property '{}' of LogicNode '{}' is already linked to the property '{}' of LogicNode '{}'",
                 output.getName(),
@@ -127,7 +222,7 @@ namespace rlogic::internal
             ));
             return false;
         }
-        input.setIsLinkedInput(true);
+        SetIsLinkedInputRecursive(input, true);
 
         // TODO Violin below code sets two different things to dirty. Try to not have redundant dirty
         // flags and consolidate dirtiness to one place
@@ -143,13 +238,9 @@ namespace rlogic::internal
 
     bool LogicNodeDependencies::unlink(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting)
     {
-        if (TypeUtils::CanHaveChildren(input.getType()))
-        {
-            errorReporting.add(fmt::format("Can't unlink properties of complex types directly!"));
-            return false;
-        }
-
-        if (!m_logicNodeConnector.unlinkPrimitiveInput(input))
+        // Removes all links between the two properties at once (an input can have several component links from the same output)
+        const size_t removedLinks = m_logicNodeConnector.unlink(output, input);
+        if (removedLinks == 0u)
         {
             errorReporting.add(fmt::format("No link available from source property '{}' to target property '{}'", output.getName(), input.getName()));
             return false;
@@ -157,9 +248,13 @@ namespace rlogic::internal
 
         auto& node = output.getLogicNode();
         auto& targetNode = input.getLogicNode();
-        input.setIsLinkedInput(false);
+        // Other component links might still write into the input
+        SetIsLinkedInputRecursive(input, m_logicNodeConnector.getLinkedOutput(input) != nullptr);
 
-        m_logicNodeDAG.removeEdge(node, targetNode);
+        for (size_t i = 0u; i < removedLinks; ++i)
+        {
+            m_logicNodeDAG.removeEdge(node, targetNode);
+        }
 
         return true;
     }
@@ -34,10 +34,12 @@ namespace rlogic::internal
 
         // Link management
         bool link(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting);
+        bool link(PropertyImpl& output, PropertyImpl& input, ELinkKind kind, size_t sourceComponent, size_t targetComponent, ErrorReporting& errorReporting);
         bool unlink(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting);
         [[nodiscard]] bool isLinked(const LogicNodeImpl& node) const;
         [[nodiscard]] const LinksMap& getLinks() const;
         [[nodiscard]] const PropertyImpl* getLinkedOutput(PropertyImpl& inputProperty) const;
+        void resetPropagatedLinkVersions() const;
 
     private:
         // TODO Violin redesign these classes, they have redundant data
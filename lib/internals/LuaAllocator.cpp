@@ -0,0 +1,211 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace rlogic::internal
+{
+    static_assert(LuaAllocator::SizeClassGranularity >= sizeof(void*), "Free blocks must be able to hold a pointer");
+    static_assert(LuaAllocator::SizeClassGranularity % alignof(std::max_align_t) == 0, "Pooled blocks must be aligned like malloc'ed memory");
+    static_assert(LuaAllocator::PoolChunkSize % LuaAllocator::MaxPooledBlockSize == 0, "Pool chunks must be a multiple of the largest pooled block");
+
+    LuaAllocator::LuaAllocator(size_t memoryLimit)
+        : m_memoryLimit(memoryLimit)
+    {
+        m_statistics.memoryLimit = memoryLimit;
+    }
+
+    LuaAllocator::~LuaAllocator() noexcept
+    {
+        // The Lua state is closed before its allocator, all blocks were returned already
+        assert(m_statistics.liveAllocations == 0u);
+    }
+
+    void* LuaAllocator::Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept
+    {
+        return static_cast<LuaAllocator*>(userData)->reallocate(ptr, oldSize, newSize);
+    }
+
+    void LuaAllocator::setMemoryLimit(size_t memoryLimit)
+    {
+        m_memoryLimit = memoryLimit;
+        m_statistics.memoryLimit = memoryLimit;
+    }
+
+    LuaMemoryStatistics LuaAllocator::getStatistics() const
+    {
+        return m_statistics;
+    }
+
+    void* LuaAllocator::reallocate(void* ptr, size_t oldSize, size_t newSize)
+    {
+        // For new blocks, Lua passes the type of the object in oldSize
+        const size_t currentSize = (ptr != nullptr) ? oldSize : 0u;
+
+        if (newSize == 0u)
+        {
+            if (ptr != nullptr)
+            {
+                freeBlock(ptr, currentSize);
+            }
+            return nullptr;
+        }
+
+        // The limit only applies to growing blocks, Lua expects shrinking to succeed
+        if (m_limitActive && m_memoryLimit != 0u && newSize > currentSize && m_statistics.currentBytes - currentSize + newSize > m_memoryLimit)
+        {
+            ++m_statistics.failedAllocations;
+            return nullptr;
+        }
+
+        if (ptr == nullptr)
+        {
+            return allocateBlock(newSize);
+        }
+
+        if (IsPooled(currentSize) && IsPooled(newSize) && GetSizeClass(currentSize) == GetSizeClass(newSize))
+        {
+            m_statistics.currentBytes = m_statistics.currentBytes - currentSize + newSize;
+            m_statistics.peakBytes = std::max(m_statistics.peakBytes, m_statistics.currentBytes);
+            return ptr;
+        }
+
+        if (!IsPooled(currentSize) && !IsPooled(newSize))
+        {
+            void* newPtr = std::realloc(ptr, newSize);
+            if (newPtr == nullptr)
+            {
+                return nullptr;
+            }
+            ++m_statistics.totalAllocations;
+            ++m_statistics.systemAllocations;
+            m_statistics.currentBytes = m_statistics.currentBytes - currentSize + newSize;
+            m_statistics.peakBytes = std::max(m_statistics.peakBytes, m_statistics.currentBytes);
+            return newPtr;
+        }
+
+        // Moves between a pool and the system allocator, or between two size classes
+        void* newPtr = allocateBlock(newSize);
+        if (newPtr == nullptr)
+        {
+            // A pooled block which can't move to a smaller size class stays where it is, it is big enough and Lua
+            // returns it with the new size later, i.e. it ends up in the free list of the smaller size class.
+            // A system block can't be kept, it would be freed to a pool. This is the only case in which shrinking
+            // fails, which requires that the system can't provide a new pool chunk anymore
+            if (IsPooled(currentSize) && newSize < currentSize)
+            {
+                m_statistics.currentBytes = m_statistics.currentBytes - currentSize + newSize;
+                return ptr;
+            }
+            return nullptr;
+        }
+        std::memcpy(newPtr, ptr, std::min(currentSize, newSize));
+        freeBlock(ptr, currentSize);
+        return newPtr;
+    }
+
+    void* LuaAllocator::allocateBlock(size_t size)
+    {
+        void* block = nullptr;
+        if (IsPooled(size))
+        {
+            block = allocateFromPool(GetSizeClass(size));
+        }
+        else
+        {
+            block = std::malloc(size);
+            ++m_statistics.systemAllocations;
+        }
+
+        if (block != nullptr)
+        {
+            ++m_statistics.totalAllocations;
+            ++m_statistics.liveAllocations;
+            m_statistics.currentBytes += size;
+            m_statistics.peakBytes = std::max(m_statistics.peakBytes, m_statistics.currentBytes);
+        }
+        return block;
+    }
+
+    void LuaAllocator::freeBlock(void* ptr, size_t size)
+    {
+        assert(m_statistics.liveAllocations > 0u && m_statistics.currentBytes >= size);
+        --m_statistics.liveAllocations;
+        m_statistics.currentBytes -= size;
+
+        if (IsPooled(size))
+        {
+            auto* freeBlock = static_cast<FreeBlock*>(ptr);
+            const size_t sizeClass = GetSizeClass(size);
+            freeBlock->next = m_freeLists[sizeClass];
+            m_freeLists[sizeClass] = freeBlock;
+        }
+        else
+        {
+            std::free(ptr);
+        }
+    }
+
+    void* LuaAllocator::allocateFromPool(size_t sizeClass)
+    {
+        FreeBlock* freeBlock = m_freeLists[sizeClass];
+        if (freeBlock != nullptr)
+        {
+            m_freeLists[sizeClass] = freeBlock->next;
+            return freeBlock;
+        }
+
+        const size_t blockSize = (sizeClass + 1u) * SizeClassGranularity;
+        if (m_chunkBytesLeft < blockSize)
+        {
+            // The rest of the previous chunk is too small for the requested block, add it to the free list of its own size class
+            // (all blocks are multiples of the granularity, so is the rest)
+            if (m_chunkBytesLeft > 0u)
+            {
+                const size_t restClass = GetSizeClass(m_chunkBytesLeft);
+                auto* restBlock = reinterpret_cast<FreeBlock*>(m_chunkCursor);
+                restBlock->next = m_freeLists[restClass];
+                m_freeLists[restClass] = restBlock;
+            }
+
+            std::unique_ptr<std::byte[]> chunk(new (std::nothrow) std::byte[PoolChunkSize]);
+            if (!chunk)
+            {
+                return nullptr;
+            }
+            ++m_statistics.systemAllocations;
+            m_statistics.reservedPoolBytes += PoolChunkSize;
+            m_chunkCursor = chunk.get();
+            m_chunkBytesLeft = PoolChunkSize;
+            m_poolChunks.emplace_back(std::move(chunk));
+        }
+
+        void* block = m_chunkCursor;
+        m_chunkCursor += blockSize;
+        m_chunkBytesLeft -= blockSize;
+        return block;
+    }
+
+    LuaAllocator::ScopedMemoryLimit::ScopedMemoryLimit(LuaAllocator& allocator)
+        : m_allocator(allocator)
+        , m_wasActive(allocator.m_limitActive)
+    {
+        m_allocator.m_limitActive = true;
+    }
+
+    LuaAllocator::ScopedMemoryLimit::~ScopedMemoryLimit() noexcept
+    {
+        m_allocator.m_limitActive = m_wasActive;
+    }
+}
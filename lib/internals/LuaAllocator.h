@@ -0,0 +1,97 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LuaMemoryStatistics.h"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Memory allocator for a Lua state (see lua_Alloc). Small blocks are served from size class pools which
+    // are carved from large chunks and never returned to the system until the allocator is destroyed, i.e.
+    // after warm-up, scripts which create and drop small objects (strings, tables, closures) don't call malloc.
+    // Large blocks are passed to the system allocator.
+    // Lua passes the size of a block to every call, thus the pooled blocks don't need any header.
+    class LuaAllocator
+    {
+    public:
+        explicit LuaAllocator(size_t memoryLimit);
+
+        // Not move-able and not copy-able, the Lua state holds a pointer to the allocator
+        ~LuaAllocator() noexcept;
+        LuaAllocator(LuaAllocator&& other) noexcept = delete;
+        LuaAllocator& operator=(LuaAllocator&& other) noexcept = delete;
+        LuaAllocator(const LuaAllocator& other) = delete;
+        LuaAllocator& operator=(const LuaAllocator& other) = delete;
+
+        // Signature of lua_Alloc, userData is the LuaAllocator
+        static void* Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept;
+
+        // 0 means no limit. The limit is only enforced while it is active (see ScopedMemoryLimit), because Lua
+        // can only report failed allocations gracefully while executing protected calls
+        void setMemoryLimit(size_t memoryLimit);
+        [[nodiscard]] LuaMemoryStatistics getStatistics() const;
+
+        class ScopedMemoryLimit
+        {
+        public:
+            explicit ScopedMemoryLimit(LuaAllocator& allocator);
+            ~ScopedMemoryLimit() noexcept;
+            ScopedMemoryLimit(ScopedMemoryLimit&& other) noexcept = delete;
+            ScopedMemoryLimit& operator=(ScopedMemoryLimit&& other) noexcept = delete;
+            ScopedMemoryLimit(const ScopedMemoryLimit& other) = delete;
+            ScopedMemoryLimit& operator=(const ScopedMemoryLimit& other) = delete;
+
+        private:
+            LuaAllocator& m_allocator;
+            bool m_wasActive;
+        };
+
+        static constexpr size_t SizeClassGranularity = 16u;
+        static constexpr size_t MaxPooledBlockSize = 512u;
+        static constexpr size_t PoolChunkSize = 64u * 1024u;
+
+    private:
+        void* reallocate(void* ptr, size_t oldSize, size_t newSize);
+        [[nodiscard]] void* allocateBlock(size_t size);
+        void freeBlock(void* ptr, size_t size);
+        [[nodiscard]] void* allocateFromPool(size_t sizeClass);
+
+        [[nodiscard]] static constexpr bool IsPooled(size_t size)
+        {
+            return size <= MaxPooledBlockSize;
+        }
+
+        [[nodiscard]] static constexpr size_t GetSizeClass(size_t size)
+        {
+            return (size - 1u) / SizeClassGranularity;
+        }
+
+        static constexpr size_t SizeClassCount = MaxPooledBlockSize / SizeClassGranularity;
+
+        // Each free block holds the pointer to the next free block of the same size class
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        std::array<FreeBlock*, SizeClassCount> m_freeLists {};
+        std::vector<std::unique_ptr<std::byte[]>> m_poolChunks;
+        std::byte* m_chunkCursor = nullptr;
+        size_t m_chunkBytesLeft = 0u;
+
+        size_t m_memoryLimit;
+        bool m_limitActive = false;
+        LuaMemoryStatistics m_statistics;
+    };
+}
@@ -0,0 +1,501 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaMath.h"
+#include "internals/LuaScriptPropertyHandler.h"
+#include "internals/LuaTypeConversions.h"
+#include "internals/SolHelper.h"
+
+#include "impl/PropertyImpl.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <variant>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        constexpr float DegreesToRadians = 3.14159265358979323846f / 180.f;
+
+        template <size_t N>
+        constexpr const char* VectorTypeName()
+        {
+            static_assert(N >= 2 && N <= 4, "Only vec2, vec3 and vec4 are supported");
+            return N == 2 ? "vec2" : (N == 3 ? "vec3" : "vec4");
+        }
+
+        float ExtractFloat(const sol::object& object, std::string_view context)
+        {
+            const std::optional<float> value = LuaTypeConversions::ExtractSpecificType<float>(object);
+            if (!value)
+            {
+                sol_helper::throwSolException("{}: expected a number but received {}!", context, sol_helper::GetSolTypeName(object.get_type()));
+            }
+            return *value;
+        }
+
+        // Reads the components of a vector property with N components (float or int), returns false for other property types
+        template <size_t N>
+        bool ReadVectorProperty(const PropertyImpl& property, std::array<float, N>& components)
+        {
+            const PropertyValue& value = property.getValue();
+            if (const auto* floats = std::get_if<std::array<float, N>>(&value))
+            {
+                components = *floats;
+                return true;
+            }
+            if (const auto* ints = std::get_if<std::array<int32_t, N>>(&value))
+            {
+                for (size_t i = 0; i < N; ++i)
+                {
+                    components[i] = static_cast<float>((*ints)[i]);
+                }
+                return true;
+            }
+            return false;
+        }
+
+        // Constructor arguments: nothing (default value), a single number (all components, if allowed), N numbers,
+        // a table with N numbers, an object of the same type or a property with N components
+        template <size_t N, typename T>
+        std::array<float, N> ExtractComponents(const sol::variadic_args& args, const std::array<float, N>& defaultValue, std::string_view typeName, bool allowScalar)
+        {
+            const size_t argCount = args.size();
+            if (argCount == 0u)
+            {
+                return defaultValue;
+            }
+
+            std::array<float, N> result {};
+            if (argCount == 1u)
+            {
+                const sol::object arg = args.get<sol::object>(0);
+                switch (arg.get_type())
+                {
+                case sol::type::number:
+                    if (allowScalar)
+                    {
+                        result.fill(ExtractFloat(arg, typeName));
+                        return result;
+                    }
+                    break;
+                case sol::type::table:
+                    return LuaTypeConversions::ExtractArray<float, N>(arg.as<sol::table>());
+                case sol::type::userdata:
+                {
+                    if (arg.is<T>())
+                    {
+                        return arg.as<T>().values;
+                    }
+                    if constexpr (N <= 4)
+                    {
+                        const sol::optional<LuaScriptPropertyHandler&> maybeProperty = arg.as<sol::optional<LuaScriptPropertyHandler&>>();
+                        if (maybeProperty && ReadVectorProperty<N>(maybeProperty->getPropertyImpl(), result))
+                        {
+                            return result;
+                        }
+                    }
+                    break;
+                }
+                default:
+                    break;
+                }
+                sol_helper::throwSolException("{}: can't construct from argument of type {}!", typeName, sol_helper::GetSolTypeName(arg.get_type()));
+            }
+
+            if (argCount != N)
+            {
+                sol_helper::throwSolException("{}: expected {} numbers but received {} arguments!", typeName, N, argCount);
+            }
+
+            for (size_t i = 0; i < N; ++i)
+            {
+                result[i] = ExtractFloat(args.get<sol::object>(static_cast<int>(i)), typeName);
+            }
+            return result;
+        }
+
+        template <size_t N>
+        size_t ExtractIndex(const sol::object& index, std::string_view typeName)
+        {
+            const std::optional<size_t> maybeIndex = LuaTypeConversions::ExtractSpecificType<size_t>(index);
+            if (!maybeIndex)
+            {
+                sol_helper::throwSolException("{}: unknown field! Only the documented fields and methods and integer indices are supported!", typeName);
+            }
+            if (*maybeIndex == 0u || *maybeIndex > N)
+            {
+                sol_helper::throwSolException("{}: index out of range! Expected 0 < index <= {} but received index == {}", typeName, N, *maybeIndex);
+            }
+            return *maybeIndex - 1u;
+        }
+
+        template <size_t N>
+        std::string ToString(std::string_view typeName, const std::array<float, N>& values)
+        {
+            std::string result = fmt::format("{}(", typeName);
+            for (size_t i = 0; i < N; ++i)
+            {
+                if (i != 0u)
+                {
+                    result += ", ";
+                }
+                result += fmt::format("{}", values[i]);
+            }
+            result += ")";
+            return result;
+        }
+
+        template <size_t N, typename Operation>
+        LuaVector<N> ComponentWise(const std::array<float, N>& a, const std::array<float, N>& b, Operation operation)
+        {
+            LuaVector<N> result;
+            for (size_t i = 0; i < N; ++i)
+            {
+                result.values[i] = operation(a[i], b[i]);
+            }
+            return result;
+        }
+
+        template <size_t N>
+        LuaVector<N> Scale(const std::array<float, N>& a, float factor)
+        {
+            LuaVector<N> result;
+            for (size_t i = 0; i < N; ++i)
+            {
+                result.values[i] = a[i] * factor;
+            }
+            return result;
+        }
+
+        template <size_t N>
+        float Dot(const std::array<float, N>& a, const std::array<float, N>& b)
+        {
+            float result = 0.f;
+            for (size_t i = 0; i < N; ++i)
+            {
+                result += a[i] * b[i];
+            }
+            return result;
+        }
+
+        // Zero-length input is returned unchanged instead of producing NaNs
+        template <size_t N>
+        std::array<float, N> Normalize(const std::array<float, N>& a)
+        {
+            const float length = std::sqrt(Dot(a, a));
+            if (length == 0.f)
+            {
+                return a;
+            }
+            return Scale(a, 1.f / length).values;
+        }
+
+        LuaVec3 Cross(const std::array<float, 3>& a, const std::array<float, 3>& b)
+        {
+            return LuaVec3{{
+                a[1] * b[2] - a[2] * b[1],
+                a[2] * b[0] - a[0] * b[2],
+                a[0] * b[1] - a[1] * b[0] }};
+        }
+
+        template <size_t N>
+        void RegisterVector(sol::state& solState)
+        {
+            using Vec = LuaVector<N>;
+            sol::usertype<Vec> vecType = solState.new_usertype<Vec>(VectorTypeName<N>(),
+                sol::call_constructor, sol::factories([](sol::variadic_args args) { return Vec{ExtractComponents<N, Vec>(args, {}, VectorTypeName<N>(), true)}; }),
+                sol::meta_function::addition, [](const Vec& a, const Vec& b) { return ComponentWise(a.values, b.values, std::plus<float>()); },
+                sol::meta_function::subtraction, [](const Vec& a, const Vec& b) { return ComponentWise(a.values, b.values, std::minus<float>()); },
+                sol::meta_function::multiplication, sol::overload(
+                    [](const Vec& a, const Vec& b) { return ComponentWise(a.values, b.values, std::multiplies<float>()); },
+                    [](const Vec& a, float factor) { return Scale(a.values, factor); },
+                    [](float factor, const Vec& a) { return Scale(a.values, factor); }),
+                sol::meta_function::division, sol::overload(
+                    [](const Vec& a, const Vec& b) { return ComponentWise(a.values, b.values, std::divides<float>()); },
+                    [](const Vec& a, float divisor) { return Scale(a.values, 1.f / divisor); }),
+                sol::meta_function::unary_minus, [](const Vec& a) { return Scale(a.values, -1.f); },
+                sol::meta_function::equal_to, [](const Vec& a, const Vec& b) { return a.values == b.values; },
+                sol::meta_function::to_string, [](const Vec& a) { return ToString(VectorTypeName<N>(), a.values); },
+                sol::meta_function::length, [](const Vec& /*a*/) { return N; },
+                sol::meta_function::index, [](const Vec& a, const sol::object& index) { return a.values[ExtractIndex<N>(index, VectorTypeName<N>())]; },
+                sol::meta_function::new_index, [](Vec& a, const sol::object& index, const sol::object& value) {
+                    a.values[ExtractIndex<N>(index, VectorTypeName<N>())] = ExtractFloat(value, VectorTypeName<N>());
+                },
+                "length", [](const Vec& a) { return std::sqrt(Dot(a.values, a.values)); },
+                "dot", [](const Vec& a, const Vec& b) { return Dot(a.values, b.values); },
+                "normalize", [](const Vec& a) { return Vec{Normalize(a.values)}; },
+                "distance", [](const Vec& a, const Vec& b) {
+                    const Vec difference = ComponentWise(a.values, b.values, std::minus<float>());
+                    return std::sqrt(Dot(difference.values, difference.values));
+                },
+                "lerp", [](const Vec& a, const Vec& b, float t) {
+                    return ComponentWise(a.values, b.values, [t](float from, float to) { return from + (to - from) * t; });
+                },
+                "clamp", sol::overload(
+                    [](const Vec& a, float minValue, float maxValue) {
+                        Vec result;
+                        for (size_t i = 0; i < N; ++i)
+                        {
+                            result.values[i] = std::clamp(a.values[i], minValue, maxValue);
+                        }
+                        return result;
+                    },
+                    [](const Vec& a, const Vec& minValue, const Vec& maxValue) {
+                        Vec result;
+                        for (size_t i = 0; i < N; ++i)
+                        {
+                            result.values[i] = std::clamp(a.values[i], minValue.values[i], maxValue.values[i]);
+                        }
+                        return result;
+                    })
+                );
+
+            vecType["x"] = sol::property([](const Vec& a) { return a.values[0]; }, [](Vec& a, float value) { a.values[0] = value; });
+            vecType["y"] = sol::property([](const Vec& a) { return a.values[1]; }, [](Vec& a, float value) { a.values[1] = value; });
+            if constexpr (N >= 3)
+            {
+                vecType["z"] = sol::property([](const Vec& a) { return a.values[2]; }, [](Vec& a, float value) { a.values[2] = value; });
+            }
+            if constexpr (N == 3)
+            {
+                vecType["cross"] = [](const Vec& a, const Vec& b) { return Cross(a.values, b.values); };
+            }
+            if constexpr (N == 4)
+            {
+                vecType["w"] = sol::property([](const Vec& a) { return a.values[3]; }, [](Vec& a, float value) { a.values[3] = value; });
+            }
+        }
+
+        LuaQuat Multiply(const LuaQuat& a, const LuaQuat& b)
+        {
+            const auto& [ax, ay, az, aw] = a.values;
+            const auto& [bx, by, bz, bw] = b.values;
+            return LuaQuat{{
+                aw * bx + ax * bw + ay * bz - az * by,
+                aw * by - ax * bz + ay * bw + az * bx,
+                aw * bz + ax * by - ay * bx + az * bw,
+                aw * bw - ax * bx - ay * by - az * bz }};
+        }
+
+        LuaQuat Conjugate(const LuaQuat& q)
+        {
+            return LuaQuat{{-q.values[0], -q.values[1], -q.values[2], q.values[3]}};
+        }
+
+        // v' = v + w * t + u x t, with u = (x, y, z) and t = 2 * (u x v)
+        LuaVec3 Rotate(const LuaQuat& q, const LuaVec3& v)
+        {
+            const std::array<float, 3> u {q.values[0], q.values[1], q.values[2]};
+            const LuaVec3 t = Scale(Cross(u, v.values).values, 2.f);
+            const LuaVec3 uCrossT = Cross(u, t.values);
+            LuaVec3 result;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                result.values[i] = v.values[i] + q.values[3] * t.values[i] + uCrossT.values[i];
+            }
+            return result;
+        }
+
+        LuaQuat FromAxisAngle(const LuaVec3& axis, float degrees)
+        {
+            const std::array<float, 3> normalizedAxis = Normalize(axis.values);
+            const float halfAngle = degrees * DegreesToRadians * 0.5f;
+            const float sinHalfAngle = std::sin(halfAngle);
+            return LuaQuat{{normalizedAxis[0] * sinHalfAngle, normalizedAxis[1] * sinHalfAngle, normalizedAxis[2] * sinHalfAngle, std::cos(halfAngle)}};
+        }
+
+        // Takes the shortest path; falls back to a normalized lerp for nearly identical rotations where slerp is numerically unstable
+        LuaQuat Slerp(const LuaQuat& a, const LuaQuat& b, float t)
+        {
+            std::array<float, 4> target = b.values;
+            float cosTheta = Dot(a.values, target);
+            if (cosTheta < 0.f)
+            {
+                target = Scale(target, -1.f).values;
+                cosTheta = -cosTheta;
+            }
+
+            if (cosTheta > 0.9995f)
+            {
+                const LuaVector<4> lerped = ComponentWise(a.values, target, [t](float from, float to) { return from + (to - from) * t; });
+                return LuaQuat{Normalize(lerped.values)};
+            }
+
+            const float theta = std::acos(cosTheta);
+            const float sinTheta = std::sin(theta);
+            const float weightA = std::sin((1.f - t) * theta) / sinTheta;
+            const float weightB = std::sin(t * theta) / sinTheta;
+            return LuaQuat{ComponentWise(a.values, target, [weightA, weightB](float from, float to) { return from * weightA + to * weightB; }).values};
+        }
+
+        void RegisterQuat(sol::state& solState)
+        {
+            solState.new_usertype<LuaQuat>("quat",
+                sol::call_constructor, sol::factories([](sol::variadic_args args) { return LuaQuat{ExtractComponents<4, LuaQuat>(args, LuaQuat().values, "quat", false)}; }),
+                sol::meta_function::multiplication, sol::overload(
+                    [](const LuaQuat& a, const LuaQuat& b) { return Multiply(a, b); },
+                    [](const LuaQuat& q, const LuaVec3& v) { return Rotate(q, v); }),
+                sol::meta_function::equal_to, [](const LuaQuat& a, const LuaQuat& b) { return a.values == b.values; },
+                sol::meta_function::to_string, [](const LuaQuat& q) { return ToString("quat", q.values); },
+                "x", sol::property([](const LuaQuat& q) { return q.values[0]; }, [](LuaQuat& q, float value) { q.values[0] = value; }),
+                "y", sol::property([](const LuaQuat& q) { return q.values[1]; }, [](LuaQuat& q, float value) { q.values[1] = value; }),
+                "z", sol::property([](const LuaQuat& q) { return q.values[2]; }, [](LuaQuat& q, float value) { q.values[2] = value; }),
+                "w", sol::property([](const LuaQuat& q) { return q.values[3]; }, [](LuaQuat& q, float value) { q.values[3] = value; }),
+                "fromAxisAngle", &FromAxisAngle,
+                "normalize", [](const LuaQuat& q) { return LuaQuat{Normalize(q.values)}; },
+                "conjugate", &Conjugate,
+                "dot", [](const LuaQuat& a, const LuaQuat& b) { return Dot(a.values, b.values); },
+                "rotate", &Rotate,
+                "slerp", &Slerp
+                );
+        }
+
+        float& MatrixElement(LuaMat4& m, size_t row, size_t column)
+        {
+            return m.values[column * 4u + row];
+        }
+
+        float MatrixElement(const LuaMat4& m, size_t row, size_t column)
+        {
+            return m.values[column * 4u + row];
+        }
+
+        LuaMat4 Multiply(const LuaMat4& a, const LuaMat4& b)
+        {
+            LuaMat4 result;
+            for (size_t column = 0; column < 4; ++column)
+            {
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    float sum = 0.f;
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        sum += MatrixElement(a, row, k) * MatrixElement(b, k, column);
+                    }
+                    MatrixElement(result, row, column) = sum;
+                }
+            }
+            return result;
+        }
+
+        LuaVec4 MultiplyVector(const LuaMat4& m, const std::array<float, 4>& v)
+        {
+            LuaVec4 result;
+            for (size_t row = 0; row < 4; ++row)
+            {
+                float sum = 0.f;
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    sum += MatrixElement(m, row, k) * v[k];
+                }
+                result.values[row] = sum;
+            }
+            return result;
+        }
+
+        LuaMat4 Translation(const LuaVec3& translation)
+        {
+            LuaMat4 result;
+            MatrixElement(result, 0, 3) = translation.values[0];
+            MatrixElement(result, 1, 3) = translation.values[1];
+            MatrixElement(result, 2, 3) = translation.values[2];
+            return result;
+        }
+
+        LuaMat4 Scaling(const LuaVec3& scaling)
+        {
+            LuaMat4 result;
+            MatrixElement(result, 0, 0) = scaling.values[0];
+            MatrixElement(result, 1, 1) = scaling.values[1];
+            MatrixElement(result, 2, 2) = scaling.values[2];
+            return result;
+        }
+
+        LuaMat4 Rotation(const LuaQuat& q)
+        {
+            const auto& [x, y, z, w] = q.values;
+            LuaMat4 result;
+            MatrixElement(result, 0, 0) = 1.f - 2.f * (y * y + z * z);
+            MatrixElement(result, 0, 1) = 2.f * (x * y - z * w);
+            MatrixElement(result, 0, 2) = 2.f * (x * z + y * w);
+            MatrixElement(result, 1, 0) = 2.f * (x * y + z * w);
+            MatrixElement(result, 1, 1) = 1.f - 2.f * (x * x + z * z);
+            MatrixElement(result, 1, 2) = 2.f * (y * z - x * w);
+            MatrixElement(result, 2, 0) = 2.f * (x * z - y * w);
+            MatrixElement(result, 2, 1) = 2.f * (y * z + x * w);
+            MatrixElement(result, 2, 2) = 1.f - 2.f * (x * x + y * y);
+            return result;
+        }
+
+        LuaMat4 Transpose(const LuaMat4& m)
+        {
+            LuaMat4 result;
+            for (size_t column = 0; column < 4; ++column)
+            {
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    MatrixElement(result, row, column) = MatrixElement(m, column, row);
+                }
+            }
+            return result;
+        }
+
+        LuaVec3 TransformPoint(const LuaMat4& m, const LuaVec3& point)
+        {
+            const LuaVec4 result = MultiplyVector(m, {point.values[0], point.values[1], point.values[2], 1.f});
+            return LuaVec3{{result.values[0], result.values[1], result.values[2]}};
+        }
+
+        LuaVec3 TransformDirection(const LuaMat4& m, const LuaVec3& direction)
+        {
+            const LuaVec4 result = MultiplyVector(m, {direction.values[0], direction.values[1], direction.values[2], 0.f});
+            return LuaVec3{{result.values[0], result.values[1], result.values[2]}};
+        }
+
+        void RegisterMat4(sol::state& solState)
+        {
+            solState.new_usertype<LuaMat4>("mat4",
+                sol::call_constructor, sol::factories([](sol::variadic_args args) { return LuaMat4{ExtractComponents<16, LuaMat4>(args, LuaMat4().values, "mat4", false)}; }),
+                sol::meta_function::multiplication, sol::overload(
+                    [](const LuaMat4& a, const LuaMat4& b) { return Multiply(a, b); },
+                    [](const LuaMat4& m, const LuaVec4& v) { return MultiplyVector(m, v.values); }),
+                sol::meta_function::equal_to, [](const LuaMat4& a, const LuaMat4& b) { return a.values == b.values; },
+                sol::meta_function::to_string, [](const LuaMat4& m) { return ToString("mat4", m.values); },
+                sol::meta_function::length, [](const LuaMat4& /*m*/) { return 16u; },
+                sol::meta_function::index, [](const LuaMat4& m, const sol::object& index) { return m.values[ExtractIndex<16>(index, "mat4")]; },
+                sol::meta_function::new_index, [](LuaMat4& m, const sol::object& index, const sol::object& value) {
+                    m.values[ExtractIndex<16>(index, "mat4")] = ExtractFloat(value, "mat4");
+                },
+                "translation", &Translation,
+                "scaling", &Scaling,
+                "rotation", &Rotation,
+                "transpose", &Transpose,
+                "transformPoint", &TransformPoint,
+                "transformDirection", &TransformDirection,
+                "get", [](const LuaMat4& m, const sol::object& row, const sol::object& column) {
+                    return MatrixElement(m, ExtractIndex<4>(row, "mat4:get (row)"), ExtractIndex<4>(column, "mat4:get (column)"));
+                }
+                );
+        }
+    }
+
+    void LuaMath::Register(sol::state& solState)
+    {
+        RegisterVector<2>(solState);
+        RegisterVector<3>(solState);
+        RegisterVector<4>(solState);
+        RegisterQuat(solState);
+        RegisterMat4(solState);
+    }
+}
@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/SolWrapper.h"
+
+#include <array>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Native math types for scripts (vec2, vec3, vec4, quat and mat4 in Lua). They are usertypes with the operations
+    // implemented in C++, so that math-heavy scripts don't do component-wise arithmetic in Lua. Vectors and quaternions
+    // can be assigned to vector outputs directly, see LuaScriptPropertySetter
+    template <size_t N>
+    struct LuaVector
+    {
+        std::array<float, N> values {};
+    };
+
+    using LuaVec2 = LuaVector<2>;
+    using LuaVec3 = LuaVector<3>;
+    using LuaVec4 = LuaVector<4>;
+
+    // Components in x, y, z, w order (same layout as a VEC4F property)
+    struct LuaQuat
+    {
+        std::array<float, 4> values {0.f, 0.f, 0.f, 1.f};
+    };
+
+    // Column-major, same as Ramses and OpenGL
+    struct LuaMat4
+    {
+        std::array<float, 16> values {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            0.f, 0.f, 0.f, 1.f };
+    };
+
+    class LuaMath
+    {
+    public:
+        // Registers the types as global vec2, vec3, vec4, quat and mat4
+        static void Register(sol::state& solState);
+    };
+}
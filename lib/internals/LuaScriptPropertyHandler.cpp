@@ -22,6 +22,20 @@ namespace rlogic::internal
         : m_solState(state)
         , m_propertyDescription(propertyDescription)
     {
+        const EPropertyType type = m_propertyDescription.getType();
+        if (type == EPropertyType::Struct || type == EPropertyType::Array)
+        {
+            const size_t childCount = m_propertyDescription.getChildCount();
+            m_childHandlers.resize(childCount);
+            if (type == EPropertyType::Struct)
+            {
+                m_childIndicesByName.reserve(childCount);
+                for (size_t i = 0; i < childCount; ++i)
+                {
+                    m_childIndicesByName.emplace(m_propertyDescription.getChild(i)->getName(), i);
+                }
+            }
+        }
     }
 
     void LuaScriptPropertyHandler::NewIndex(LuaScriptPropertyHandler& data, const sol::object& index, const sol::object& rhs)
@@ -34,13 +48,13 @@ namespace rlogic::internal
         return data.getChildPropertyAsSolObject(index);
     }
 
-    Property* LuaScriptPropertyHandler::getStructProperty(const sol::object& propertyIndex)
+    size_t LuaScriptPropertyHandler::getStructChildIndex(const sol::object& propertyIndex) const
     {
         std::string_view childPropertyName = LuaTypeConversions::GetIndexAsString(propertyIndex);
-        return getStructProperty(childPropertyName);
+        return getStructChildIndex(childPropertyName);
     }
 
-    Property* LuaScriptPropertyHandler::getArrayProperty(const sol::object& propertyIndex)
+    size_t LuaScriptPropertyHandler::getArrayChildIndex(const sol::object& propertyIndex) const
     {
         const std::optional<size_t> maybeUInt = LuaTypeConversions::ExtractSpecificType<size_t>(propertyIndex);
         if (!maybeUInt)
@@ -63,34 +77,34 @@ namespace rlogic::internal
         {
             sol_helper::throwSolException("Index out of range! Expected 0 < index <= {} but received index == {}", childCount, indexAsUInt);
         }
-        return m_propertyDescription.getChild(indexAsUInt - 1);
+        return indexAsUInt - 1;
     }
 
-    Property* LuaScriptPropertyHandler::getStructProperty(std::string_view propertyName)
+    size_t LuaScriptPropertyHandler::getStructChildIndex(std::string_view propertyName) const
     {
-        Property* structProperty = m_propertyDescription.getChild(propertyName);
-        if (nullptr == structProperty)
+        const auto childIter = m_childIndicesByName.find(propertyName);
+        if (childIter == m_childIndicesByName.end())
         {
             sol_helper::throwSolException("Tried to access undefined struct property '{}'", propertyName);
         }
-        return structProperty;
+        return childIter->second;
     }
 
     void LuaScriptPropertyHandler::setChildProperty(const sol::object& propertyIndex, const sol::object& rhs)
     {
         assert(TypeUtils::CanHaveChildren(m_propertyDescription.getType()));
 
-        Property* childProperty = nullptr;
+        size_t childIndex = 0u;
         if (m_propertyDescription.getType() == EPropertyType::Struct)
         {
-            childProperty = getStructProperty(propertyIndex);
+            childIndex = getStructChildIndex(propertyIndex);
         }
         else
         {
-            childProperty = getArrayProperty(propertyIndex);
+            childIndex = getArrayChildIndex(propertyIndex);
         }
 
-        LuaScriptPropertySetter::Set(*childProperty->m_impl, rhs);
+        LuaScriptPropertySetter::Set(*m_propertyDescription.getChild(childIndex)->m_impl, rhs);
     }
 
     sol::object LuaScriptPropertyHandler::getChildPropertyAsSolObject(const sol::object& propertyIndex)
@@ -98,14 +112,12 @@ namespace rlogic::internal
         const EPropertyType propertyType = m_propertyDescription.getType();
         if (propertyType == EPropertyType::Struct)
         {
-            const Property* structProperty = getStructProperty(propertyIndex);
-            return convertPropertyToSolObject(*structProperty->m_impl);
+            return getChildAsSolObject(getStructChildIndex(propertyIndex));
         }
 
         if (propertyType == EPropertyType::Array)
         {
-            const Property* arrayProperty = getArrayProperty(propertyIndex);
-            return convertPropertyToSolObject(*arrayProperty->m_impl);
+            return getChildAsSolObject(getArrayChildIndex(propertyIndex));
         }
         // Not a struct and not an array -> assume it's an array-like type (vec2/3/4 etc.)
         const size_t maxIndex = LuaTypeConversions::GetMaxIndexForVectorType(propertyType);
@@ -156,8 +168,48 @@ namespace rlogic::internal
 
     sol::object LuaScriptPropertyHandler::getChildPropertyAsSolObject(std::string_view childName)
     {
-        const Property* structProperty = getStructProperty(childName);
-        return convertPropertyToSolObject(*structProperty->m_impl);
+        return getChildAsSolObject(getStructChildIndex(childName));
+    }
+
+    sol::object LuaScriptPropertyHandler::getChildAsSolObject(size_t childIndex)
+    {
+        PropertyImpl& child = *m_propertyDescription.getChild(childIndex)->m_impl;
+        if (!IsHandledAsUserObject(child.getType()))
+        {
+            return convertPropertyToSolObject(child);
+        }
+
+        // The handler only refers to the child property and reads its values on access, so it stays valid for the lifetime of the property
+        sol::object& childHandler = m_childHandlers[childIndex];
+        if (!childHandler.valid())
+        {
+            childHandler = m_solState.createUserObject(LuaScriptPropertyHandler(m_solState, child));
+        }
+        return childHandler;
+    }
+
+    bool LuaScriptPropertyHandler::IsHandledAsUserObject(EPropertyType type)
+    {
+        switch (type)
+        {
+        case EPropertyType::Float:
+        case EPropertyType::Int32:
+        case EPropertyType::String:
+        case EPropertyType::Bool:
+            return false;
+        case EPropertyType::Vec2f:
+        case EPropertyType::Vec3f:
+        case EPropertyType::Vec4f:
+        case EPropertyType::Vec2i:
+        case EPropertyType::Vec3i:
+        case EPropertyType::Vec4i:
+        case EPropertyType::Array:
+        case EPropertyType::Struct:
+            return true;
+        }
+
+        assert(false && "Missing type implementation!");
+        return false;
     }
 
     sol::object LuaScriptPropertyHandler::convertPropertyToSolObject(PropertyImpl& propertyToConvert)
@@ -180,8 +232,6 @@ namespace rlogic::internal
         case EPropertyType::Vec4i:
         case EPropertyType::Array:
         case EPropertyType::Struct:
-            // TODO Violin/Sven this is probably a performance hit, we create a new lua table every
-            // time a property is resolved
             return m_solState.createUserObject(LuaScriptPropertyHandler(m_solState, propertyToConvert));
         }
 
@@ -13,6 +13,9 @@
 #include "impl/PropertyImpl.h"
 #include "internals/SolState.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace rlogic
 {
     class Property;
@@ -43,14 +46,23 @@ namespace rlogic::internal
         SolState& m_solState;
         PropertyImpl& m_propertyDescription;
 
+        // Struct field names are resolved to child indices once, instead of searching the children on every access.
+        // The keys point to the names owned by the child properties
+        std::unordered_map<std::string_view, size_t> m_childIndicesByName;
+        // Handlers of struct, array and vector children are created on first access and reused afterwards
+        std::vector<sol::object> m_childHandlers;
+
         void        setChildProperty(const sol::object& propertyIndex, const sol::object& rhs);
         sol::object convertPropertyToSolObject(PropertyImpl& property);
 
         sol::object getChildPropertyAsSolObject(const sol::object& index);
+        sol::object getChildAsSolObject(size_t childIndex);
+
+        [[nodiscard]] size_t getStructChildIndex(const sol::object& propertyIndex) const;
+        [[nodiscard]] size_t getStructChildIndex(std::string_view propertyName) const;
+        [[nodiscard]] size_t getArrayChildIndex(const sol::object& propertyIndex) const;
 
-        [[nodiscard]] Property* getStructProperty(const sol::object& propertyIndex);
-        [[nodiscard]] Property* getStructProperty(std::string_view propertyName);
-        [[nodiscard]] Property* getArrayProperty(const sol::object& propertyIndex);
+        [[nodiscard]] static bool IsHandledAsUserObject(EPropertyType type);
 
         // TODO Violin this method is not needed and can be optimized away
         template <typename T> sol::object convertPropertyToSolObject(PropertyImpl& property)
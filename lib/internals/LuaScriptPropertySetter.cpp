@@ -11,6 +11,7 @@
 #include "internals/LuaScriptPropertyHandler.h"
 #include "internals/SolHelper.h"
 #include "internals/LuaTypeConversions.h"
+#include "internals/LuaMath.h"
 
 #include "impl/PropertyImpl.h"
 
@@ -45,7 +46,12 @@ namespace rlogic::internal
             // This is equivalent to SetTable, but is needed when the right side is a custom type, not a Lua table
             // For example when assigning OUT.someStruct = IN.someStruct
 
-            sol::optional<LuaScriptPropertyHandler> maybeStructPropertyHandler = value.as<sol::optional<LuaScriptPropertyHandler>>();
+            if (SetMathType(property, value))
+            {
+                break;
+            }
+
+            sol::optional<LuaScriptPropertyHandler&> maybeStructPropertyHandler = value.as<sol::optional<LuaScriptPropertyHandler&>>();
             if (!maybeStructPropertyHandler)
             {
                 // TODO Violin this error message can be made more concrete if we refactor how we deal with userdata (See TODO at the top of the file)
@@ -101,6 +107,72 @@ namespace rlogic::internal
         }
     }
 
+    template <size_t N>
+    static void SetVectorComponents(PropertyImpl& property, const std::array<float, N>& components, std::string_view sourceTypeName)
+    {
+        const EPropertyType type = property.getType();
+        if (type == PropertyTypeToEnum<std::array<float, N>>::TYPE)
+        {
+            property.setOutputValue_FromScript(components);
+            return;
+        }
+
+        if (type == PropertyTypeToEnum<std::array<int32_t, N>>::TYPE)
+        {
+            std::array<int32_t, N> intComponents {};
+            for (size_t i = 0; i < N; ++i)
+            {
+                const auto rounded = static_cast<int32_t>(components[i]);
+                if (static_cast<float>(rounded) != components[i])
+                {
+                    sol_helper::throwSolException("Implicit rounding during assignment of integer output '{}' (value: {})!", property.getName(), components[i]);
+                }
+                intComponents[i] = rounded;
+            }
+            property.setOutputValue_FromScript(intComponents);
+            return;
+        }
+
+        sol_helper::throwSolException("Type mismatch while assigning property '{}'! Expected {} but received {}",
+            property.getName(), GetLuaPrimitiveTypeName(type), sourceTypeName);
+    }
+
+    bool LuaScriptPropertySetter::SetMathType(PropertyImpl& property, const sol::object& value)
+    {
+        const bool isMathType = value.is<LuaVec2>() || value.is<LuaVec3>() || value.is<LuaVec4>() || value.is<LuaQuat>() || value.is<LuaMat4>();
+        if (!isMathType)
+        {
+            return false;
+        }
+
+        if (property.getPropertySemantics() != EPropertySemantics::ScriptOutput)
+        {
+            sol_helper::throwSolException("Error while writing to '{}'. Writing input values is not allowed, only outputs!", property.getName());
+        }
+
+        if (value.is<LuaVec2>())
+        {
+            SetVectorComponents<2>(property, value.as<LuaVec2>().values, "vec2");
+        }
+        else if (value.is<LuaVec3>())
+        {
+            SetVectorComponents<3>(property, value.as<LuaVec3>().values, "vec3");
+        }
+        else if (value.is<LuaVec4>())
+        {
+            SetVectorComponents<4>(property, value.as<LuaVec4>().values, "vec4");
+        }
+        else if (value.is<LuaQuat>())
+        {
+            SetVectorComponents<4>(property, value.as<LuaQuat>().values, "quat");
+        }
+        else
+        {
+            sol_helper::throwSolException("Can't assign mat4 to property '{}'! Matrices have no property type, assign their components instead", property.getName());
+        }
+        return true;
+    }
+
     void LuaScriptPropertySetter::SetNumber(PropertyImpl& property, const sol::object& number)
     {
         if (property.getPropertySemantics() != EPropertySemantics::ScriptOutput)
@@ -27,5 +27,7 @@ namespace rlogic::internal
         static void SetBool(PropertyImpl& property, bool boolean);
         static void SetStruct(PropertyImpl& property, LuaScriptPropertyHandler& structPropertyHandler);
         static void SetArray(PropertyImpl& property, LuaScriptPropertyHandler& structPropertyHandler);
+        // Returns false if the value is not one of the native math types (see LuaMath)
+        [[nodiscard]] static bool SetMathType(PropertyImpl& property, const sol::object& value);
     };
 }
@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/OutputSnapshotBuffer.h"
+
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    static_assert(std::atomic<size_t>::is_always_lock_free, "Snapshot readers must not depend on locks");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Snapshot readers must not depend on locks");
+
+    OutputSnapshotBuffer::OutputSnapshotBuffer(size_t bufferCount, std::shared_ptr<const std::atomic<uint64_t>> contentGeneration)
+        : m_buffers(std::max<size_t>(bufferCount, 2u))
+        , m_contentGeneration(std::move(contentGeneration))
+    {
+    }
+
+    // All accesses to m_published and the reader counters are sequentially consistent on purpose: a reader announces
+    // itself and then checks m_published again, the update thread changes m_published and then checks the reader counters.
+    // With a single total order of these operations either the update thread sees the reader, or the reader sees
+    // that its buffer is no longer the published one
+    bool OutputSnapshotBuffer::publish(uint64_t updateCounter, const std::vector<const Property*>& outputs)
+    {
+        const size_t published = m_published.load();
+        for (size_t i = 0; i < m_buffers.size(); ++i)
+        {
+            if (i == published || m_buffers[i].readers.load() != 0u)
+            {
+                continue;
+            }
+
+            m_buffers[i].snapshot.capture(updateCounter, m_contentGeneration, outputs);
+            m_published.store(i);
+            return true;
+        }
+        return false;
+    }
+
+    bool OutputSnapshotBuffer::read(OutputSnapshotImpl& target) const
+    {
+        for (;;)
+        {
+            const size_t published = m_published.load();
+            if (published == NothingPublished)
+            {
+                return false;
+            }
+
+            const Buffer& buffer = m_buffers[published];
+            buffer.readers.fetch_add(1u);
+            if (m_published.load() == published)
+            {
+                // Published before properties were destroyed or content was loaded
+                const bool valid = buffer.snapshot.isValid();
+                if (valid)
+                {
+                    target = buffer.snapshot;
+                }
+                buffer.readers.fetch_sub(1u);
+                return valid;
+            }
+            // A newer snapshot was published in the meantime, the update thread might already write into this buffer
+            buffer.readers.fetch_sub(1u);
+        }
+    }
+
+    size_t OutputSnapshotBuffer::getBufferCount() const
+    {
+        return m_buffers.size();
+    }
+}
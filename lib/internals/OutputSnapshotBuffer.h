@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/OutputSnapshotImpl.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace rlogic
+{
+    class Property;
+}
+
+namespace rlogic::internal
+{
+    // N-buffered snapshots of output values, published by the update thread and read by any number of other threads.
+    // Each buffer counts its readers. The update thread only writes into buffers which are neither the latest published
+    // one nor being read, readers only copy the latest published buffer. Nobody waits for a lock, a reader
+    // which loses a race against a publish simply retries with the newer buffer
+    class OutputSnapshotBuffer
+    {
+    public:
+        // At least 2 buffers, with 3 buffers a single reader never causes a publish to be skipped. Snapshots are tagged
+        // with the content generation, they are not read anymore (and can't be accessed by readers) once it changed
+        OutputSnapshotBuffer(size_t bufferCount, std::shared_ptr<const std::atomic<uint64_t>> contentGeneration);
+
+        // Not copy-able and not move-able (readers hold references to it)
+        OutputSnapshotBuffer(const OutputSnapshotBuffer& other) = delete;
+        OutputSnapshotBuffer& operator=(const OutputSnapshotBuffer& other) = delete;
+        OutputSnapshotBuffer(OutputSnapshotBuffer&& other) = delete;
+        OutputSnapshotBuffer& operator=(OutputSnapshotBuffer&& other) = delete;
+        ~OutputSnapshotBuffer() noexcept = default;
+
+        // Update thread only. Returns false if all other buffers are being read, readers then keep seeing the previous snapshot
+        [[nodiscard]] bool publish(uint64_t updateCounter, const std::vector<const Property*>& outputs);
+        // Thread-safe, returns false if nothing was published since the content generation changed
+        [[nodiscard]] bool read(OutputSnapshotImpl& target) const;
+
+        [[nodiscard]] size_t getBufferCount() const;
+
+    private:
+        struct Buffer
+        {
+            mutable std::atomic<uint32_t> readers{0u};
+            OutputSnapshotImpl snapshot;
+        };
+
+        static constexpr size_t NothingPublished = std::numeric_limits<size_t>::max();
+
+        std::vector<Buffer> m_buffers;
+        std::shared_ptr<const std::atomic<uint64_t>> m_contentGeneration;
+        std::atomic<size_t> m_published{NothingPublished};
+    };
+}
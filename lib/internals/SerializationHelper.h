@@ -13,44 +13,72 @@
 #include "generated/PropertyGen.h"
 
 #include <optional>
+#include <cassert>
 
 namespace rlogic::internal
 {
-    static std::optional<EPropertyType> ConvertSerializationTypeToEPropertyType(rlogic_serialization::EPropertyRootType propertyRootType, rlogic_serialization::PropertyValue valueType)
+    static std::optional<EPropertyType> ConvertSerializationTypeToEPropertyType(rlogic_serialization::EPropertyType propertyType)
     {
-        switch (propertyRootType)
+        switch (propertyType)
         {
-        case rlogic_serialization::EPropertyRootType::Struct:
+        case rlogic_serialization::EPropertyType::Float:
+            return EPropertyType::Float;
+        case rlogic_serialization::EPropertyType::Vec2f:
+            return EPropertyType::Vec2f;
+        case rlogic_serialization::EPropertyType::Vec3f:
+            return EPropertyType::Vec3f;
+        case rlogic_serialization::EPropertyType::Vec4f:
+            return EPropertyType::Vec4f;
+        case rlogic_serialization::EPropertyType::Int32:
+            return EPropertyType::Int32;
+        case rlogic_serialization::EPropertyType::Vec2i:
+            return EPropertyType::Vec2i;
+        case rlogic_serialization::EPropertyType::Vec3i:
+            return EPropertyType::Vec3i;
+        case rlogic_serialization::EPropertyType::Vec4i:
+            return EPropertyType::Vec4i;
+        case rlogic_serialization::EPropertyType::Struct:
             return EPropertyType::Struct;
-        case rlogic_serialization::EPropertyRootType::Array:
+        case rlogic_serialization::EPropertyType::String:
+            return EPropertyType::String;
+        case rlogic_serialization::EPropertyType::Bool:
+            return EPropertyType::Bool;
+        case rlogic_serialization::EPropertyType::Array:
             return EPropertyType::Array;
-        case rlogic_serialization::EPropertyRootType::Primitive:
-            switch (valueType)
-            {
-            case rlogic_serialization::PropertyValue::bool_s:
-                return EPropertyType::Bool;
-            case rlogic_serialization::PropertyValue::float_s:
-                return EPropertyType::Float;
-            case rlogic_serialization::PropertyValue::vec2f_s:
-                return EPropertyType::Vec2f;
-            case rlogic_serialization::PropertyValue::vec3f_s:
-                return EPropertyType::Vec3f;
-            case rlogic_serialization::PropertyValue::vec4f_s:
-                return EPropertyType::Vec4f;
-            case rlogic_serialization::PropertyValue::int32_s:
-                return EPropertyType::Int32;
-            case rlogic_serialization::PropertyValue::vec2i_s:
-                return EPropertyType::Vec2i;
-            case rlogic_serialization::PropertyValue::vec3i_s:
-                return EPropertyType::Vec3i;
-            case rlogic_serialization::PropertyValue::vec4i_s:
-                return EPropertyType::Vec4i;
-            case rlogic_serialization::PropertyValue::string_s:
-                return EPropertyType::String;
-            case rlogic_serialization::PropertyValue::NONE:
-                return std::nullopt;
-            }
         }
         return std::nullopt;
     }
+
+    static rlogic_serialization::EPropertyType ConvertEPropertyTypeToSerializationType(EPropertyType propertyType)
+    {
+        switch (propertyType)
+        {
+        case EPropertyType::Float:
+            return rlogic_serialization::EPropertyType::Float;
+        case EPropertyType::Vec2f:
+            return rlogic_serialization::EPropertyType::Vec2f;
+        case EPropertyType::Vec3f:
+            return rlogic_serialization::EPropertyType::Vec3f;
+        case EPropertyType::Vec4f:
+            return rlogic_serialization::EPropertyType::Vec4f;
+        case EPropertyType::Int32:
+            return rlogic_serialization::EPropertyType::Int32;
+        case EPropertyType::Vec2i:
+            return rlogic_serialization::EPropertyType::Vec2i;
+        case EPropertyType::Vec3i:
+            return rlogic_serialization::EPropertyType::Vec3i;
+        case EPropertyType::Vec4i:
+            return rlogic_serialization::EPropertyType::Vec4i;
+        case EPropertyType::Struct:
+            return rlogic_serialization::EPropertyType::Struct;
+        case EPropertyType::String:
+            return rlogic_serialization::EPropertyType::String;
+        case EPropertyType::Bool:
+            return rlogic_serialization::EPropertyType::Bool;
+        case EPropertyType::Array:
+            return rlogic_serialization::EPropertyType::Array;
+        }
+        assert(false && "Should never reach this line");
+        return rlogic_serialization::EPropertyType::Struct;
+    }
 }
@@ -11,35 +11,63 @@
 #include "generated/PropertyGen.h"
 
 #include <unordered_map>
-
-namespace rlogic_serialization
-{
-    struct Property;
-}
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cassert>
 
 namespace rlogic::internal
 {
     class PropertyImpl;
 
+    // Position of a serialized property: the property tree it was stored in and its record index in that tree
+    struct SerializedPropertyLocation
+    {
+        flatbuffers::Offset<rlogic_serialization::PropertyTree> tree;
+        uint32_t index;
+    };
+
     // Remembers flatbuffer offsets for select objects during serialization
     class SerializationMap
     {
     public:
-        void storePropertyOffset(const PropertyImpl& impl, flatbuffers::Offset<rlogic_serialization::Property> offset)
+        void storePropertyLocation(const PropertyImpl& impl, flatbuffers::Offset<rlogic_serialization::PropertyTree> tree, uint32_t index)
         {
             assert(m_properties.find(&impl) == m_properties.end() && "never try to store the same impl twice");
-            m_properties.emplace(std::make_pair(&impl, offset));
+            m_properties.emplace(std::make_pair(&impl, SerializedPropertyLocation{ tree, index }));
         }
 
-        flatbuffers::Offset<rlogic_serialization::Property> resolvePropertyOffset(const PropertyImpl& impl) const
+        [[nodiscard]] SerializedPropertyLocation resolvePropertyLocation(const PropertyImpl& impl) const
         {
             auto iter = m_properties.find(&impl);
-            assert(iter != m_properties.end() && !iter->second.IsNull());
+            assert(iter != m_properties.end() && !iter->second.tree.IsNull());
             return iter->second;
         }
 
+        // Adds a string to the string table (if not there yet) and returns its index
+        uint32_t storeString(std::string_view str)
+        {
+            auto iter = m_stringIndices.find(std::string(str));
+            if (iter != m_stringIndices.end())
+            {
+                return iter->second;
+            }
+
+            const auto index = static_cast<uint32_t>(m_strings.size());
+            m_strings.emplace_back(str);
+            m_stringIndices.emplace(std::make_pair(m_strings.back(), index));
+            return index;
+        }
+
+        [[nodiscard]] const std::vector<std::string>& getStrings() const
+        {
+            return m_strings;
+        }
+
     private:
-        std::unordered_map<const PropertyImpl*, flatbuffers::Offset<rlogic_serialization::Property>> m_properties;
+        std::unordered_map<const PropertyImpl*, SerializedPropertyLocation> m_properties;
+        std::vector<std::string> m_strings;
+        std::unordered_map<std::string, uint32_t> m_stringIndices;
     };
 
 }
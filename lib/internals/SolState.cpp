@@ -16,12 +16,29 @@
 #include "internals/LuaScriptPropertyHandler.h"
 #include "internals/SolHelper.h"
 #include "internals/ArrayTypeInfo.h"
+#include "internals/LuaMath.h"
 
 
 #include <iostream>
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <cstring>
 
 namespace rlogic::internal
 {
+    // Executed as protected call, so that errors in finalizers don't escape
+    static int garbageCollectionStep(lua_State* L)
+    {
+        const auto stepSizeKB = static_cast<int>(lua_tointeger(L, 1));
+        const int cycleCompleted = lua_gc(L, LUA_GCSTEP, stepSizeKB);
+        // A step sets the threshold for the next automatic step, which would run during script execution again
+        lua_gc(L, LUA_GCSTOP, 0);
+        lua_pushboolean(L, cycleCompleted);
+        return 1;
+    }
+
     // NOLINTNEXTLINE(performance-unnecessary-value-param) The signature is forced by SOL. Therefore we have to disable this warning.
     static int solExceptionHandler(lua_State* L, sol::optional<const std::exception&> maybe_exception, sol::string_view description)
     {
@@ -32,10 +49,47 @@ namespace rlogic::internal
         return sol::stack::top(L);
     }
 
-    SolState::SolState()
+    // Lua 5.1 bytecode starts with a header of 12 bytes (version at offset 4, sizeof(size_t) at offset 8), followed by the main function.
+    // Its first field is the chunk name, stored as size_t length (including the terminating zero) and the characters. Nested functions
+    // of the same chunk don't repeat it, they inherit it while loading. Returns std::nullopt if the bytecode has a different layout
+    static std::optional<std::string> ReplaceChunkName(std::string_view bytecode, std::string_view chunkName)
+    {
+        constexpr size_t HeaderSize = 12u;
+        constexpr size_t VersionOffset = 4u;
+        constexpr size_t SizeTSizeOffset = 8u;
+        if (bytecode.size() < HeaderSize + sizeof(size_t) ||
+            static_cast<uint8_t>(bytecode[VersionOffset]) != 0x51u ||
+            static_cast<uint8_t>(bytecode[SizeTSizeOffset]) != sizeof(size_t))
+        {
+            return std::nullopt;
+        }
+
+        size_t oldNameSize = 0u;
+        std::memcpy(&oldNameSize, bytecode.data() + HeaderSize, sizeof(oldNameSize));
+        const size_t functionStart = HeaderSize + sizeof(size_t) + oldNameSize;
+        if (oldNameSize > bytecode.size() || functionStart > bytecode.size())
+        {
+            return std::nullopt;
+        }
+
+        const size_t newNameSize = chunkName.size() + 1u;
+        std::string renamedBytecode;
+        renamedBytecode.reserve(bytecode.size() - oldNameSize + newNameSize);
+        renamedBytecode.append(bytecode.substr(0u, HeaderSize));
+        renamedBytecode.append(reinterpret_cast<const char*>(&newNameSize), sizeof(newNameSize));
+        renamedBytecode.append(chunkName);
+        renamedBytecode.push_back('\0');
+        renamedBytecode.append(bytecode.substr(functionStart));
+        return renamedBytecode;
+    }
+
+    SolState::SolState(size_t memoryLimit)
+        : m_allocator(std::make_unique<LuaAllocator>(memoryLimit))
+        , m_solState(sol::default_at_panic, &LuaAllocator::Allocate, m_allocator.get())
     {
         m_solState.open_libraries(sol::lib::base, sol::lib::string, sol::lib::math, sol::lib::table, sol::lib::debug);
         m_solState.set_exception_handler(&solExceptionHandler);
+        lua_gc(m_solState.lua_state(), LUA_GCSTOP, 0);
 
         m_solState.new_usertype<ArrayTypeInfo>("ArrayTypeInfo");
         m_solState.new_usertype<LuaScriptPropertyExtractor>(
@@ -55,6 +109,8 @@ namespace rlogic::internal
         m_solState[GetLuaPrimitiveTypeName(EPropertyType::Bool)]   = static_cast<int>(EPropertyType::Bool);
         m_solState[GetLuaPrimitiveTypeName(EPropertyType::Struct)] = static_cast<int>(EPropertyType::Struct);
         m_solState.set_function(GetLuaPrimitiveTypeName(EPropertyType::Array), &LuaScriptPropertyExtractor::CreateArray);
+
+        LuaMath::Register(m_solState);
     }
 
     sol::load_result SolState::loadScript(std::string_view source, std::string_view scriptName)
@@ -62,6 +118,83 @@ namespace rlogic::internal
         return m_solState.load(source, std::string(scriptName));
     }
 
+    sol::load_result SolState::loadScript(std::string_view source, std::string_view scriptName, CompiledChunk& compiledChunk)
+    {
+        if (!compiledChunk.bytecode.empty())
+        {
+            // The bytecode carries the chunk name of the script which was compiled first, error messages must show this one.
+            // Parses the source again if the bytecode layout is unknown
+            const std::optional<std::string> renamedBytecode = ReplaceChunkName(compiledChunk.bytecode, scriptName);
+            if (renamedBytecode)
+            {
+                return m_solState.load(std::string_view(*renamedBytecode), std::string(scriptName), sol::load_mode::binary);
+            }
+            return m_solState.load(source, std::string(scriptName));
+        }
+
+        sol::load_result loadResult = m_solState.load(source, std::string(scriptName));
+        if (loadResult.valid())
+        {
+            // Not stripped, so that error messages of instances loaded from bytecode still contain line numbers
+            const sol::protected_function mainFunction = loadResult;
+            const sol::bytecode bytecode = mainFunction.dump();
+            compiledChunk.bytecode = bytecode.as_string_view();
+        }
+        return loadResult;
+    }
+
+    bool SolState::collectGarbage(size_t stepSizeKB)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        lua_State* L = m_solState.lua_state();
+        lua_pushcfunction(L, &garbageCollectionStep);
+        lua_pushinteger(L, static_cast<lua_Integer>(std::min<size_t>(stepSizeKB, std::numeric_limits<int>::max())));
+        bool cycleCompleted = false;
+        if (lua_pcall(L, 1, 1, 0) == LUA_OK)
+        {
+            cycleCompleted = (lua_toboolean(L, -1) != 0);
+        }
+        // Either the result or the error message
+        lua_pop(L, 1);
+        // Also when a finalizer failed after the step restarted the automatic collection
+        lua_gc(L, LUA_GCSTOP, 0);
+
+        m_lastCollectionStepDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+        m_totalCollectionDuration += m_lastCollectionStepDuration;
+        if (cycleCompleted)
+        {
+            ++m_completedCollectionCycles;
+        }
+        return cycleCompleted;
+    }
+
+    LuaMemoryStatistics SolState::getMemoryStatistics() const
+    {
+        LuaMemoryStatistics statistics = m_allocator->getStatistics();
+        statistics.completedCollectionCycles = m_completedCollectionCycles;
+        statistics.lastCollectionStepDuration = m_lastCollectionStepDuration;
+        statistics.totalCollectionDuration = m_totalCollectionDuration;
+        return statistics;
+    }
+
+    LuaAllocator& SolState::getAllocator()
+    {
+        return *m_allocator;
+    }
+
+    sol::protected_function_result SolState::callWithMemoryLimit(const sol::protected_function& function)
+    {
+        // Lua can only report failed allocations gracefully inside protected calls
+        const LuaAllocator::ScopedMemoryLimit memoryLimit(*m_allocator);
+        return function();
+    }
+
+    CompiledChunkCache& SolState::getChunkCache()
+    {
+        return m_chunkCache;
+    }
+
     sol::environment SolState::createEnvironment()
     {
         return sol::environment(m_solState, sol::create, m_solState.globals());
@@ -9,31 +9,57 @@
 #pragma once
 
 #include "internals/SolWrapper.h"
+#include "internals/CompiledChunkCache.h"
+#include "internals/LuaAllocator.h"
+
+#include "ramses-logic/LuaMemoryStatistics.h"
 
 #include <string_view>
+#include <memory>
+#include <chrono>
 
 namespace rlogic::internal
 {
     class SolState
     {
     public:
-        SolState();
+        // A memory limit of 0 means no limit
+        explicit SolState(size_t memoryLimit = 0u);
 
-        // Move-able (noexcept); Not copy-able
+        // Not move-able and not copy-able (scripts refer to their state, the Lua state refers to its allocator)
         ~SolState() noexcept = default;
-        SolState(SolState&& other) noexcept = default;
-        SolState& operator=(SolState&& other) noexcept = default;
+        SolState(SolState&& other) noexcept = delete;
+        SolState& operator=(SolState&& other) noexcept = delete;
         SolState(const SolState& other) = delete;
         SolState& operator=(const SolState& other) = delete;
 
         sol::load_result loadScript(std::string_view source, std::string_view scriptName);
+        // Loads from the precompiled bytecode of the cache entry if available, otherwise parses the source and stores the bytecode in the entry
+        sol::load_result loadScript(std::string_view source, std::string_view scriptName, CompiledChunk& compiledChunk);
+        [[nodiscard]] CompiledChunkCache& getChunkCache();
+        [[nodiscard]] LuaAllocator& getAllocator();
+        // Script code must be executed through this, so that the memory limit is enforced while the script runs
+        sol::protected_function_result callWithMemoryLimit(const sol::protected_function& function);
         sol::environment createEnvironment();
 
+        // Automatic garbage collection is stopped, so that it does not run at arbitrary points during script execution.
+        // Lua 5.1 restarts it with every step, thus it is stopped again afterwards.
+        // Performs an incremental collection step with the work of stepSizeKB allocated kilobytes (0 = smallest possible step).
+        // Returns true if the step finished a collection cycle
+        bool collectGarbage(size_t stepSizeKB);
+        [[nodiscard]] LuaMemoryStatistics getMemoryStatistics() const;
+
         template <typename T> sol::object createUserObject(const T& instance);
 
     private:
+        // Declared before the Lua state, so that it outlives it. Held by pointer, because the Lua state refers to it
+        std::unique_ptr<LuaAllocator> m_allocator;
         sol::state m_solState;
+        CompiledChunkCache m_chunkCache;
 
+        size_t m_completedCollectionCycles = 0u;
+        std::chrono::microseconds m_lastCollectionStepDuration {0};
+        std::chrono::microseconds m_totalCollectionDuration {0};
     };
 
     template <typename T> inline sol::object SolState::createUserObject(const T& instance)
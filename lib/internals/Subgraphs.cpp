@@ -0,0 +1,101 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/Subgraphs.h"
+#include "impl/LogicNodeImpl.h"
+
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    void Subgraphs::add(LogicNodeImpl& logicNode, std::string_view subgraph)
+    {
+        remove(logicNode);
+        if (subgraph.empty())
+        {
+            return;
+        }
+
+        Subgraph* target = find(subgraph);
+        if (target == nullptr)
+        {
+            target = &m_subgraphs.emplace_back(Subgraph{std::string(subgraph), false, {}});
+        }
+        target->nodes.push_back(&logicNode);
+        logicNode.setSuspended(target->suspended);
+    }
+
+    void Subgraphs::remove(LogicNodeImpl& logicNode)
+    {
+        for (Subgraph& subgraph : m_subgraphs)
+        {
+            const auto node = std::find(subgraph.nodes.begin(), subgraph.nodes.end(), &logicNode);
+            if (node != subgraph.nodes.end())
+            {
+                subgraph.nodes.erase(node);
+                logicNode.setSuspended(false);
+                return;
+            }
+        }
+    }
+
+    void Subgraphs::clear()
+    {
+        m_subgraphs.clear();
+    }
+
+    bool Subgraphs::setSuspended(std::string_view subgraph, bool suspended)
+    {
+        Subgraph* target = find(subgraph);
+        if (target == nullptr)
+        {
+            return false;
+        }
+
+        target->suspended = suspended;
+        for (LogicNodeImpl* logicNode : target->nodes)
+        {
+            logicNode->setSuspended(suspended);
+        }
+        return true;
+    }
+
+    std::optional<bool> Subgraphs::isSuspended(std::string_view subgraph) const
+    {
+        const Subgraph* target = find(subgraph);
+        if (target == nullptr)
+        {
+            return std::nullopt;
+        }
+        return target->suspended;
+    }
+
+    std::string_view Subgraphs::getSubgraphOf(const LogicNodeImpl& logicNode) const
+    {
+        for (const Subgraph& subgraph : m_subgraphs)
+        {
+            if (std::find(subgraph.nodes.cbegin(), subgraph.nodes.cend(), &logicNode) != subgraph.nodes.cend())
+            {
+                return subgraph.name;
+            }
+        }
+        return {};
+    }
+
+    Subgraphs::Subgraph* Subgraphs::find(std::string_view subgraph)
+    {
+        const auto iter = std::find_if(m_subgraphs.begin(), m_subgraphs.end(), [subgraph](const Subgraph& candidate) { return candidate.name == subgraph; });
+        return (iter != m_subgraphs.end()) ? &*iter : nullptr;
+    }
+
+    const Subgraphs::Subgraph* Subgraphs::find(std::string_view subgraph) const
+    {
+        const auto iter = std::find_if(m_subgraphs.cbegin(), m_subgraphs.cend(), [subgraph](const Subgraph& candidate) { return candidate.name == subgraph; });
+        return (iter != m_subgraphs.cend()) ? &*iter : nullptr;
+    }
+}
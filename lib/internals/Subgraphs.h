@@ -0,0 +1,54 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+
+    // Named groups of logic nodes which can be suspended as a whole. Each node is in at most one subgraph.
+    // The suspension is stored in the nodes themselves (see LogicNodeImpl::isSuspended), so that update
+    // only checks a flag per node. Subgraphs exist from the first time a node is added to them
+    class Subgraphs
+    {
+    public:
+        // Moves the node from its current subgraph (if any) to the given one, an empty name only removes it
+        void add(LogicNodeImpl& logicNode, std::string_view subgraph);
+        // Removes the node from its subgraph, it's no longer suspended afterwards
+        void remove(LogicNodeImpl& logicNode);
+        // Doesn't access the nodes, they can already be destroyed (e.g. when other content was loaded)
+        void clear();
+
+        // Return false if the subgraph doesn't exist
+        [[nodiscard]] bool setSuspended(std::string_view subgraph, bool suspended);
+        [[nodiscard]] std::optional<bool> isSuspended(std::string_view subgraph) const;
+
+        // Empty if the node is not in a subgraph
+        [[nodiscard]] std::string_view getSubgraphOf(const LogicNodeImpl& logicNode) const;
+
+    private:
+        struct Subgraph
+        {
+            std::string name;
+            bool suspended = false;
+            std::vector<LogicNodeImpl*> nodes;
+        };
+
+        // Few subgraphs with few nodes each are expected, so linear search is good enough for the API calls
+        std::vector<Subgraph> m_subgraphs;
+
+        [[nodiscard]] Subgraph* find(std::string_view subgraph);
+        [[nodiscard]] const Subgraph* find(std::string_view subgraph) const;
+    };
+}
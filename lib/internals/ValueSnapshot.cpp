@@ -0,0 +1,477 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ValueSnapshot.h"
+#include "internals/ApiObjects.h"
+#include "internals/ErrorReporting.h"
+#include "internals/TypeUtils.h"
+
+#include "impl/PropertyImpl.h"
+#include "impl/LogicNodeImpl.h"
+
+#include "ramses-logic/Property.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/RamsesNodeBinding.h"
+#include "ramses-logic/RamsesAppearanceBinding.h"
+#include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/ExpressionNode.h"
+
+#include "fmt/format.h"
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        struct SnapshotHeader
+        {
+            uint32_t magic;
+            uint32_t formatVersion;
+            uint64_t structureHash;
+        };
+
+        // FNV-1a, 64 bit
+        class StructureHasher
+        {
+        public:
+            void add(const void* data, size_t size)
+            {
+                const auto* bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    m_hash ^= bytes[i];
+                    m_hash *= 0x100000001b3ull;
+                }
+            }
+
+            void add(std::string_view str)
+            {
+                const auto size = static_cast<uint32_t>(str.size());
+                add(&size, sizeof(size));
+                add(str.data(), str.size());
+            }
+
+            void addProperty(const PropertyImpl* property)
+            {
+                if (property == nullptr)
+                {
+                    const uint8_t noProperty = 0u;
+                    add(&noProperty, sizeof(noProperty));
+                    return;
+                }
+
+                const auto type = static_cast<uint32_t>(property->getType());
+                const auto childCount = static_cast<uint32_t>(property->getChildCount());
+                add(&type, sizeof(type));
+                add(property->getName());
+                add(&childCount, sizeof(childCount));
+                for (size_t i = 0; i < property->getChildCount(); ++i)
+                {
+                    addProperty(property->getChild(i)->m_impl.get());
+                }
+            }
+
+            void addLogicNode(uint8_t nodeKind, const LogicNodeImpl& logicNode)
+            {
+                add(&nodeKind, sizeof(nodeKind));
+                addProperty(logicNode.getInputs() ? logicNode.getInputs()->m_impl.get() : nullptr);
+                addProperty(logicNode.getOutputs() ? logicNode.getOutputs()->m_impl.get() : nullptr);
+            }
+
+            [[nodiscard]] uint64_t getHash() const
+            {
+                return m_hash;
+            }
+
+        private:
+            uint64_t m_hash = 0xcbf29ce484222325ull;
+        };
+
+        class SnapshotWriter
+        {
+        public:
+            explicit SnapshotWriter(std::vector<uint8_t>& snapshot)
+                : m_snapshot(snapshot)
+            {
+            }
+
+            void write(const void* data, size_t size)
+            {
+                const size_t offset = m_snapshot.size();
+                m_snapshot.resize(offset + size);
+                std::memcpy(m_snapshot.data() + offset, data, size);
+            }
+
+            void writeFlag(bool flag)
+            {
+                const uint8_t byte = flag ? 1u : 0u;
+                write(&byte, sizeof(byte));
+            }
+
+            void writeProperty(const PropertyImpl& property)
+            {
+                if (TypeUtils::CanHaveChildren(property.getType()))
+                {
+                    for (size_t i = 0; i < property.getChildCount(); ++i)
+                    {
+                        writeProperty(*property.getChild(i)->m_impl);
+                    }
+                    return;
+                }
+
+                std::visit([this](const auto& value)
+                    {
+                        using T = std::decay_t<decltype(value)>;
+                        if constexpr (std::is_same_v<T, std::string>)
+                        {
+                            const auto length = static_cast<uint32_t>(value.size());
+                            write(&length, sizeof(length));
+                            write(value.data(), value.size());
+                        }
+                        else if constexpr (std::is_same_v<T, bool>)
+                        {
+                            writeFlag(value);
+                        }
+                        else
+                        {
+                            static_assert(std::is_trivially_copyable_v<T>);
+                            write(&value, sizeof(T));
+                        }
+                    }, property.getValue());
+
+                if (property.getPropertySemantics() == EPropertySemantics::BindingInput)
+                {
+                    writeFlag(property.bindingInputHasNewValue());
+                }
+            }
+
+            void writeLogicNode(const LogicNodeImpl& logicNode)
+            {
+                writeFlag(logicNode.isDirty());
+                if (logicNode.getInputs() != nullptr)
+                {
+                    writeProperty(*logicNode.getInputs()->m_impl);
+                }
+                if (logicNode.getOutputs() != nullptr)
+                {
+                    writeProperty(*logicNode.getOutputs()->m_impl);
+                }
+            }
+
+        private:
+            std::vector<uint8_t>& m_snapshot;
+        };
+
+        // Reads the snapshot data twice - once to check that the data is complete (without modifying anything)
+        // and once to apply the values. This guarantees that a corrupted snapshot leaves the values untouched.
+        class SnapshotReader
+        {
+        public:
+            SnapshotReader(const uint8_t* data, size_t size, bool applyValues)
+                : m_data(data)
+                , m_size(size)
+                , m_applyValues(applyValues)
+            {
+            }
+
+            [[nodiscard]] bool read(void* target, size_t size)
+            {
+                if (m_size - m_offset < size)
+                {
+                    return false;
+                }
+                std::memcpy(target, m_data + m_offset, size);
+                m_offset += size;
+                return true;
+            }
+
+            [[nodiscard]] bool readFlag(bool& flag)
+            {
+                uint8_t byte = 0u;
+                if (!read(&byte, sizeof(byte)) || byte > 1u)
+                {
+                    return false;
+                }
+                flag = (byte == 1u);
+                return true;
+            }
+
+            [[nodiscard]] bool readProperty(PropertyImpl& property)
+            {
+                if (TypeUtils::CanHaveChildren(property.getType()))
+                {
+                    for (size_t i = 0; i < property.getChildCount(); ++i)
+                    {
+                        if (!readProperty(*property.getChild(i)->m_impl))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                // Copy the current value to get a variant holding the correct type
+                PropertyValue value = property.getValue();
+                const bool valueOk = std::visit([this](auto& valueToRead)
+                    {
+                        using T = std::decay_t<decltype(valueToRead)>;
+                        if constexpr (std::is_same_v<T, std::string>)
+                        {
+                            uint32_t length = 0u;
+                            if (!read(&length, sizeof(length)) || m_size - m_offset < length)
+                            {
+                                return false;
+                            }
+                            valueToRead.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+                            m_offset += length;
+                            return true;
+                        }
+                        else if constexpr (std::is_same_v<T, bool>)
+                        {
+                            return readFlag(valueToRead);
+                        }
+                        else
+                        {
+                            return read(&valueToRead, sizeof(T));
+                        }
+                    }, value);
+
+                if (!valueOk)
+                {
+                    return false;
+                }
+
+                bool bindingInputHasNewValue = false;
+                if (property.getPropertySemantics() == EPropertySemantics::BindingInput && !readFlag(bindingInputHasNewValue))
+                {
+                    return false;
+                }
+
+                if (m_applyValues)
+                {
+                    property.restoreSnapshotValue(std::move(value), bindingInputHasNewValue);
+                }
+                return true;
+            }
+
+            [[nodiscard]] bool readLogicNode(LogicNodeImpl& logicNode, bool isBinding)
+            {
+                bool dirty = false;
+                if (!readFlag(dirty))
+                {
+                    return false;
+                }
+                if (logicNode.getInputs() != nullptr && !readProperty(*logicNode.getInputs()->m_impl))
+                {
+                    return false;
+                }
+                if (logicNode.getOutputs() != nullptr && !readProperty(*logicNode.getOutputs()->m_impl))
+                {
+                    return false;
+                }
+
+                if (m_applyValues)
+                {
+                    // Bindings must be updated if any of their inputs has a value which was not passed to Ramses yet
+                    logicNode.setDirty(dirty || (isBinding && BindingInputsHaveNewValue(*logicNode.getInputs()->m_impl)));
+                }
+                return true;
+            }
+
+            [[nodiscard]] bool isAtEnd() const
+            {
+                return m_offset == m_size;
+            }
+
+        private:
+            static bool BindingInputsHaveNewValue(const PropertyImpl& property)
+            {
+                if (TypeUtils::CanHaveChildren(property.getType()))
+                {
+                    for (size_t i = 0; i < property.getChildCount(); ++i)
+                    {
+                        if (BindingInputsHaveNewValue(*property.getChild(i)->m_impl))
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                return property.bindingInputHasNewValue();
+            }
+
+            const uint8_t* m_data;
+            size_t m_size;
+            size_t m_offset = 0u;
+            bool m_applyValues;
+        };
+
+        enum class ENodeKind : uint8_t
+        {
+            LuaScript = 1,
+            NodeBinding = 2,
+            AppearanceBinding = 3,
+            CameraBinding = 4,
+            NativeLogicNode = 5,
+            AnimationNode = 6,
+            ExpressionNode = 7,
+        };
+
+        bool IsBinding(ENodeKind nodeKind)
+        {
+            return nodeKind == ENodeKind::NodeBinding || nodeKind == ENodeKind::AppearanceBinding || nodeKind == ENodeKind::CameraBinding;
+        }
+
+        template <typename Visitor>
+        [[nodiscard]] bool VisitLogicNodes(const ApiObjects& apiObjects, Visitor&& visitor)
+        {
+            for (const auto& script : apiObjects.getScripts())
+            {
+                if (!visitor(ENodeKind::LuaScript, script->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& binding : apiObjects.getNodeBindings())
+            {
+                if (!visitor(ENodeKind::NodeBinding, binding->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& binding : apiObjects.getAppearanceBindings())
+            {
+                if (!visitor(ENodeKind::AppearanceBinding, binding->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& binding : apiObjects.getCameraBindings())
+            {
+                if (!visitor(ENodeKind::CameraBinding, binding->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& nativeNode : apiObjects.getNativeLogicNodes())
+            {
+                if (!visitor(ENodeKind::NativeLogicNode, nativeNode->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& animationNode : apiObjects.getAnimationNodes())
+            {
+                if (!visitor(ENodeKind::AnimationNode, animationNode->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            for (const auto& expressionNode : apiObjects.getExpressionNodes())
+            {
+                if (!visitor(ENodeKind::ExpressionNode, expressionNode->m_impl.get()))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    uint64_t ValueSnapshot::GetStructureHash(const ApiObjects& apiObjects)
+    {
+        const std::optional<uint64_t> cachedHash = apiObjects.getCachedStructureHash();
+        if (cachedHash)
+        {
+            return *cachedHash;
+        }
+
+        const uint64_t structureHash = ComputeStructureHash(apiObjects);
+        apiObjects.setCachedStructureHash(structureHash);
+        return structureHash;
+    }
+
+    uint64_t ValueSnapshot::ComputeStructureHash(const ApiObjects& apiObjects)
+    {
+        StructureHasher hasher;
+        (void)VisitLogicNodes(apiObjects, [&hasher](ENodeKind nodeKind, const LogicNodeImpl& logicNode)
+            {
+                hasher.addLogicNode(static_cast<uint8_t>(nodeKind), logicNode);
+                return true;
+            });
+        return hasher.getHash();
+    }
+
+    void ValueSnapshot::Take(const ApiObjects& apiObjects, std::vector<uint8_t>& snapshot)
+    {
+        // Keeps the capacity, so that taking snapshots repeatedly into the same vector doesn't allocate
+        snapshot.clear();
+
+        SnapshotWriter writer(snapshot);
+        const SnapshotHeader header{ Magic, FormatVersion, GetStructureHash(apiObjects) };
+        writer.write(&header, sizeof(header));
+
+        (void)VisitLogicNodes(apiObjects, [&writer](ENodeKind /*nodeKind*/, const LogicNodeImpl& logicNode)
+            {
+                writer.writeLogicNode(logicNode);
+                return true;
+            });
+    }
+
+    bool ValueSnapshot::Restore(ApiObjects& apiObjects, const uint8_t* snapshotData, size_t snapshotSize, ErrorReporting& errorReporting)
+    {
+        SnapshotHeader header{};
+        if (snapshotData == nullptr || snapshotSize < sizeof(header))
+        {
+            errorReporting.add("Can't restore value snapshot, data is too small to contain a snapshot!");
+            return false;
+        }
+
+        std::memcpy(&header, snapshotData, sizeof(header));
+        if (header.magic != Magic)
+        {
+            errorReporting.add("Can't restore value snapshot, data is not a value snapshot!");
+            return false;
+        }
+
+        if (header.formatVersion != FormatVersion)
+        {
+            errorReporting.add(fmt::format("Can't restore value snapshot with format version {}, expected version {}!", header.formatVersion, FormatVersion));
+            return false;
+        }
+
+        if (header.structureHash != GetStructureHash(apiObjects))
+        {
+            errorReporting.add("Can't restore value snapshot, it was taken from logic nodes with different properties than the current ones!");
+            return false;
+        }
+
+        for (const bool applyValues : {false, true})
+        {
+            SnapshotReader reader(snapshotData + sizeof(header), snapshotSize - sizeof(header), applyValues);
+            const bool success = VisitLogicNodes(apiObjects, [&reader](ENodeKind nodeKind, LogicNodeImpl& logicNode)
+                {
+                    return reader.readLogicNode(logicNode, IsBinding(nodeKind));
+                });
+
+            if (!success || !reader.isAtEnd())
+            {
+                // Can only happen in the first (read-only) pass
+                errorReporting.add("Can't restore value snapshot, it contains corrupted data!");
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    class ApiObjects;
+    class ErrorReporting;
+
+    // Captures and restores the values of all properties of all logic nodes (but not the nodes, links or scripts themselves).
+    // Binary layout (all numbers in native byte order, the snapshot is not meant to be transferred across platforms):
+    // - header: magic (uint32), format version (uint32), structure hash (uint64)
+    // - for each logic node (in the order of the ApiObjects containers): dirty flag (uint8), followed by
+    //   the values of all primitive inputs and then all primitive outputs, depth-first
+    // - each value is stored as its raw bytes; strings as length (uint32) followed by the characters;
+    //   binding inputs additionally store their "has new value" flag (uint8)
+    class ValueSnapshot
+    {
+    public:
+        static void Take(const ApiObjects& apiObjects, std::vector<uint8_t>& snapshot);
+        [[nodiscard]] static bool Restore(ApiObjects& apiObjects, const uint8_t* snapshotData, size_t snapshotSize, ErrorReporting& errorReporting);
+
+        // Changes when nodes are created/destroyed or their properties differ in name, type or order
+        [[nodiscard]] static uint64_t ComputeStructureHash(const ApiObjects& apiObjects);
+        // Same as ComputeStructureHash, but only computed again after nodes were created or destroyed
+        [[nodiscard]] static uint64_t GetStructureHash(const ApiObjects& apiObjects);
+
+        static constexpr uint32_t Magic = 0x53564c52u; // 'RLVS'
+        static constexpr uint32_t FormatVersion = 1u;
+    };
+}
@@ -97,6 +97,25 @@ namespace rlogic::internal
         EXPECT_EQ(script, otherInstance.getApiObject(script->m_impl));
     }
 
+    TEST_F(AnApiObjects, ResetsCachedStructureHashWhenLogicNodesAreCreatedOrDestroyed)
+    {
+        EXPECT_FALSE(m_apiObjects.getCachedStructureHash());
+        m_apiObjects.setCachedStructureHash(42u);
+        EXPECT_EQ(42u, *m_apiObjects.getCachedStructureHash());
+
+        LuaScript* script = m_apiObjects.createLuaScript(m_state, m_valid_empty_script, "", "", m_errorReporting);
+        ASSERT_TRUE(script);
+        EXPECT_FALSE(m_apiObjects.getCachedStructureHash());
+
+        m_apiObjects.setCachedStructureHash(42u);
+        ASSERT_TRUE(m_apiObjects.destroy(*script, m_errorReporting));
+        EXPECT_FALSE(m_apiObjects.getCachedStructureHash());
+
+        m_apiObjects.setCachedStructureHash(42u);
+        ASSERT_TRUE(m_apiObjects.createRamsesNodeBinding(*m_node, "NodeBinding"));
+        EXPECT_FALSE(m_apiObjects.getCachedStructureHash());
+    }
+
     TEST_F(AnApiObjects, CreatesRamsesNodeBindingWithoutErrors)
     {
         RamsesNodeBinding* ramsesNodeBinding = m_apiObjects.createRamsesNodeBinding(*m_node, "NodeBinding");
@@ -373,6 +392,9 @@ namespace rlogic::internal
 
         ASSERT_NE(nullptr, serialized.links());
         ASSERT_EQ(0u, serialized.links()->size());
+
+        ASSERT_NE(nullptr, serialized.strings());
+        ASSERT_EQ(0u, serialized.strings()->size());
     }
 
     TEST_F(AnApiObjects_Serialization, CreatesFlatbufferContainer_ForScripts)
@@ -395,6 +417,39 @@ namespace rlogic::internal
         EXPECT_EQ("script", serializedScript.name()->str());
     }
 
+    TEST_F(AnApiObjects_Serialization, StoresEqualScriptSourcesAndNamesOnlyOnce)
+    {
+        flatbuffers::FlatBufferBuilder builder;
+        {
+            SolState tempState;
+            ApiObjects toSerialize;
+            toSerialize.createLuaScript(tempState, m_valid_empty_script, "", "script", m_errorReporting);
+            toSerialize.createLuaScript(tempState, m_valid_empty_script, "", "script", m_errorReporting);
+            toSerialize.createLuaScript(tempState, m_valid_empty_script, "", "other script", m_errorReporting);
+            ApiObjects::Serialize(toSerialize, builder);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
+
+        ASSERT_EQ(3u, serialized.luaScripts()->size());
+        const rlogic_serialization::LuaScript& script1 = *serialized.luaScripts()->Get(0);
+        const rlogic_serialization::LuaScript& script2 = *serialized.luaScripts()->Get(1);
+        const rlogic_serialization::LuaScript& script3 = *serialized.luaScripts()->Get(2);
+
+        // Same strings refer to the same data
+        EXPECT_EQ(script1.luaSourceCode(), script2.luaSourceCode());
+        EXPECT_EQ(script1.luaSourceCode(), script3.luaSourceCode());
+        EXPECT_EQ(script1.name(), script2.name());
+        EXPECT_NE(script1.name(), script3.name());
+        EXPECT_EQ("other script", script3.name()->str());
+
+        std::optional<ApiObjects> deserialized = ApiObjects::Deserialize(m_state, serialized, m_resolverMock, "", m_errorReporting);
+        ASSERT_TRUE(deserialized);
+        ASSERT_EQ(3u, deserialized->getScripts().size());
+        EXPECT_EQ("script", deserialized->getScripts()[1]->getName());
+        EXPECT_EQ("other script", deserialized->getScripts()[2]->getName());
+    }
+
     TEST_F(AnApiObjects_Serialization, CreatesFlatbufferContainers_ForBindings)
     {
         // Create test flatbuffer with only a node binding
@@ -466,8 +521,17 @@ namespace rlogic::internal
         ASSERT_EQ(1u, serialized.links()->size());
         const rlogic_serialization::Link& link = *serialized.links()->Get(0);
 
-        EXPECT_EQ(script.rootOutput()->children()->Get(0)->children()->Get(1), link.sourceProperty());
-        EXPECT_EQ(binding.base()->rootInput()->children()->Get(size_t(ENodePropertyStaticIndex::Rotation)), link.targetProperty());
+        // Records are stored breadth-first: OUT, OUT.nested, OUT.nested.anUnusedValue, OUT.nested.rotation
+        EXPECT_EQ(script.rootOutput(), link.sourceTree());
+        EXPECT_EQ(3u, link.sourceIndex());
+        // IN is the first record, followed by its children
+        EXPECT_EQ(binding.base()->rootInput(), link.targetTree());
+        EXPECT_EQ(1u + uint32_t(ENodePropertyStaticIndex::Rotation), link.targetIndex());
+
+        ASSERT_NE(nullptr, serialized.strings());
+        const auto& strings = *serialized.strings();
+        EXPECT_EQ("rotation", strings.Get(script.rootOutput()->records()->Get(3)->nameIndex())->str());
+        EXPECT_EQ("rotation", strings.Get(binding.base()->rootInput()->records()->Get(link.targetIndex())->nameIndex())->str());
     }
 
     TEST_F(AnApiObjects_Serialization, ReConstructsImplMappingsWhenCreatedFromDeserializedData)
@@ -565,7 +629,7 @@ namespace rlogic::internal
         // Test some more internal data (because of the fragile state of link's deserialization). Consider removing if we refactor the code
         const LinksMap& linkMap = apiObjects.getLogicNodeDependencies().getLinks();
         ASSERT_EQ(1u, linkMap.size());
-        EXPECT_EQ(linkMap.begin()->second, script1->getOutputs()->getChild("nested")->getChild("integer")->m_impl.get());
+        EXPECT_EQ(linkMap.begin()->second.source, script1->getOutputs()->getChild("nested")->getChild("integer")->m_impl.get());
         EXPECT_EQ(linkMap.begin()->first, script2->getInputs()->getChild("integer")->m_impl.get());
     }
 
@@ -669,6 +733,29 @@ namespace rlogic::internal
         EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading from serialized data: missing links container!");
     }
 
+    TEST_F(AnApiObjects_Serialization, ErrorWhenStringsContainerMissing)
+    {
+        {
+            auto apiObjects = rlogic_serialization::CreateApiObjects(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaScript>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesAppearanceBinding>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesCameraBinding>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::Link>>{}),
+                0 // no strings container
+            );
+            m_flatBufferBuilder.Finish(apiObjects);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
+        std::optional<ApiObjects> deserialized = ApiObjects::Deserialize(m_state, serialized, m_resolverMock, "unit test", m_errorReporting);
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading from serialized data: missing strings container!");
+    }
+
     TEST_F(AnApiObjects_Serialization, ReportsErrorWhenScriptCouldNotBeDeserialized)
     {
         {
@@ -678,7 +765,8 @@ namespace rlogic::internal
                 m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>>{}),
                 m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesAppearanceBinding>>{}),
                 m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::RamsesCameraBinding>>{}),
-                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::Link>>{})
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::Link>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<flatbuffers::String>>{})
             );
             m_flatBufferBuilder.Finish(apiObjects);
         }
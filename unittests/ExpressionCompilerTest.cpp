@@ -0,0 +1,287 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/ExpressionCompiler.h"
+
+#include "fmt/format.h"
+
+#include <cmath>
+#include <limits>
+
+using ::testing::ElementsAre;
+
+namespace rlogic::internal
+{
+    class AnExpressionCompiler : public ::testing::Test
+    {
+    protected:
+        static ExpressionProgram Compile(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs)
+        {
+            ExpressionCompilationResult result = ExpressionCompiler::Compile(source, inputs, outputs);
+            EXPECT_TRUE(result.program) << result.errorMessage;
+            return result.program ? std::move(*result.program) : ExpressionProgram();
+        }
+
+        static std::string CompileError(std::string_view source, const ExpressionVariables& inputs, const ExpressionVariables& outputs)
+        {
+            const ExpressionCompilationResult result = ExpressionCompiler::Compile(source, inputs, outputs);
+            EXPECT_FALSE(result.program);
+            return result.errorMessage;
+        }
+
+        // Evaluates an expression without inputs and returns the register of the result
+        static ExpressionValue Evaluate(std::string_view expression, EPropertyType type)
+        {
+            ExpressionProgram program = Compile(fmt::format("OUT.result = {}", expression), {}, { {"result", type} });
+            if (program.outputRegisters.empty())
+            {
+                return {};
+            }
+            EXPECT_FALSE(program.execute());
+            return program.registers[program.outputRegisters[0]];
+        }
+
+        static float EvaluateFloat(std::string_view expression)
+        {
+            return Evaluate(expression, EPropertyType::Float).components[0];
+        }
+
+        static int32_t EvaluateInt(std::string_view expression)
+        {
+            return Evaluate(expression, EPropertyType::Int32).integer;
+        }
+
+        static bool EvaluateBool(std::string_view expression)
+        {
+            return Evaluate(expression, EPropertyType::Bool).integer != 0;
+        }
+
+        static std::array<float, 3> EvaluateVec3(std::string_view expression)
+        {
+            const ExpressionValue value = Evaluate(expression, EPropertyType::Vec3f);
+            return { value.components[0], value.components[1], value.components[2] };
+        }
+
+        static constexpr float Epsilon = 1e-5f;
+    };
+
+    TEST_F(AnExpressionCompiler, EvaluatesFloatArithmeticWithLuaPrecedence)
+    {
+        EXPECT_FLOAT_EQ(7.f, EvaluateFloat("1.0 + 2.0 * 3.0"));
+        EXPECT_FLOAT_EQ(9.f, EvaluateFloat("(1.0 + 2.0) * 3.0"));
+        EXPECT_FLOAT_EQ(-6.f, EvaluateFloat("-2.0 * 3.0"));
+        EXPECT_FLOAT_EQ(0.5f, EvaluateFloat("1.0 - 1.0 / 2.0"));
+        EXPECT_FLOAT_EQ(1.f, EvaluateFloat("7.0 % 3.0"));
+        EXPECT_FLOAT_EQ(2.f, EvaluateFloat("-7.0 % 3.0"));
+        EXPECT_FLOAT_EQ(150.f, EvaluateFloat("1.5e2"));
+        EXPECT_FLOAT_EQ(0.25f, EvaluateFloat(".25"));
+    }
+
+    TEST_F(AnExpressionCompiler, EvaluatesIntegerArithmetic)
+    {
+        EXPECT_EQ(13, EvaluateInt("7 + 3 * 2"));
+        EXPECT_EQ(-4, EvaluateInt("3 - 7"));
+        EXPECT_EQ(1, EvaluateInt("7 % 3"));
+        EXPECT_EQ(2, EvaluateInt("-7 % 3"));
+        EXPECT_EQ(-2, EvaluateInt("7 % -3"));
+        EXPECT_EQ(std::numeric_limits<int32_t>::min(), EvaluateInt("2147483647 + 1"));
+    }
+
+    TEST_F(AnExpressionCompiler, PromotesIntegersToFloats)
+    {
+        EXPECT_FLOAT_EQ(1.5f, EvaluateFloat("1 + 0.5"));
+        EXPECT_FLOAT_EQ(3.f, EvaluateFloat("3"));
+        // Like in Lua, '/' always divides floats
+        EXPECT_FLOAT_EQ(3.5f, EvaluateFloat("7 / 2"));
+    }
+
+    TEST_F(AnExpressionCompiler, EvaluatesComparisonsAndLogicalOperators)
+    {
+        EXPECT_TRUE(EvaluateBool("1 < 2 and 2.5 >= 2"));
+        EXPECT_FALSE(EvaluateBool("not (1 == 1)"));
+        EXPECT_TRUE(EvaluateBool("1 ~= 2"));
+        EXPECT_FALSE(EvaluateBool("1 != 1"));
+        EXPECT_FALSE(EvaluateBool("true == false"));
+        EXPECT_TRUE(EvaluateBool("3 > 4 or 1.0 <= 1"));
+        EXPECT_TRUE(EvaluateBool("vec2(1.0, 2.0) == vec2(1.0, 2.0)"));
+        EXPECT_TRUE(EvaluateBool("vec2(1.0, 2.0) ~= vec2(1.0, 3.0)"));
+    }
+
+    TEST_F(AnExpressionCompiler, EvaluatesVectorsComponentWise)
+    {
+        EXPECT_THAT(EvaluateVec3("vec3(1.0, 2.0, 3.0) * 2.0"), ElementsAre(2.f, 4.f, 6.f));
+        EXPECT_THAT(EvaluateVec3("1 + vec3(1.0, 2.0, 3.0)"), ElementsAre(2.f, 3.f, 4.f));
+        EXPECT_THAT(EvaluateVec3("vec3(1.0, 2.0, 3.0) * vec3(2.0)"), ElementsAre(2.f, 4.f, 6.f));
+        EXPECT_THAT(EvaluateVec3("-vec3(vec2(1.0, 2.0), 3)"), ElementsAre(-1.f, -2.f, -3.f));
+        EXPECT_THAT(EvaluateVec3("vec4(1.0, 2.0, 3.0, 4.0).zyx"), ElementsAre(3.f, 2.f, 1.f));
+        EXPECT_FLOAT_EQ(2.f, EvaluateFloat("vec2(1.0, 2.0).y"));
+    }
+
+    TEST_F(AnExpressionCompiler, EvaluatesMathFunctions)
+    {
+        EXPECT_FLOAT_EQ(4.f, EvaluateFloat("sqrt(16.0)"));
+        EXPECT_FLOAT_EQ(-2.f, EvaluateFloat("floor(-1.5)"));
+        EXPECT_FLOAT_EQ(1.f, EvaluateFloat("clamp(5.0, 0.0, 1.0)"));
+        EXPECT_FLOAT_EQ(2.5f, EvaluateFloat("lerp(0.0, 10.0, 0.25)"));
+        EXPECT_FLOAT_EQ(1024.f, EvaluateFloat("pow(2.0, 10.0)"));
+        EXPECT_NEAR(0.785398f, EvaluateFloat("atan2(1.0, 1.0)"), Epsilon);
+        EXPECT_NEAR(1.f, EvaluateFloat("sin(0.5) * sin(0.5) + cos(0.5) * cos(0.5)"), Epsilon);
+        EXPECT_FLOAT_EQ(5.f, EvaluateFloat("length(vec2(3.0, 4.0))"));
+        EXPECT_FLOAT_EQ(5.f, EvaluateFloat("distance(vec2(1.0, 1.0), vec2(4.0, 5.0))"));
+        EXPECT_FLOAT_EQ(32.f, EvaluateFloat("dot(vec3(1.0, 2.0, 3.0), vec3(4.0, 5.0, 6.0))"));
+        EXPECT_THAT(EvaluateVec3("cross(vec3(1.0, 0.0, 0.0), vec3(0.0, 1.0, 0.0))"), ElementsAre(0.f, 0.f, 1.f));
+        EXPECT_THAT(EvaluateVec3("normalize(vec3(0.0, 2.0, 0.0))"), ElementsAre(0.f, 1.f, 0.f));
+        EXPECT_THAT(EvaluateVec3("max(vec3(1.0, 5.0, 3.0), 2.0)"), ElementsAre(2.f, 5.f, 3.f));
+        EXPECT_EQ(2, EvaluateInt("abs(-2)"));
+        EXPECT_EQ(1, EvaluateInt("min(1, 2)"));
+    }
+
+    TEST_F(AnExpressionCompiler, SelectsValuesByCondition)
+    {
+        EXPECT_FLOAT_EQ(10.f, EvaluateFloat("select(2 > 1, 10.0, 20.0)"));
+        EXPECT_THAT(EvaluateVec3("select(false, vec3(1.0), vec3(2.0))"), ElementsAre(2.f, 2.f, 2.f));
+        EXPECT_EQ(3, EvaluateInt("select(true, 3, 4)"));
+    }
+
+    TEST_F(AnExpressionCompiler, ConvertsBetweenIntegersAndFloats)
+    {
+        EXPECT_EQ(2, EvaluateInt("int(2.7)"));
+        EXPECT_EQ(-2, EvaluateInt("int(-2.7)"));
+        EXPECT_EQ(2, EvaluateInt("int(true) + 1"));
+        EXPECT_FLOAT_EQ(1.5f, EvaluateFloat("float(3) / 2"));
+    }
+
+    TEST_F(AnExpressionCompiler, ReadsInputsFromTheFirstRegisters)
+    {
+        ExpressionProgram program = Compile("OUT.scaled = IN.vector * IN.factor; OUT.count = IN.count + 1",
+            { {"factor", EPropertyType::Float}, {"vector", EPropertyType::Vec2f}, {"count", EPropertyType::Int32} },
+            { {"count", EPropertyType::Int32}, {"scaled", EPropertyType::Vec2f} });
+        ASSERT_EQ(2u, program.outputRegisters.size());
+
+        program.registers[0].components[0] = 2.f;
+        program.registers[1].components = { 1.f, 2.f, 0.f, 0.f };
+        program.registers[2].integer = 41;
+        EXPECT_FALSE(program.execute());
+
+        EXPECT_EQ(42, program.registers[program.outputRegisters[0]].integer);
+        EXPECT_FLOAT_EQ(2.f, program.registers[program.outputRegisters[1]].components[0]);
+        EXPECT_FLOAT_EQ(4.f, program.registers[program.outputRegisters[1]].components[1]);
+    }
+
+    TEST_F(AnExpressionCompiler, AcceptsCommentsAndSeparators)
+    {
+        ExpressionProgram program = Compile("-- two outputs\nOUT.a = 1 -- first\n\nOUT.b = 2;", {}, { {"a", EPropertyType::Int32}, {"b", EPropertyType::Int32} });
+        ASSERT_EQ(2u, program.outputRegisters.size());
+        EXPECT_FALSE(program.execute());
+        EXPECT_EQ(1, program.registers[program.outputRegisters[0]].integer);
+        EXPECT_EQ(2, program.registers[program.outputRegisters[1]].integer);
+    }
+
+    TEST_F(AnExpressionCompiler, ReportsErrorsWithPosition)
+    {
+        const ExpressionVariables floatOutput = { {"r", EPropertyType::Float} };
+        const ExpressionVariables inputs = { {"a", EPropertyType::Float} };
+
+        EXPECT_EQ("line 1, column 12: unknown input 'x'", CompileError("OUT.r = IN.x", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 14: expected an expression but found end of source", CompileError("OUT.r = 1.0 +", inputs, floatOutput));
+        EXPECT_EQ("line 2, column 5: output 'r' is assigned more than once", CompileError("OUT.r = 1.0\nOUT.r = 2.0", inputs, floatOutput));
+        EXPECT_EQ("output 'r' is not assigned", CompileError("", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 9: can't assign a value of type bool to output 'r' of type float", CompileError("OUT.r = true", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 19: '+' can't be applied to vec2 and vec3", CompileError("OUT.r = vec2(1.0) + vec3(1.0)", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 9: unknown function 'foo'", CompileError("OUT.r = foo(1.0)", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 9: 'sqrt' expects 1 argument(s) but got 2", CompileError("OUT.r = sqrt(1.0, 2.0)", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 13: unexpected character '$'", CompileError("OUT.r = 1.0 $", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 24: vec2 has no component 'z'", CompileError("OUT.r = vec2(1.0, 2.0).z", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 9: outputs can't be read", CompileError("OUT.r = OUT.r", inputs, floatOutput));
+        EXPECT_EQ("line 1, column 14: 'and' can't be applied to float and bool", CompileError("OUT.r = IN.a and true", inputs, floatOutput));
+    }
+
+    TEST_F(AnExpressionCompiler, ReportsErrorsForInvalidDeclarations)
+    {
+        const ExpressionVariables floatOutput = { {"r", EPropertyType::Float} };
+
+        EXPECT_EQ("expression node needs at least one output", CompileError("", {}, {}));
+        EXPECT_EQ("input name '1a' is not a valid identifier", CompileError("OUT.r = 1.0", { {"1a", EPropertyType::Float} }, floatOutput));
+        EXPECT_EQ("input name 'not' is not a valid identifier", CompileError("OUT.r = 1.0", { {"not", EPropertyType::Float} }, floatOutput));
+        EXPECT_EQ("output 'r' is declared more than once", CompileError("OUT.r = 1.0", {}, { {"r", EPropertyType::Float}, {"r", EPropertyType::Int32} }));
+        EXPECT_EQ("output 'r' has an unsupported type (only Float, Vec2f, Vec3f, Vec4f, Int32 and Bool are supported)",
+            CompileError("OUT.r = 1.0", {}, { {"r", EPropertyType::String} }));
+    }
+
+    TEST_F(AnExpressionCompiler, LimitsNestingOfExpressions)
+    {
+        const auto repeat = [](std::string_view text, size_t count) {
+            std::string repeated;
+            for (size_t i = 0u; i < count; ++i)
+            {
+                repeated += text;
+            }
+            return repeated;
+        };
+
+        EXPECT_EQ(1, EvaluateInt(repeat("(", 199u) + "1" + repeat(")", 199u)));
+        EXPECT_EQ(-1, EvaluateInt(repeat("- ", 199u) + "1"));
+        EXPECT_TRUE(EvaluateBool(repeat("not ", 199u) + "false"));
+        EXPECT_EQ(1, EvaluateInt(repeat("int(", 199u) + "1" + repeat(")", 199u)));
+
+        const ExpressionVariables intOutput = { {"r", EPropertyType::Int32} };
+        EXPECT_EQ("line 1, column 209: expression is nested too deeply (more than 200 levels)",
+            CompileError("OUT.r = " + repeat("(", 200u) + "1" + repeat(")", 200u), {}, intOutput));
+        EXPECT_EQ("line 1, column 409: expression is nested too deeply (more than 200 levels)",
+            CompileError("OUT.r = " + repeat("- ", 200u) + "1", {}, intOutput));
+        // Doesn't overflow the stack, e.g. for sources from corrupted files
+        EXPECT_EQ("line 1, column 209: expression is nested too deeply (more than 200 levels)",
+            CompileError("OUT.r = " + repeat("(", 100000u) + "1" + repeat(")", 100000u), {}, intOutput));
+    }
+
+    TEST_F(AnExpressionCompiler, ReportsRuntimeErrors)
+    {
+        ExpressionProgram program = Compile("OUT.r = 10 % IN.divisor", { {"divisor", EPropertyType::Int32} }, { {"r", EPropertyType::Int32} });
+        program.registers[0].integer = 0;
+        const std::optional<std::string> error = program.execute();
+        ASSERT_TRUE(error);
+        EXPECT_EQ("integer modulo by zero", *error);
+    }
+
+    TEST_F(AnExpressionCompiler, EvaluatesOnlyTheChosenValueOfSelectAndTheNeededOperandsOfLogicalOperators)
+    {
+        ExpressionProgram program = Compile(R"(
+            OUT.r = select(IN.b ~= 0, IN.a % IN.b, 0)
+            OUT.f = select(IN.b == 0, 0.5, select(IN.a > 0, IN.a % IN.b, int(1e20)))
+            OUT.x = IN.b ~= 0 and IN.a % IN.b == 1 and true
+            OUT.y = IN.b == 0 or IN.a % IN.b == 1)",
+            { {"a", EPropertyType::Int32}, {"b", EPropertyType::Int32} },
+            { {"r", EPropertyType::Int32}, {"f", EPropertyType::Float}, {"x", EPropertyType::Bool}, {"y", EPropertyType::Bool} });
+
+        program.registers[0].integer = 7;
+        program.registers[1].integer = 0;
+        for (int run = 0; run < 2; ++run)
+        {
+            ASSERT_FALSE(program.execute());
+            EXPECT_EQ(0, program.registers[program.outputRegisters[0]].integer);
+            EXPECT_FLOAT_EQ(0.5f, program.registers[program.outputRegisters[1]].components[0]);
+            EXPECT_EQ(0, program.registers[program.outputRegisters[2]].integer);
+            EXPECT_EQ(1, program.registers[program.outputRegisters[3]].integer);
+        }
+
+        program.registers[1].integer = 3;
+        ASSERT_FALSE(program.execute());
+        EXPECT_EQ(1, program.registers[program.outputRegisters[0]].integer);
+        EXPECT_FLOAT_EQ(1.f, program.registers[program.outputRegisters[1]].components[0]);
+        EXPECT_EQ(1, program.registers[program.outputRegisters[2]].integer);
+        EXPECT_EQ(1, program.registers[program.outputRegisters[3]].integer);
+
+        // The values which are chosen still report their errors
+        program.registers[0].integer = -7;
+        const std::optional<std::string> error = program.execute();
+        ASSERT_TRUE(error);
+        EXPECT_EQ("can't convert 1e+20 to an integer", *error);
+    }
+}
@@ -15,6 +15,11 @@
 
 #include "LogTestUtils.h"
 
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
 namespace rlogic
 {
     // Test default state without fixture
@@ -99,4 +104,112 @@ namespace rlogic
 
         EXPECT_THAT(m_logTypes, ::testing::ElementsAre(ELogMessageType::Fatal, ELogMessageType::Error));
     }
+
+    TEST_F(ALogger, DoesNotEvaluateArgumentsOfMessagesBelowVerbosityLimit)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Info);
+
+        int evaluations = 0;
+        auto countEvaluation = [&evaluations]() { return ++evaluations; };
+        LOG_DEBUG("debug {}", countEvaluation());
+        LOG_TRACE("trace {}", countEvaluation());
+        EXPECT_EQ(0, evaluations);
+        EXPECT_TRUE(m_logMessages.empty());
+
+        LOG_INFO("info {}", countEvaluation());
+        EXPECT_EQ(1, evaluations);
+        EXPECT_THAT(m_logMessages, ::testing::ElementsAre("info 1"));
+    }
+
+    TEST_F(ALogger, OutputsMessagesOnSeparateThreadWhenLoggingAsynchronously)
+    {
+        Logger::SetDefaultLogging(false);
+        Logger::SetAsyncLogging(true);
+
+        LOG_INFO("first");
+        LOG_WARN("second {}", 2);
+
+        // Disabling outputs all queued messages
+        Logger::SetAsyncLogging(false);
+        EXPECT_THAT(m_logTypes, ::testing::ElementsAre(ELogMessageType::Info, ELogMessageType::Warn));
+        EXPECT_THAT(m_logMessages, ::testing::ElementsAre("first", "second 2"));
+
+        // Synchronous again
+        LOG_INFO("third");
+        EXPECT_EQ("third", m_logMessages.back());
+
+        Logger::SetDefaultLogging(true);
+    }
+
+    TEST_F(ALogger, DoesNotLoseMessagesWhichAreLoggedWhileAsynchronousLoggingIsDisabled)
+    {
+        Logger::SetDefaultLogging(false);
+        Logger::SetAsyncLogging(true);
+
+        std::atomic<int> startedThreads = 0;
+        std::vector<std::thread> threads;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([threadIndex, &startedThreads]() {
+                ++startedThreads;
+                for (int i = 0; i < 1000; ++i)
+                {
+                    LOG_INFO("Thread {} message {}", threadIndex, i);
+                }
+            });
+        }
+        while (startedThreads < 4)
+        {
+            std::this_thread::yield();
+        }
+        Logger::SetAsyncLogging(false);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Each message is either output or counted as dropped because the queue was full
+        size_t messageCount = 0u;
+        for (const std::string& message : m_logMessages)
+        {
+            size_t droppedMessages = 0u;
+            if (std::sscanf(message.c_str(), "Dropped %zu log messages", &droppedMessages) == 1)
+            {
+                messageCount += droppedMessages;
+            }
+            else
+            {
+                ++messageCount;
+            }
+        }
+        EXPECT_EQ(4000u, messageCount);
+
+        Logger::SetDefaultLogging(true);
+    }
+
+    TEST_F(ALogger, ForwardsMessagesOfSeveralThreadsToLogHandlerOneAtATime)
+    {
+        Logger::SetDefaultLogging(false);
+
+        std::vector<std::thread> threads;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([threadIndex]() {
+                for (int i = 0; i < 100; ++i)
+                {
+                    LOG_INFO("Thread {} message {}", threadIndex, i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // The handler of the fixture is not thread-safe itself
+        EXPECT_EQ(400u, m_logMessages.size());
+        EXPECT_EQ(400u, m_logTypes.size());
+
+        Logger::SetDefaultLogging(true);
+    }
 }
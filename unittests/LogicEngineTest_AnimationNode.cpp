@@ -0,0 +1,285 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "fmt/format.h"
+
+#include <cmath>
+
+using ::testing::ElementsAre;
+using ::testing::FloatNear;
+
+namespace rlogic
+{
+    class ALogicEngine_AnimationNode : public ALogicEngine
+    {
+    protected:
+        static AnimationChannel CreateChannel(std::string name, EPropertyType type, EInterpolationType interpolation, std::vector<float> timeStamps, std::vector<float> keyframes)
+        {
+            AnimationChannel channel;
+            channel.name = std::move(name);
+            channel.type = type;
+            channel.interpolation = interpolation;
+            channel.timeStamps = std::move(timeStamps);
+            channel.keyframes = std::move(keyframes);
+            return channel;
+        }
+
+        // Sets the time input, updates and returns the value of the given output
+        template <typename T>
+        T evaluateAt(AnimationNode& node, float time, std::string_view output)
+        {
+            EXPECT_TRUE(node.getInputs()->getChild("time")->set<float>(time));
+            EXPECT_TRUE(m_logicEngine.update());
+            return *node.getOutputs()->getChild(output)->get<T>();
+        }
+
+        static constexpr float Epsilon = 1e-5f;
+    };
+
+    TEST_F(ALogicEngine_AnimationNode, HasTimeInputsAndOneOutputPerChannel)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("scalar", EPropertyType::Float, EInterpolationType::Linear, {0.f, 2.f}, {0.f, 1.f}),
+            CreateChannel("position", EPropertyType::Vec3f, EInterpolationType::Step, {0.f, 1.f, 3.f}, {0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 2.f, 2.f, 2.f}),
+            }, "animation");
+        ASSERT_NE(nullptr, node);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ("animation", node->getName());
+        EXPECT_FLOAT_EQ(3.f, node->getDuration());
+        EXPECT_EQ(2u, node->getChannelCount());
+
+        ASSERT_EQ(2u, node->getInputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, node->getInputs()->getChild("time")->getType());
+        EXPECT_EQ(EPropertyType::Bool, node->getInputs()->getChild("loop")->getType());
+        ASSERT_EQ(2u, node->getOutputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, node->getOutputs()->getChild("scalar")->getType());
+        EXPECT_EQ(EPropertyType::Vec3f, node->getOutputs()->getChild("position")->getType());
+
+        EXPECT_EQ(node, *m_logicEngine.animationNodes().begin());
+        EXPECT_EQ(node, m_logicEngine.findAnimationNode("animation"));
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, InterpolatesLinearlyAndHoldsValuesOutsideOfKeyframes)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Vec2f, EInterpolationType::Linear, {1.f, 2.f, 4.f}, {0.f, 10.f, 1.f, 20.f, 3.f, 0.f}),
+            });
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 0.f, "value"), ElementsAre(0.f, 10.f));
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 1.5f, "value"), ElementsAre(0.5f, 15.f));
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 3.f, "value"), ElementsAre(2.f, 10.f));
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 5.f, "value"), ElementsAre(3.f, 0.f));
+        // Jumping backwards
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 1.25f, "value"), ElementsAre(0.25f, 12.5f));
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, HoldsPreviousKeyframeWithStepInterpolation)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Float, EInterpolationType::Step, {0.f, 1.f, 2.f}, {5.f, 6.f, 7.f}),
+            });
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_FLOAT_EQ(5.f, evaluateAt<float>(*node, 0.9f, "value"));
+        EXPECT_FLOAT_EQ(6.f, evaluateAt<float>(*node, 1.f, "value"));
+        EXPECT_FLOAT_EQ(6.f, evaluateAt<float>(*node, 1.5f, "value"));
+        EXPECT_FLOAT_EQ(7.f, evaluateAt<float>(*node, 2.5f, "value"));
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, InterpolatesWithCubicHermiteSplines)
+    {
+        AnimationChannel channel = CreateChannel("value", EPropertyType::Float, EInterpolationType::Cubic, {0.f, 2.f}, {0.f, 1.f});
+        channel.tangentsIn = {0.f, 0.f};
+        channel.tangentsOut = {0.f, 0.f};
+        AnimationChannel channelWithTangents = CreateChannel("valueWithTangents", EPropertyType::Float, EInterpolationType::Cubic, {0.f, 2.f}, {0.f, 1.f});
+        channelWithTangents.tangentsIn = {0.f, 0.5f};
+        channelWithTangents.tangentsOut = {0.5f, 0.f};
+
+        AnimationNode* node = m_logicEngine.createAnimationNode({channel, channelWithTangents});
+        ASSERT_NE(nullptr, node);
+
+        // Zero tangents result in a smooth step: 3t^2 - 2t^3
+        EXPECT_NEAR(0.15625f, evaluateAt<float>(*node, 0.5f, "value"), Epsilon);
+        EXPECT_NEAR(0.5f, evaluateAt<float>(*node, 1.f, "value"), Epsilon);
+        // Tangents matching the slope (0.5 per second) make this a straight line from 0 to 1 in 2 seconds
+        EXPECT_NEAR(0.25f, evaluateAt<float>(*node, 0.5f, "valueWithTangents"), Epsilon);
+        EXPECT_NEAR(1.f, evaluateAt<float>(*node, 2.f, "valueWithTangents"), Epsilon);
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, InterpolatesQuaternionsWithSlerp)
+    {
+        const float halfAngleSine = std::sin(3.14159265f / 4.f);
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("rotation", EPropertyType::Vec4f, EInterpolationType::Slerp, {0.f, 1.f}, {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, halfAngleSine, halfAngleSine}),
+            });
+        ASSERT_NE(nullptr, node);
+
+        // Half way of a 90 degree rotation around z
+        EXPECT_THAT(evaluateAt<vec4f>(*node, 0.5f, "rotation"),
+            ElementsAre(FloatNear(0.f, Epsilon), FloatNear(0.f, Epsilon), FloatNear(0.38268343f, Epsilon), FloatNear(0.92387953f, Epsilon)));
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, WrapsTimeWhenLooping)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Float, EInterpolationType::Linear, {0.f, 2.f}, {0.f, 2.f}),
+            });
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("loop")->set<bool>(true));
+        EXPECT_FLOAT_EQ(0.5f, evaluateAt<float>(*node, 2.5f, "value"));
+        EXPECT_FLOAT_EQ(1.5f, evaluateAt<float>(*node, 7.5f, "value"));
+        EXPECT_FLOAT_EQ(1.5f, evaluateAt<float>(*node, -0.5f, "value"));
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, EvaluatesManyChannelsWithDifferentKeyframes)
+    {
+        AnimationChannels channels;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            const float end = static_cast<float>(i + 1);
+            channels.push_back(CreateChannel(fmt::format("channel{}", i), EPropertyType::Vec3f, EInterpolationType::Linear,
+                {0.f, end}, {0.f, 0.f, 0.f, end, 2.f * end, 3.f * end}));
+        }
+
+        AnimationNode* node = m_logicEngine.createAnimationNode(channels);
+        ASSERT_NE(nullptr, node);
+        EXPECT_FLOAT_EQ(100.f, node->getDuration());
+
+        EXPECT_TRUE(node->getInputs()->getChild("time")->set<float>(1.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        for (size_t i = 0; i < 100; ++i)
+        {
+            // Each channel moves with the same speed (1, 2, 3) until it reaches its last keyframe
+            EXPECT_THAT(*node->getOutputs()->getChild(i)->get<vec3f>(), ElementsAre(FloatNear(1.f, Epsilon), FloatNear(2.f, Epsilon), FloatNear(3.f, Epsilon)));
+        }
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, CanBeLinkedToScripts)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Float, EInterpolationType::Linear, {0.f, 1.f}, {0.f, 10.f}),
+            });
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value * 2
+            end
+        )");
+        ASSERT_NE(nullptr, node);
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.link(*node->getOutputs()->getChild("value"), *script->getInputs()->getChild("value")));
+
+        EXPECT_TRUE(node->getInputs()->getChild("time")->set<float>(0.5f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(10.f, *script->getOutputs()->getChild("value")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, ReportsErrorForInvalidChannels)
+    {
+        AnimationChannel cubicWithoutTangents = CreateChannel("c", EPropertyType::Float, EInterpolationType::Cubic, {0.f}, {0.f});
+        AnimationChannel linearWithTangents = CreateChannel("c", EPropertyType::Float, EInterpolationType::Linear, {0.f}, {0.f});
+        linearWithTangents.tangentsIn = {0.f};
+        linearWithTangents.tangentsOut = {0.f};
+
+        const std::vector<std::pair<AnimationChannels, std::string>> errorCases = {
+            {{}, "animation needs at least one channel"},
+            {{CreateChannel("", EPropertyType::Float, EInterpolationType::Linear, {0.f}, {0.f})}, "channels must have a name"},
+            {{CreateChannel("c", EPropertyType::Float, EInterpolationType::Linear, {0.f}, {0.f}), CreateChannel("c", EPropertyType::Float, EInterpolationType::Step, {0.f}, {0.f})},
+                "channel 'c' is declared more than once"},
+            {{CreateChannel("c", EPropertyType::Int32, EInterpolationType::Linear, {0.f}, {0.f})}, "channel 'c' has an unsupported type (only Float, Vec2f, Vec3f and Vec4f are supported)"},
+            {{CreateChannel("c", EPropertyType::Vec3f, EInterpolationType::Slerp, {0.f}, {0.f, 0.f, 0.f})}, "channel 'c' uses slerp interpolation which requires type Vec4f"},
+            {{CreateChannel("c", EPropertyType::Float, EInterpolationType::Linear, {}, {})}, "channel 'c' has no keyframes"},
+            {{CreateChannel("c", EPropertyType::Float, EInterpolationType::Linear, {1.f, 1.f}, {0.f, 0.f})}, "channel 'c' has time stamps which are not strictly increasing"},
+            {{CreateChannel("c", EPropertyType::Vec2f, EInterpolationType::Linear, {0.f, 1.f}, {0.f, 0.f, 0.f})}, "channel 'c' has 3 keyframe values but expected 4 (one per component and time stamp)"},
+            {{cubicWithoutTangents}, "channel 'c' uses cubic interpolation and needs 1 values for both in and out tangents"},
+            {{linearWithTangents}, "channel 'c' has tangents but doesn't use cubic interpolation"},
+            {{CreateChannel("c", EPropertyType::Vec4f, EInterpolationType::Slerp, {0.f, 1.f}, {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f})},
+                "channel 'c' uses slerp interpolation and has a keyframe which is not a valid quaternion (keyframe 1)"},
+        };
+
+        for (const auto& errorCase : errorCases)
+        {
+            EXPECT_EQ(nullptr, m_logicEngine.createAnimationNode(errorCase.first, "animation"));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_EQ(fmt::format("Can't create animation node 'animation': {}!", errorCase.second), m_logicEngine.getErrors()[0].message);
+        }
+        EXPECT_TRUE(m_logicEngine.animationNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, ReportsErrorForInvalidTime)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Float, EInterpolationType::Linear, {0.f, 1.f}, {0.f, 1.f}),
+            }, "animation");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("time")->set<float>(std::nanf("")));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(node, m_logicEngine.getErrors()[0].node);
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, CanBeDestroyed)
+    {
+        AnimationNode* node = m_logicEngine.createAnimationNode({
+            CreateChannel("value", EPropertyType::Float, EInterpolationType::Linear, {0.f, 1.f}, {0.f, 1.f}),
+            });
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(m_logicEngine.destroy(*node));
+        EXPECT_TRUE(m_logicEngine.animationNodes().empty());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_AnimationNode, SavesAndLoadsKeyframesAndPropertyValues)
+    {
+        WithTempDirectory tempDirectory;
+
+        {
+            AnimationChannel cubic = CreateChannel("cubic", EPropertyType::Float, EInterpolationType::Cubic, {0.f, 2.f}, {0.f, 1.f});
+            cubic.tangentsIn = {0.f, 0.5f};
+            cubic.tangentsOut = {0.5f, 0.f};
+
+            LogicEngine logicEngine;
+            AnimationNode* node = logicEngine.createAnimationNode({
+                CreateChannel("linear", EPropertyType::Vec2f, EInterpolationType::Linear, {0.f, 1.f}, {0.f, 0.f, 10.f, 20.f}),
+                cubic
+                }, "animation");
+            ASSERT_NE(nullptr, node);
+            EXPECT_TRUE(node->getInputs()->getChild("time")->set<float>(0.5f));
+            EXPECT_TRUE(node->getInputs()->getChild("loop")->set<bool>(true));
+            ASSERT_TRUE(logicEngine.update());
+            ASSERT_TRUE(logicEngine.saveToFile("animation.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("animation.rlogic"));
+        AnimationNode* node = m_logicEngine.findAnimationNode("animation");
+        ASSERT_NE(nullptr, node);
+        EXPECT_FLOAT_EQ(2.f, node->getDuration());
+        EXPECT_EQ(2u, node->getChannelCount());
+        EXPECT_TRUE(*node->getInputs()->getChild("loop")->get<bool>());
+        EXPECT_THAT(*node->getOutputs()->getChild("linear")->get<vec2f>(), ElementsAre(5.f, 10.f));
+
+        EXPECT_THAT(evaluateAt<vec2f>(*node, 2.25f, "linear"), ElementsAre(2.5f, 5.f));
+        EXPECT_NEAR(0.125f, evaluateAt<float>(*node, 0.25f, "cubic"), Epsilon);
+    }
+}
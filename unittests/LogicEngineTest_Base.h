@@ -15,6 +15,7 @@
 
 #include "ramses-logic/LogicEngine.h"
 #include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
@@ -63,4 +64,53 @@ namespace rlogic
         }
 
     };
+
+    // Scripts linked into a chain in the order in which they are created, each one outputs IN.value + IN.offset
+    class ALogicEngine_ScriptChain : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_chainedScriptSource = R"(
+            function interface()
+                IN.value = INT
+                IN.offset = INT
+                OUT.value = INT
+            end
+
+            function run()
+                OUT.value = IN.value + IN.offset
+            end
+        )";
+
+        LuaScript& createChainedScript(std::string_view name)
+        {
+            LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_chainedScriptSource, name);
+            EXPECT_NE(nullptr, script);
+            if (m_lastChainedScript != nullptr)
+            {
+                EXPECT_TRUE(m_logicEngine.link(*m_lastChainedScript->getOutputs()->getChild("value"), *script->getInputs()->getChild("value")));
+            }
+            else
+            {
+                m_firstChainedScript = script;
+            }
+            m_lastChainedScript = script;
+            return *script;
+        }
+
+        static int32_t Output(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("value")->get<int32_t>();
+        }
+
+        // Sets the value of the first script in the chain and updates
+        void updateWithSourceValue(int32_t value)
+        {
+            EXPECT_TRUE(m_firstChainedScript->getInputs()->getChild("value")->set<int32_t>(value));
+            EXPECT_TRUE(m_logicEngine.update());
+        }
+
+    private:
+        LuaScript* m_firstChainedScript = nullptr;
+        LuaScript* m_lastChainedScript = nullptr;
+    };
 }
@@ -0,0 +1,261 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/LogicEngineImpl.h"
+#include "impl/PropertyImpl.h"
+
+#include <limits>
+
+using ::testing::ElementsAre;
+
+namespace rlogic
+{
+    class ALogicEngine_ConvertingLinks : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_ConvertingLinks()
+            : m_sourceScript(*m_logicEngine.createLuaScriptFromSource(m_sourceScriptSource, "SourceScript"))
+            , m_targetScript(*m_logicEngine.createLuaScriptFromSource(m_targetScriptSource, "TargetScript"))
+        {
+        }
+
+        const Property& output(std::string_view name) const
+        {
+            return *m_sourceScript.getOutputs()->getChild(name);
+        }
+
+        Property& source(std::string_view name)
+        {
+            return *m_sourceScript.getInputs()->getChild(name);
+        }
+
+        Property& target(std::string_view name)
+        {
+            return *m_targetScript.getInputs()->getChild(name);
+        }
+
+        const std::string_view m_sourceScriptSource = R"(
+            function interface()
+                IN.int = INT
+                IN.float = FLOAT
+                IN.bool = BOOL
+                IN.vec3f = VEC3F
+                IN.vec3i = VEC3I
+                OUT.int = INT
+                OUT.float = FLOAT
+                OUT.bool = BOOL
+                OUT.vec3f = VEC3F
+                OUT.vec3i = VEC3I
+                OUT.string = STRING
+            end
+            function run()
+                OUT.int = IN.int
+                OUT.float = IN.float
+                OUT.bool = IN.bool
+                OUT.vec3f = IN.vec3f
+                OUT.vec3i = IN.vec3i
+            end
+        )";
+
+        const std::string_view m_targetScriptSource = R"(
+            function interface()
+                IN.int = INT
+                IN.float = FLOAT
+                IN.bool = BOOL
+                IN.vec2f = VEC2F
+                IN.vec3f = VEC3F
+                IN.vec3i = VEC3I
+            end
+            function run()
+            end
+        )";
+
+        LuaScript& m_sourceScript;
+        LuaScript& m_targetScript;
+    };
+
+    TEST_F(ALogicEngine_ConvertingLinks, ConvertsBetweenNumbersAndBooleans)
+    {
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("int"), target("float")));
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("float"), target("int")));
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("int"), target("bool")));
+
+        EXPECT_TRUE(source("int").set<int32_t>(7));
+        EXPECT_TRUE(source("float").set<float>(-2.75f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(7.f, *target("float").get<float>());
+        EXPECT_EQ(-2, *target("int").get<int32_t>());
+        EXPECT_TRUE(*target("bool").get<bool>());
+
+        EXPECT_TRUE(source("int").set<int32_t>(0));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(0.f, *target("float").get<float>());
+        EXPECT_FALSE(*target("bool").get<bool>());
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, ConvertsBooleansToNumbers)
+    {
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("bool"), target("float")));
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("bool"), target("int")));
+
+        EXPECT_TRUE(source("bool").set<bool>(true));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *target("float").get<float>());
+        EXPECT_EQ(1, *target("int").get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, ConvertsVectorsComponentWise)
+    {
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("vec3i"), target("vec3f")));
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("vec3f"), target("vec3i")));
+
+        EXPECT_TRUE(source("vec3i").set<vec3i>({ 1, -2, 3 }));
+        EXPECT_TRUE(source("vec3f").set<vec3f>({ 0.5f, -1.5f, 100.9f }));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*target("vec3f").get<vec3f>(), ElementsAre(1.f, -2.f, 3.f));
+        EXPECT_THAT(*target("vec3i").get<vec3i>(), ElementsAre(0, -1, 100));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, SaturatesFloatsWhichDontFitIntoIntegers)
+    {
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("float"), target("int")));
+
+        EXPECT_TRUE(source("float").set<float>(1e20f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(std::numeric_limits<int32_t>::max(), *target("int").get<int32_t>());
+
+        EXPECT_TRUE(source("float").set<float>(-1e20f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(std::numeric_limits<int32_t>::min(), *target("int").get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, ProducesErrorIfTypesCantBeConverted)
+    {
+        EXPECT_FALSE(m_logicEngine.linkWithConversion(output("string"), target("float")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't convert source property 'string:STRING' to target property 'float:FLOAT' (only numbers, booleans and numeric vectors with the same number of components can be converted)",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.linkWithConversion(output("vec3f"), target("vec2f")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't convert source property 'vec3f:VEC3F' to target property 'vec2f:VEC2F' (only numbers, booleans and numeric vectors with the same number of components can be converted)",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.isLinked(m_targetScript));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, LinksSingleComponents)
+    {
+        EXPECT_TRUE(target("vec3f").set<vec3f>({ 10.f, 20.f, 30.f }));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("vec3f"), 1u, target("float"), 0u));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 0u));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("int"), 0u, target("vec3f"), 2u));
+
+        EXPECT_TRUE(source("vec3f").set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(source("float").set<float>(0.5f));
+        EXPECT_TRUE(source("int").set<int32_t>(4));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(2.f, *target("float").get<float>());
+        // The component which is not linked keeps its value
+        EXPECT_THAT(*target("vec3f").get<vec3f>(), ElementsAre(0.5f, 20.f, 4.f));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, ProducesErrorIfComponentIsOutOfRange)
+    {
+        EXPECT_FALSE(m_logicEngine.linkComponent(output("vec3f"), 3u, target("float"), 0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't link component 3 of source property 'vec3f:VEC3F' to component 0 of target property 'float:FLOAT' (component index out of range or type has no components)",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.linkComponent(output("float"), 0u, target("float"), 1u));
+        EXPECT_FALSE(m_logicEngine.linkComponent(output("string"), 0u, target("float"), 0u));
+        EXPECT_FALSE(m_logicEngine.isLinked(m_targetScript));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, ProducesErrorIfComponentIsAlreadyLinked)
+    {
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 1u));
+
+        EXPECT_FALSE(m_logicEngine.linkComponent(output("int"), 0u, target("vec3f"), 1u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("The property 'int' of LogicNode 'SourceScript' is already linked to the property 'vec3f' of LogicNode 'TargetScript'", m_logicEngine.getErrors()[0].message);
+
+        // Whole-value links and component links can't be mixed on the same input
+        EXPECT_FALSE(m_logicEngine.link(output("vec3f"), target("vec3f")));
+        EXPECT_FALSE(m_logicEngine.linkWithConversion(output("vec3i"), target("vec3f")));
+
+        ASSERT_TRUE(m_logicEngine.link(output("float"), target("float")));
+        EXPECT_FALSE(m_logicEngine.linkComponent(output("int"), 0u, target("float"), 0u));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, UnlinkRemovesAllComponentLinksBetweenTwoProperties)
+    {
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 0u));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 1u));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("int"), 0u, target("vec3f"), 2u));
+
+        EXPECT_TRUE(m_logicEngine.unlink(output("float"), target("vec3f")));
+        // Still linked to the int output, so it can't be set
+        EXPECT_FALSE(target("vec3f").set<vec3f>({ 1.f, 1.f, 1.f }));
+
+        EXPECT_TRUE(source("float").set<float>(5.f));
+        EXPECT_TRUE(source("int").set<int32_t>(6));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*target("vec3f").get<vec3f>(), ElementsAre(0.f, 0.f, 6.f));
+
+        EXPECT_FALSE(m_logicEngine.unlink(output("float"), target("vec3f")));
+        EXPECT_TRUE(m_logicEngine.unlink(output("int"), target("vec3f")));
+        EXPECT_TRUE(target("vec3f").set<vec3f>({ 1.f, 1.f, 1.f }));
+        EXPECT_FALSE(m_logicEngine.isLinked(m_targetScript));
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, DestroyingSourceNodeRemovesConvertingLinks)
+    {
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("int"), target("float")));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 0u));
+
+        ASSERT_TRUE(m_logicEngine.destroy(m_sourceScript));
+        EXPECT_TRUE(m_logicEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().empty());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_ConvertingLinks, SavesAndLoadsConvertingAndComponentLinks)
+    {
+        WithTempDirectory tempDirectory;
+
+        ASSERT_TRUE(m_logicEngine.linkWithConversion(output("int"), target("float")));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("vec3f"), 2u, target("vec3f"), 0u));
+        ASSERT_TRUE(m_logicEngine.linkComponent(output("float"), 0u, target("vec3f"), 1u));
+        ASSERT_TRUE(m_logicEngine.saveToFile("converting_links.rlogic"));
+
+        LogicEngine loadedEngine;
+        ASSERT_TRUE(loadedEngine.loadFromFile("converting_links.rlogic"));
+        EXPECT_EQ(3u, loadedEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().size());
+
+        LuaScript* sourceScript = loadedEngine.findScript("SourceScript");
+        LuaScript* targetScript = loadedEngine.findScript("TargetScript");
+        ASSERT_NE(nullptr, sourceScript);
+        ASSERT_NE(nullptr, targetScript);
+
+        EXPECT_TRUE(sourceScript->getInputs()->getChild("int")->set<int32_t>(3));
+        EXPECT_TRUE(sourceScript->getInputs()->getChild("float")->set<float>(1.5f));
+        EXPECT_TRUE(sourceScript->getInputs()->getChild("vec3f")->set<vec3f>({ 7.f, 8.f, 9.f }));
+        ASSERT_TRUE(loadedEngine.update());
+
+        EXPECT_FLOAT_EQ(3.f, *targetScript->getInputs()->getChild("float")->get<float>());
+        EXPECT_THAT(*targetScript->getInputs()->getChild("vec3f")->get<vec3f>(), ElementsAre(9.f, 1.5f, 0.f));
+    }
+}
@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/ExpressionNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+using ::testing::ElementsAre;
+
+namespace rlogic
+{
+    class ALogicEngine_ExpressionNode : public ALogicEngine
+    {
+    protected:
+        static ExpressionNode* CreateBlendNode(LogicEngine& logicEngine)
+        {
+            return logicEngine.createExpressionNode(R"(
+                OUT.y = IN.a * 0.5 + IN.b
+                OUT.position = IN.direction * IN.a
+                OUT.visible = IN.a > 1.0 and IN.enabled
+                OUT.count = IN.count * 2
+                )",
+                { {"a", EPropertyType::Float}, {"b", EPropertyType::Float}, {"direction", EPropertyType::Vec3f}, {"enabled", EPropertyType::Bool}, {"count", EPropertyType::Int32} },
+                { {"y", EPropertyType::Float}, {"position", EPropertyType::Vec3f}, {"visible", EPropertyType::Bool}, {"count", EPropertyType::Int32} },
+                "blend");
+        }
+    };
+
+    TEST_F(ALogicEngine_ExpressionNode, HasDeclaredInputsAndOutputs)
+    {
+        ExpressionNode* node = CreateBlendNode(m_logicEngine);
+        ASSERT_NE(nullptr, node);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ("blend", node->getName());
+        EXPECT_NE(std::string_view::npos, node->getSource().find("OUT.y = IN.a * 0.5 + IN.b"));
+
+        ASSERT_EQ(5u, node->getInputs()->getChildCount());
+        EXPECT_EQ("a", node->getInputs()->getChild(0)->getName());
+        EXPECT_EQ(EPropertyType::Vec3f, node->getInputs()->getChild("direction")->getType());
+        EXPECT_EQ(EPropertyType::Bool, node->getInputs()->getChild("enabled")->getType());
+        ASSERT_EQ(4u, node->getOutputs()->getChildCount());
+        EXPECT_EQ("y", node->getOutputs()->getChild(0)->getName());
+        EXPECT_EQ(EPropertyType::Int32, node->getOutputs()->getChild("count")->getType());
+
+        EXPECT_EQ(node, *m_logicEngine.expressionNodes().begin());
+        EXPECT_EQ(node, m_logicEngine.findExpressionNode("blend"));
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, ComputesOutputsFromInputs)
+    {
+        ExpressionNode* node = CreateBlendNode(m_logicEngine);
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("a")->set<float>(2.f));
+        EXPECT_TRUE(node->getInputs()->getChild("b")->set<float>(1.f));
+        EXPECT_TRUE(node->getInputs()->getChild("direction")->set<vec3f>({ 1.f, 0.f, -1.f }));
+        EXPECT_TRUE(node->getInputs()->getChild("enabled")->set<bool>(true));
+        EXPECT_TRUE(node->getInputs()->getChild("count")->set<int32_t>(21));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(2.f, *node->getOutputs()->getChild("y")->get<float>());
+        EXPECT_THAT(*node->getOutputs()->getChild("position")->get<vec3f>(), ElementsAre(2.f, 0.f, -2.f));
+        EXPECT_TRUE(*node->getOutputs()->getChild("visible")->get<bool>());
+        EXPECT_EQ(42, *node->getOutputs()->getChild("count")->get<int32_t>());
+
+        EXPECT_TRUE(node->getInputs()->getChild("enabled")->set<bool>(false));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(*node->getOutputs()->getChild("visible")->get<bool>());
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, CanBeLinkedToScripts)
+    {
+        LuaScript* producer = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = 4
+            end
+        )");
+        ExpressionNode* node = m_logicEngine.createExpressionNode("OUT.root = sqrt(IN.value)", { {"value", EPropertyType::Float} }, { {"root", EPropertyType::Float} });
+        LuaScript* consumer = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value * 10
+            end
+        )");
+        ASSERT_NE(nullptr, producer);
+        ASSERT_NE(nullptr, node);
+        ASSERT_NE(nullptr, consumer);
+        ASSERT_TRUE(m_logicEngine.link(*producer->getOutputs()->getChild("value"), *node->getInputs()->getChild("value")));
+        ASSERT_TRUE(m_logicEngine.link(*node->getOutputs()->getChild("root"), *consumer->getInputs()->getChild("value")));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(20.f, *consumer->getOutputs()->getChild("value")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, ReportsCompilationErrors)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createExpressionNode("OUT.y = IN.x", { {"a", EPropertyType::Float} }, { {"y", EPropertyType::Float} }, "expression"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't create expression node 'expression': line 1, column 12: unknown input 'x'!", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_EQ(nullptr, m_logicEngine.createExpressionNode("OUT.y = 1.0", {}, { {"y", EPropertyType::Vec2i} }, "expression"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't create expression node 'expression': output 'y' has an unsupported type (only Float, Vec2f, Vec3f, Vec4f, Int32 and Bool are supported)!",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(m_logicEngine.expressionNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, ReportsRuntimeErrors)
+    {
+        ExpressionNode* node = m_logicEngine.createExpressionNode("OUT.y = 10 % IN.divisor", { {"divisor", EPropertyType::Int32} }, { {"y", EPropertyType::Int32} }, "expression");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't evaluate expression node 'expression': integer modulo by zero!", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(node, m_logicEngine.getErrors()[0].node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("divisor")->set<int32_t>(4));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2, *node->getOutputs()->getChild("y")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, CanBeDestroyed)
+    {
+        ExpressionNode* node = m_logicEngine.createExpressionNode("OUT.y = 1.0", {}, { {"y", EPropertyType::Float} });
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(m_logicEngine.destroy(*node));
+        EXPECT_TRUE(m_logicEngine.expressionNodes().empty());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_ExpressionNode, SavesAndLoadsSourceAndPropertyValues)
+    {
+        WithTempDirectory tempDirectory;
+
+        {
+            LogicEngine logicEngine;
+            ExpressionNode* node = CreateBlendNode(logicEngine);
+            ASSERT_NE(nullptr, node);
+            EXPECT_TRUE(node->getInputs()->getChild("a")->set<float>(4.f));
+            EXPECT_TRUE(node->getInputs()->getChild("direction")->set<vec3f>({ 0.f, 1.f, 0.f }));
+            ASSERT_TRUE(logicEngine.update());
+            ASSERT_TRUE(logicEngine.saveToFile("expression.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("expression.rlogic"));
+        ExpressionNode* node = m_logicEngine.findExpressionNode("blend");
+        ASSERT_NE(nullptr, node);
+        EXPECT_NE(std::string_view::npos, node->getSource().find("OUT.count = IN.count * 2"));
+        EXPECT_FLOAT_EQ(4.f, *node->getInputs()->getChild("a")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *node->getOutputs()->getChild("y")->get<float>());
+
+        EXPECT_TRUE(node->getInputs()->getChild("b")->set<float>(1.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.f, *node->getOutputs()->getChild("y")->get<float>());
+        EXPECT_THAT(*node->getOutputs()->getChild("position")->get<vec3f>(), ElementsAre(0.f, 4.f, 0.f));
+    }
+}
@@ -0,0 +1,287 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/InputChannel.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using ::testing::ElementsAre;
+
+namespace rlogic
+{
+    // Writes values with the protocol which other processes use to write into an input channel
+    class InputChannelWriter
+    {
+    public:
+        explicit InputChannelWriter(void* memory)
+            : m_words(static_cast<std::atomic<uint32_t>*>(memory))
+        {
+        }
+
+        void beginWrite()
+        {
+            m_words[0].store(m_words[0].load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+
+        template <typename T>
+        void write(size_t offset, T value)
+        {
+            static_assert(sizeof(T) == sizeof(uint32_t));
+            uint32_t word = 0u;
+            std::memcpy(&word, &value, sizeof(uint32_t));
+            // Release, so that the odd sequence counter is visible before the value
+            m_words[offset / sizeof(uint32_t)].store(word, std::memory_order_release);
+        }
+
+        void endWrite()
+        {
+            m_words[0].store(m_words[0].load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<uint32_t>* m_words = nullptr;
+    };
+
+    class ALogicEngine_InputChannel : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_InputChannel()
+            : m_script(*m_logicEngine.createLuaScriptFromSource(R"(
+                function interface()
+                    IN.speed = FLOAT
+                    IN.gear = INT
+                    IN.warning = BOOL
+                    IN.position = VEC2F
+                    IN.name = STRING
+                    OUT.speed = FLOAT
+                end
+
+                function run()
+                    OUT.speed = IN.speed
+                end
+            )", "Script"))
+            , m_writer(m_memory.data())
+        {
+            m_layout = {
+                { 4u, input("speed") },
+                { 8u, input("gear") },
+                { 12u, input("warning") },
+                { 16u, input("position") }
+            };
+        }
+
+        Property* input(std::string_view name)
+        {
+            return m_script.getInputs()->getChild(name);
+        }
+
+        void writeAllValues(float speed)
+        {
+            m_writer.beginWrite();
+            m_writer.write<float>(4u, speed);
+            m_writer.write<int32_t>(8u, -2);
+            m_writer.write<uint32_t>(12u, 1u);
+            m_writer.write<float>(16u, 0.5f);
+            m_writer.write<float>(20u, 1.5f);
+            m_writer.endWrite();
+        }
+
+        LuaScript& m_script;
+        std::array<std::atomic<uint32_t>, 8> m_memory{};
+        InputChannelWriter m_writer;
+        InputChannelLayout m_layout;
+    };
+
+    TEST_F(ALogicEngine_InputChannel, AppliesValuesOnUpdate)
+    {
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        writeAllValues(42.f);
+
+        // Not applied before update
+        EXPECT_FLOAT_EQ(0.f, *input("speed")->get<float>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(42.f, *input("speed")->get<float>());
+        EXPECT_EQ(-2, *input("gear")->get<int32_t>());
+        EXPECT_TRUE(*input("warning")->get<bool>());
+        EXPECT_THAT(*input("position")->get<vec2f>(), ElementsAre(0.5f, 1.5f));
+        EXPECT_FLOAT_EQ(42.f, *m_script.getOutputs()->getChild("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_InputChannel, AppliesValuesOnlyWhenSequenceCounterChanged)
+    {
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        writeAllValues(1.f);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        // Value which was set explicitly is not overwritten while the channel has no new values
+        EXPECT_TRUE(input("speed")->set<float>(5.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(5.f, *input("speed")->get<float>());
+
+        writeAllValues(2.f);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.f, *input("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_InputChannel, DoesNotApplyValuesOfIncompleteWrite)
+    {
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        writeAllValues(1.f);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_writer.beginWrite();
+        m_writer.write<float>(4u, 2.f);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *input("speed")->get<float>());
+
+        m_writer.endWrite();
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.f, *input("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_InputChannel, StopsApplyingValuesWhenDetached)
+    {
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        writeAllValues(1.f);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.detachInputChannel(m_memory.data()));
+        writeAllValues(2.f);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *input("speed")->get<float>());
+
+        EXPECT_FALSE(m_logicEngine.detachInputChannel(m_memory.data()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't detach input channel: the memory block is not attached", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_InputChannel, RemovesPropertiesOfDestroyedNodesFromLayout)
+    {
+        LuaScript* otherScript = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.value = FLOAT
+            end
+            function run()
+            end
+        )");
+        ASSERT_NE(nullptr, otherScript);
+        m_layout.push_back({ 24u, otherScript->getInputs()->getChild("value") });
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+
+        EXPECT_TRUE(m_logicEngine.destroy(*otherScript));
+        writeAllValues(3.f);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.f, *input("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_InputChannel, ProducesErrorsForInvalidLayouts)
+    {
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(nullptr, 0u, m_layout));
+        EXPECT_EQ("Can't attach input channel: the memory block must at least contain the sequence counter (4 bytes)", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 0u, input("speed") } }));
+        EXPECT_EQ("Can't attach input channel: value of property 'speed' at offset 0 overlaps the sequence counter or exceeds the memory block of 32 bytes",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 28u, input("position") } }));
+        EXPECT_EQ("Can't attach input channel: value of property 'position' at offset 28 overlaps the sequence counter or exceeds the memory block of 32 bytes",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 6u, input("speed") } }));
+        EXPECT_EQ("Can't attach input channel: offset 6 of property 'speed' is not aligned to 4 bytes", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 4u, input("name") } }));
+        EXPECT_EQ("Can't attach input channel: property 'name' has unsupported type 'STRING' (only numbers, booleans and numeric vectors are supported)",
+            m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 4u, m_script.getOutputs()->getChild("speed") } }));
+        EXPECT_EQ("Can't attach input channel: field at offset 4 doesn't refer to an input property", m_logicEngine.getErrors()[0].message);
+
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        EXPECT_FALSE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), m_layout));
+        EXPECT_EQ("Can't attach input channel: the memory block is already attached", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_InputChannel, NeverAppliesValuesOfIncompleteWritesFromOtherThread)
+    {
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(m_memory.data(), sizeof(m_memory), { { 16u, input("position") } }));
+
+        // Writer keeps both components equal, the engine must never see different values
+        std::atomic<bool> writerFinished = false;
+        std::thread writer([this, &writerFinished]() {
+            for (int i = 1; i <= 20000; ++i)
+            {
+                m_writer.beginWrite();
+                m_writer.write<float>(16u, static_cast<float>(i));
+                m_writer.write<float>(20u, static_cast<float>(i));
+                m_writer.endWrite();
+            }
+            writerFinished = true;
+        });
+
+        while (!writerFinished)
+        {
+            ASSERT_TRUE(m_logicEngine.update());
+            const vec2f position = *input("position")->get<vec2f>();
+            EXPECT_EQ(position[0], position[1]);
+        }
+        writer.join();
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*input("position")->get<vec2f>(), ElementsAre(20000.f, 20000.f));
+    }
+
+#ifndef _WIN32
+    // Stand-in for shared memory between processes: the writer and the engine use separate mappings of the same file
+    TEST_F(ALogicEngine_InputChannel, ReadsValuesFromFileBackedMemory)
+    {
+        WithTempDirectory tempDirectory;
+
+        constexpr size_t blockSize = 32u;
+        const int fileDescriptor = ::open("input_channel.bin", O_RDWR | O_CREAT, 0600);
+        ASSERT_NE(-1, fileDescriptor);
+        ASSERT_EQ(0, ::ftruncate(fileDescriptor, blockSize));
+        void* writerMapping = ::mmap(nullptr, blockSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        void* readerMapping = ::mmap(nullptr, blockSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        ::close(fileDescriptor);
+        ASSERT_NE(MAP_FAILED, writerMapping);
+        ASSERT_NE(MAP_FAILED, readerMapping);
+
+        ASSERT_TRUE(m_logicEngine.attachInputChannel(readerMapping, blockSize, m_layout));
+        InputChannelWriter writer(writerMapping);
+        writer.beginWrite();
+        writer.write<float>(4u, 88.f);
+        writer.write<int32_t>(8u, 3);
+        writer.endWrite();
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(88.f, *input("speed")->get<float>());
+        EXPECT_EQ(3, *input("gear")->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.detachInputChannel(readerMapping));
+        ::munmap(readerMapping, blockSize);
+        ::munmap(writerMapping, blockSize);
+    }
+#endif
+}
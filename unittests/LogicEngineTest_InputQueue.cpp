@@ -0,0 +1,196 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/PropertyImpl.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace rlogic
+{
+    class ALogicEngine_InputQueue : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_InputQueue()
+            : m_script(*m_logicEngine.createLuaScriptFromSource(m_scriptSource, "Script"))
+        {
+        }
+
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.a = INT
+                IN.b = INT
+                IN.c = INT
+                IN.d = INT
+                IN.name = STRING
+                OUT.sum = INT
+                OUT.name = STRING
+            end
+
+            function run()
+                OUT.sum = IN.a + IN.b + IN.c + IN.d
+                OUT.name = IN.name
+            end
+        )";
+
+        Property& input(std::string_view name)
+        {
+            return *m_script.getInputs()->getChild(name);
+        }
+
+        int32_t sum() const
+        {
+            return *m_script.getOutputs()->getChild("sum")->get<int32_t>();
+        }
+
+        LuaScript& m_script;
+    };
+
+    TEST_F(ALogicEngine_InputQueue, AppliesQueuedValuesOnUpdate)
+    {
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 5));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<std::string>(input("name"), "queued"));
+
+        // Not applied before update
+        EXPECT_EQ(0, *input("a").get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, *input("a").get<int32_t>());
+        EXPECT_EQ(5, sum());
+        EXPECT_EQ("queued", *m_script.getOutputs()->getChild("name")->get<std::string>());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, LastQueuedValueWins)
+    {
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 1));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("b"), 2));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 3));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *input("a").get<int32_t>());
+        EXPECT_EQ(5, sum());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, SetsPropertyOnlyOnceWhenSeveralValuesAreQueued)
+    {
+        const uint64_t versionBeforeUpdate = input("a").m_impl->getChangeVersion();
+        for (int32_t value = 1; value <= 10; ++value)
+        {
+            EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), value));
+        }
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(10, *input("a").get<int32_t>());
+        EXPECT_EQ(versionBeforeUpdate + 1u, input("a").m_impl->getChangeVersion());
+
+        // Properties are not coalesced across updates
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 11));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(11, *input("a").get<int32_t>());
+        EXPECT_EQ(versionBeforeUpdate + 2u, input("a").m_impl->getChangeVersion());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, RejectsOutputsAndMismatchingTypes)
+    {
+        EXPECT_FALSE(m_logicEngine.enqueueInputValue<float>(input("a"), 1.f));
+        EXPECT_FALSE(m_logicEngine.enqueueInputValue<int32_t>(*m_script.getOutputs()->getChild("sum"), 1));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0, sum());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, RejectsValuesWhenQueueIsFull)
+    {
+        m_logicEngine.setInputQueueCapacity(2u);
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 1));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("b"), 2));
+        EXPECT_FALSE(m_logicEngine.enqueueInputValue<int32_t>(input("c"), 3));
+
+        // Update empties the queue
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, sum());
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("c"), 3));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(6, sum());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, DropsValuesOfInputsWhichWereLinkedAfterQueuing)
+    {
+        LuaScript* sourceScript = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "SourceScript");
+        ASSERT_NE(nullptr, sourceScript);
+
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 42));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("b"), 1));
+        ASSERT_TRUE(m_logicEngine.link(*sourceScript->getOutputs()->getChild("sum"), input("a")));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0, *input("a").get<int32_t>());
+        EXPECT_EQ(1, sum());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, DiscardsQueuedValuesWhenNodeIsDestroyed)
+    {
+        LuaScript* otherScript = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(*otherScript->getInputs()->getChild("a"), 1));
+        EXPECT_TRUE(m_logicEngine.enqueueInputValue<int32_t>(input("a"), 1));
+        EXPECT_TRUE(m_logicEngine.destroy(*otherScript));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0, sum());
+    }
+
+    TEST_F(ALogicEngine_InputQueue, AcceptsValuesFromSeveralThreadsWhileUpdating)
+    {
+        constexpr int32_t valuesPerThread = 5000;
+        const std::array<const char*, 4> inputNames = { "a", "b", "c", "d" };
+        std::atomic<size_t> finishedThreads = 0u;
+
+        std::vector<std::thread> producers;
+        for (const char* inputName : inputNames)
+        {
+            Property& targetInput = input(inputName);
+            producers.emplace_back([this, &targetInput, &finishedThreads]() {
+                for (int32_t value = 1; value <= valuesPerThread;)
+                {
+                    // Retry until the update thread made room in the queue
+                    if (m_logicEngine.enqueueInputValue<int32_t>(targetInput, value))
+                    {
+                        ++value;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                ++finishedThreads;
+            });
+        }
+
+        while (finishedThreads < producers.size())
+        {
+            EXPECT_TRUE(m_logicEngine.update());
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(4 * valuesPerThread, sum());
+    }
+}
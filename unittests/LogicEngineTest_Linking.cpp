@@ -327,7 +327,7 @@ namespace rlogic
         EXPECT_EQ("Script1Script2Script3", script3Output->get<std::string>());
     }
 
-    TEST_F(ALogicEngine_Linking, ProducesErrorOnLinkingStructs)
+    TEST_F(ALogicEngine_Linking, LinksStructsButProducesErrorOnLinkingRootProperties)
     {
         const auto  luaScriptSource = R"(
             function interface()
@@ -355,23 +355,20 @@ namespace rlogic
         auto structTarget = inputs->getChild("structTarget");
         auto structSource = outputs->getChild("structSource");
 
-        EXPECT_FALSE(m_logicEngine.link(*structSource, *structTarget));
-        auto errors = m_logicEngine.getErrors();
-        ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Can't link properties of complex types directly, currently only primitive properties can be linked", errors[0].message);
+        EXPECT_TRUE(m_logicEngine.link(*structSource, *structTarget));
 
         EXPECT_FALSE(m_logicEngine.link(*outputs, *inputs));
-        errors = m_logicEngine.getErrors();
+        const auto& errors = m_logicEngine.getErrors();
         ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Can't link properties of complex types directly, currently only primitive properties can be linked", errors[0].message);
+        EXPECT_EQ("Can't link the root inputs or outputs of a LogicNode, link their children instead", errors[0].message);
     }
 
-    TEST_F(ALogicEngine_Linking, ProducesErrorOnLinkingArrays)
+    TEST_F(ALogicEngine_Linking, ProducesErrorOnLinkingArraysOfDifferentSize)
     {
         const auto  luaScriptSource = R"(
             function interface()
                 IN.array = ARRAY(2, INT)
-                OUT.array = ARRAY(2, INT)
+                OUT.array = ARRAY(3, INT)
             end
             function run()
             end
@@ -386,7 +383,7 @@ namespace rlogic
         EXPECT_FALSE(m_logicEngine.link(*arraySource, *arrayTarget));
         auto errors = m_logicEngine.getErrors();
         ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Can't link properties of complex types directly, currently only primitive properties can be linked", errors[0].message);
+        EXPECT_EQ("Can't link property 'array' to property 'array', structs and arrays can only be linked if their children have the same names and types", errors[0].message);
     }
 
     TEST_F(ALogicEngine_Linking, ProducesErrorIfNotLinkedPropertyIsUnlinked_WhenAnotherLinkFromTheSameScriptExists)
@@ -1229,6 +1226,46 @@ namespace rlogic
         EXPECT_FALSE(*nodeVisibility->get<bool>());
     }
 
+    TEST_F(ALogicEngine_Linking, PropagatesValueOnlyWhenSourceOutputWasWritten)
+    {
+        RamsesNodeBinding& nodeBinding = *m_logicEngine.createRamsesNodeBinding(*m_node, "");
+        auto* script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.translation = VEC3F
+                OUT.translation = VEC3F
+            end
+            function run()
+                OUT.translation = IN.translation
+            end
+            )");
+
+        const internal::PropertyImpl& scriptOutput = *script->getOutputs()->getChild("translation")->m_impl;
+        ASSERT_TRUE(m_logicEngine.link(*script->getOutputs()->getChild("translation"), *nodeBinding.getInputs()->getChild("translation")));
+        const internal::PropertyLink& link = m_logicEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().begin()->second;
+        EXPECT_EQ(internal::NotPropagatedVersion, link.propagatedVersion);
+
+        EXPECT_TRUE(script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        std::array<float, 3> translation = { 0.0f, 0.0f, 0.0f };
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_THAT(translation, ::testing::ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_EQ(scriptOutput.getChangeVersion(), link.propagatedVersion);
+
+        // Script did not run, its output keeps its version -> link is skipped and doesn't re-apply the value to ramses
+        m_node->setTranslation(10.f, 20.f, 30.f);
+        const uint64_t propagatedVersion = link.propagatedVersion;
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(propagatedVersion, link.propagatedVersion);
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_THAT(translation, ::testing::ElementsAre(10.f, 20.f, 30.f));
+
+        EXPECT_TRUE(script->getInputs()->getChild("translation")->set<vec3f>({ 4.f, 5.f, 6.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_LT(propagatedVersion, link.propagatedVersion);
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_THAT(translation, ::testing::ElementsAre(4.f, 5.f, 6.f));
+    }
+
     class ALogicEngine_Linking_WithFiles : public ALogicEngine_Linking
     {
     protected:
@@ -0,0 +1,206 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/Property.h"
+
+#include <limits>
+
+namespace rlogic
+{
+    class ALogicEngine_LuaMemory : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_allocatingScript = R"(
+            function interface()
+                IN.count = INT
+                OUT.count = INT
+            end
+            function run()
+                local data = {}
+                for i = 1, IN.count do
+                    data[i] = "entry " .. tostring(i)
+                end
+                OUT.count = #data
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_LuaMemory, ReportsMemoryUsedByScripts)
+    {
+        const LuaMemoryStatistics initialStats = m_logicEngine.getLuaMemoryStatistics();
+        EXPECT_GT(initialStats.currentBytes, 0u);
+        EXPECT_GT(initialStats.liveAllocations, 0u);
+        EXPECT_EQ(0u, initialStats.memoryLimit);
+
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_allocatingScript);
+        ASSERT_NE(nullptr, script);
+        EXPECT_GT(m_logicEngine.getLuaMemoryStatistics().currentBytes, initialStats.currentBytes);
+
+        script->getInputs()->getChild("count")->set<int32_t>(1000);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        const LuaMemoryStatistics stats = m_logicEngine.getLuaMemoryStatistics();
+        EXPECT_GT(stats.peakBytes, initialStats.peakBytes);
+        EXPECT_GT(stats.totalAllocations, initialStats.totalAllocations + 1000u);
+        EXPECT_LE(stats.currentBytes, stats.peakBytes);
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, ProducesScriptErrorWhenExceedingMemoryLimit)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_allocatingScript);
+        ASSERT_NE(nullptr, script);
+
+        m_logicEngine.setLuaMemoryLimit(m_logicEngine.getLuaMemoryStatistics().currentBytes + 16u * 1024u);
+        script->getInputs()->getChild("count")->set<int32_t>(100000);
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("not enough memory"));
+        EXPECT_EQ(script, m_logicEngine.getErrors()[0].node);
+        EXPECT_GT(m_logicEngine.getLuaMemoryStatistics().failedAllocations, 0u);
+
+        // Scripts within the limit can still be executed
+        script->getInputs()->getChild("count")->set<int32_t>(10);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(10, *script->getOutputs()->getChild("count")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, ExecutesScriptAgainAfterRemovingMemoryLimit)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_allocatingScript);
+        ASSERT_NE(nullptr, script);
+
+        m_logicEngine.setLuaMemoryLimit(m_logicEngine.getLuaMemoryStatistics().currentBytes);
+        script->getInputs()->getChild("count")->set<int32_t>(1000);
+        EXPECT_FALSE(m_logicEngine.update());
+
+        m_logicEngine.setLuaMemoryLimit(0u);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1000, *script->getOutputs()->getChild("count")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, ProducesErrorWhenCreatingScriptWithMemoryLimitAlreadyExceeded)
+    {
+        m_logicEngine.setLuaMemoryLimit(1u);
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScriptFromSource(m_valid_empty_script));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("not enough memory"));
+
+        m_logicEngine.setLuaMemoryLimit(0u);
+        EXPECT_NE(nullptr, m_logicEngine.createLuaScriptFromSource(m_valid_empty_script));
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, KeepsMemoryLimitAfterLoading)
+    {
+        m_logicEngine.createLuaScriptFromSource(m_allocatingScript, "script");
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+
+        m_logicEngine.setLuaMemoryLimit(1024u * 1024u);
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        EXPECT_EQ(1024u * 1024u, m_logicEngine.getLuaMemoryStatistics().memoryLimit);
+
+        m_logicEngine.findScript("script")->getInputs()->getChild("count")->set<int32_t>(1000000);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("not enough memory"));
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, DoesNotCollectGarbage_WhenCollectionInUpdateIsDisabled)
+    {
+        m_logicEngine.setGarbageCollectionStep(0u);
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_allocatingScript);
+        ASSERT_NE(nullptr, script);
+
+        size_t previousBytes = m_logicEngine.getLuaMemoryStatistics().currentBytes;
+        for (int32_t i = 1; i <= 5; ++i)
+        {
+            // The table of each run becomes garbage after the run
+            script->getInputs()->getChild("count")->set<int32_t>(1000 + i);
+            ASSERT_TRUE(m_logicEngine.update());
+            const size_t currentBytes = m_logicEngine.getLuaMemoryStatistics().currentBytes;
+            EXPECT_GT(currentBytes, previousBytes);
+            previousBytes = currentBytes;
+        }
+        EXPECT_EQ(0u, m_logicEngine.getLuaMemoryStatistics().completedCollectionCycles);
+
+        // Finish the cycle which collects the garbage of all runs
+        while (!m_logicEngine.collectGarbage(std::numeric_limits<size_t>::max()))
+        {
+        }
+
+        const LuaMemoryStatistics stats = m_logicEngine.getLuaMemoryStatistics();
+        EXPECT_LT(stats.currentBytes, previousBytes);
+        EXPECT_EQ(1u, stats.completedCollectionCycles);
+        EXPECT_GE(stats.totalCollectionDuration, stats.lastCollectionStepDuration);
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, DoesNotCollectGarbageDuringScriptExecution_AfterCollectionStepsInUpdate)
+    {
+        // Finishes a collection cycle in every update
+        m_logicEngine.setGarbageCollectionStep(std::numeric_limits<size_t>::max());
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.count = INT
+                OUT.collectedDuringRun = BOOL
+            end
+            function run()
+                local collected = false
+                local previousKB = collectgarbage("count")
+                for i = 1, IN.count do
+                    -- Becomes garbage immediately, the heap only shrinks if it is collected
+                    local garbage = { i }
+                    local currentKB = collectgarbage("count")
+                    if currentKB < previousKB then
+                        collected = true
+                    end
+                    previousKB = currentKB
+                end
+                OUT.collectedDuringRun = collected
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        for (int32_t i = 1; i <= 5; ++i)
+        {
+            script->getInputs()->getChild("count")->set<int32_t>(10000 + i);
+            ASSERT_TRUE(m_logicEngine.update());
+            EXPECT_FALSE(*script->getOutputs()->getChild("collectedDuringRun")->get<bool>());
+            EXPECT_EQ(static_cast<size_t>(i), m_logicEngine.getLuaMemoryStatistics().completedCollectionCycles);
+        }
+    }
+
+    TEST_F(ALogicEngine_LuaMemory, CollectsGarbageIncrementallyInUpdate)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_allocatingScript);
+        ASSERT_NE(nullptr, script);
+
+        size_t peakBytesAfterFirstCycle = 0u;
+        for (int32_t i = 1; i <= 1000 && peakBytesAfterFirstCycle == 0u; ++i)
+        {
+            script->getInputs()->getChild("count")->set<int32_t>(100 + i % 2);
+            ASSERT_TRUE(m_logicEngine.update());
+            if (m_logicEngine.getLuaMemoryStatistics().completedCollectionCycles > 0u)
+            {
+                peakBytesAfterFirstCycle = m_logicEngine.getLuaMemoryStatistics().peakBytes;
+            }
+        }
+        ASSERT_GT(peakBytesAfterFirstCycle, 0u);
+
+        // The heap doesn't keep growing, the garbage of each run is collected
+        for (int32_t i = 0; i < 1000; ++i)
+        {
+            script->getInputs()->getChild("count")->set<int32_t>(100 + i % 2);
+            ASSERT_TRUE(m_logicEngine.update());
+        }
+        EXPECT_LT(m_logicEngine.getLuaMemoryStatistics().peakBytes, 3u * peakBytesAfterFirstCycle);
+        EXPECT_GT(m_logicEngine.getLuaMemoryStatistics().completedCollectionCycles, 1u);
+    }
+}
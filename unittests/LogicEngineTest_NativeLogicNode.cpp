@@ -0,0 +1,295 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/NativeLogicNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "fmt/format.h"
+
+using ::testing::HasSubstr;
+
+namespace rlogic
+{
+    class ALogicEngine_NativeLogicNode : public ALogicEngine
+    {
+    protected:
+        // Computes OUT.sum = IN.a + IN.b and OUT.result.scaled = IN.a * IN.settings.factor
+        NativeLogicNodeType createSumType()
+        {
+            NativeLogicNodeType type;
+            type.inputs = {
+                {"a", EPropertyType::Float, {}},
+                {"b", EPropertyType::Float, {}},
+                {"settings", EPropertyType::Struct, {{"factor", EPropertyType::Float, {}}}},
+            };
+            type.outputs = {
+                {"sum", EPropertyType::Float, {}},
+                {"result", EPropertyType::Struct, {{"scaled", EPropertyType::Float, {}}}},
+            };
+            type.update = [this](const Property& inputs, Property& outputs) -> std::optional<std::string>
+            {
+                ++m_updateCount;
+                const float a = *inputs.getChild(0)->get<float>();
+                const float b = *inputs.getChild(1)->get<float>();
+                const float factor = *inputs.getChild(2)->getChild(0)->get<float>();
+                outputs.getChild(0)->set<float>(a + b);
+                outputs.getChild(1)->getChild(0)->set<float>(a * factor);
+                return std::nullopt;
+            };
+            return type;
+        }
+
+        size_t m_updateCount = 0u;
+    };
+
+    TEST_F(ALogicEngine_NativeLogicNode, CreatesNodeFromRegisteredType)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum", "sumNode");
+        ASSERT_NE(nullptr, node);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ("sumNode", node->getName());
+        EXPECT_EQ("Sum", node->getTypeName());
+        ASSERT_EQ(3u, node->getInputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Struct, node->getInputs()->getChild("settings")->getType());
+        EXPECT_EQ(EPropertyType::Float, node->getInputs()->getChild("settings")->getChild("factor")->getType());
+        ASSERT_EQ(2u, node->getOutputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, node->getOutputs()->getChild("sum")->getType());
+
+        EXPECT_EQ(node, *m_logicEngine.nativeLogicNodes().begin());
+        EXPECT_EQ(node, m_logicEngine.findNativeLogicNode("sumNode"));
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, FailsToCreateNodeOfUnknownType)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createNativeLogicNode("Unknown", "node"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't create native logic node 'node': type 'Unknown' is not registered!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, FailsToRegisterTypeTwice)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        EXPECT_FALSE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't register native logic node type 'Sum': a type with this name is already registered!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, FailsToRegisterInvalidTypes)
+    {
+        struct InvalidType
+        {
+            NativeLogicNodeType type;
+            std::string expectedError;
+        };
+
+        const NativeUpdateFunction noop = [](const Property& /*inputs*/, Property& /*outputs*/) { return std::nullopt; };
+
+        const std::vector<InvalidType> invalidTypes = {
+            {{{}, {}, {}}, "missing update function"},
+            {{{{"", EPropertyType::Float, {}}}, {}, noop}, "invalid inputs: properties must have a name"},
+            {{{}, {{"x", EPropertyType::Int32, {}}, {"x", EPropertyType::Float, {}}}, noop}, "invalid outputs: property 'x' is declared more than once"},
+            {{{{"x", EPropertyType::Array, {}}}, {}, noop}, "invalid inputs: property 'x' has an unsupported type (only primitive types and structs are supported)"},
+            {{{{"x", EPropertyType::Float, {{"y", EPropertyType::Float, {}}}}}, {}, noop}, "invalid inputs: property 'x' has children but is not a struct"},
+            {{{}, {{"s", EPropertyType::Struct, {{"y", EPropertyType::Array, {}}}}}, noop}, "invalid outputs: property 'y' has an unsupported type (only primitive types and structs are supported)"},
+        };
+
+        for (const auto& invalidType : invalidTypes)
+        {
+            EXPECT_FALSE(m_logicEngine.registerNativeLogicNodeType("Invalid", invalidType.type));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_EQ(fmt::format("Can't register native logic node type 'Invalid': {}!", invalidType.expectedError), m_logicEngine.getErrors()[0].message);
+        }
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, ComputesOutputsOnUpdate)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("a")->set<float>(2.f));
+        EXPECT_TRUE(node->getInputs()->getChild("b")->set<float>(3.f));
+        EXPECT_TRUE(node->getInputs()->getChild("settings")->getChild("factor")->set<float>(10.f));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(5.f, *node->getOutputs()->getChild("sum")->get<float>());
+        EXPECT_FLOAT_EQ(20.f, *node->getOutputs()->getChild("result")->getChild("scaled")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, DoesNotAllowSettingOutputsOutsideOfUpdate)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_FALSE(node->getOutputs()->getChild("sum")->set<float>(1.f));
+        EXPECT_FLOAT_EQ(0.f, *node->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, IsOnlyUpdatedWhenInputsChange)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum");
+        ASSERT_NE(nullptr, node);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_updateCount);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_updateCount);
+
+        EXPECT_TRUE(node->getInputs()->getChild("a")->set<float>(1.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_updateCount);
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, CanBeLinkedWithScripts)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum");
+        ASSERT_NE(nullptr, node);
+
+        LuaScript* producer = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value * 2
+            end
+        )");
+        LuaScript* consumer = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value + 1
+            end
+        )");
+        ASSERT_NE(nullptr, producer);
+        ASSERT_NE(nullptr, consumer);
+
+        ASSERT_TRUE(m_logicEngine.link(*producer->getOutputs()->getChild("value"), *node->getInputs()->getChild("a")));
+        ASSERT_TRUE(m_logicEngine.link(*node->getOutputs()->getChild("sum"), *consumer->getInputs()->getChild("value")));
+
+        EXPECT_TRUE(producer->getInputs()->getChild("value")->set<float>(4.f));
+        EXPECT_TRUE(node->getInputs()->getChild("b")->set<float>(1.f));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(10.f, *consumer->getOutputs()->getChild("value")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, ReportsErrorsReturnedByUpdateFunction)
+    {
+        NativeLogicNodeType type;
+        type.inputs = {{"value", EPropertyType::Int32, {}}};
+        type.update = [](const Property& inputs, Property& /*outputs*/) -> std::optional<std::string>
+        {
+            if (*inputs.getChild(0)->get<int32_t>() < 0)
+            {
+                return "value must not be negative";
+            }
+            return std::nullopt;
+        };
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Checker", std::move(type)));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Checker", "checker");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(node->getInputs()->getChild("value")->set<int32_t>(-1));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("value must not be negative", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(node, m_logicEngine.getErrors()[0].node);
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNode, CanBeDestroyed)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        NativeLogicNode* node = m_logicEngine.createNativeLogicNode("Sum");
+        ASSERT_NE(nullptr, node);
+
+        EXPECT_TRUE(m_logicEngine.destroy(*node));
+        EXPECT_TRUE(m_logicEngine.nativeLogicNodes().empty());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0u, m_updateCount);
+    }
+
+    class ALogicEngine_NativeLogicNodeSerialization : public ALogicEngine_NativeLogicNode
+    {
+    protected:
+        WithTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(ALogicEngine_NativeLogicNodeSerialization, SavesAndLoadsNodesOfRegisteredTypes)
+    {
+        {
+            LogicEngine logicEngine;
+            ASSERT_TRUE(logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+            NativeLogicNode* node = logicEngine.createNativeLogicNode("Sum", "sumNode");
+            ASSERT_NE(nullptr, node);
+            EXPECT_TRUE(node->getInputs()->getChild("a")->set<float>(2.f));
+            EXPECT_TRUE(node->getInputs()->getChild("settings")->getChild("factor")->set<float>(3.f));
+            ASSERT_TRUE(logicEngine.update());
+            ASSERT_TRUE(logicEngine.saveToFile("native.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+        ASSERT_TRUE(m_logicEngine.loadFromFile("native.rlogic"));
+
+        NativeLogicNode* node = m_logicEngine.findNativeLogicNode("sumNode");
+        ASSERT_NE(nullptr, node);
+        EXPECT_EQ("Sum", node->getTypeName());
+        EXPECT_FLOAT_EQ(2.f, *node->getInputs()->getChild("a")->get<float>());
+        EXPECT_FLOAT_EQ(6.f, *node->getOutputs()->getChild("result")->getChild("scaled")->get<float>());
+
+        EXPECT_TRUE(node->getInputs()->getChild("b")->set<float>(1.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.f, *node->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNodeSerialization, FailsToLoadNodeOfUnregisteredType)
+    {
+        {
+            LogicEngine logicEngine;
+            ASSERT_TRUE(logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+            ASSERT_NE(nullptr, logicEngine.createNativeLogicNode("Sum", "sumNode"));
+            ASSERT_TRUE(logicEngine.saveToFile("native.rlogic"));
+        }
+
+        EXPECT_FALSE(m_logicEngine.loadFromFile("native.rlogic"));
+        ASSERT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr("Can't load NativeLogicNode 'sumNode': type 'Sum' is not registered!"));
+    }
+
+    TEST_F(ALogicEngine_NativeLogicNodeSerialization, FailsToLoadNodeWhenRegisteredInterfaceChanged)
+    {
+        {
+            LogicEngine logicEngine;
+            ASSERT_TRUE(logicEngine.registerNativeLogicNodeType("Sum", createSumType()));
+            ASSERT_NE(nullptr, logicEngine.createNativeLogicNode("Sum", "sumNode"));
+            ASSERT_TRUE(logicEngine.saveToFile("native.rlogic"));
+        }
+
+        NativeLogicNodeType changedType = createSumType();
+        changedType.inputs[1].type = EPropertyType::Int32;
+        ASSERT_TRUE(m_logicEngine.registerNativeLogicNodeType("Sum", std::move(changedType)));
+
+        EXPECT_FALSE(m_logicEngine.loadFromFile("native.rlogic"));
+        ASSERT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message,
+            HasSubstr("Can't load NativeLogicNode 'sumNode': the saved interface doesn't match the registered interface of type 'Sum'!"));
+    }
+}
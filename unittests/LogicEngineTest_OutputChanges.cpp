@@ -0,0 +1,169 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace rlogic
+{
+    class ALogicEngine_OutputChanges : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_OutputChanges()
+            : m_script(*m_logicEngine.createLuaScriptFromSource(m_scriptSource, "Script"))
+        {
+        }
+
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.value = INT
+                IN.name = STRING
+                OUT.value = INT
+                OUT.constant = FLOAT
+                OUT.nested = {
+                    name = STRING,
+                    doubled = INT
+                }
+            end
+
+            function run()
+                OUT.value = IN.value
+                OUT.constant = 1.0
+                OUT.nested.name = IN.name
+                OUT.nested.doubled = IN.value * 2
+            end
+        )";
+
+        const Property* output(std::string_view name) const
+        {
+            return m_script.getOutputs()->getChild(name);
+        }
+
+        const Property* nestedOutput(std::string_view name) const
+        {
+            return m_script.getOutputs()->getChild("nested")->getChild(name);
+        }
+
+        LuaScript& m_script;
+    };
+
+    TEST_F(ALogicEngine_OutputChanges, ReportsNothingByDefault)
+    {
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(5));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), IsEmpty());
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ReportsAllChangedOutputsWhenTrackingIsEnabled)
+    {
+        m_logicEngine.setOutputChangeTracking(true);
+
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(5));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), ElementsAre(output("constant"), nestedOutput("doubled"), output("value")));
+
+        // Script is not executed -> nothing changed
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), IsEmpty());
+
+        // Script is executed, but only the string output gets a different value
+        EXPECT_TRUE(m_script.getInputs()->getChild("name")->set<std::string>("changed"));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), ElementsAre(nestedOutput("name")));
+
+        m_logicEngine.setOutputChangeTracking(false);
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(6));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), IsEmpty());
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ReportsOnlySubscribedOutputs)
+    {
+        EXPECT_TRUE(m_logicEngine.subscribeToOutputChanges(*output("value")));
+
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(5));
+        EXPECT_TRUE(m_script.getInputs()->getChild("name")->set<std::string>("name"));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), ElementsAre(output("value")));
+
+        EXPECT_TRUE(m_logicEngine.unsubscribeFromOutputChanges(*output("value")));
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(6));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), IsEmpty());
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, SubscribesAllChildrenOfStruct)
+    {
+        EXPECT_TRUE(m_logicEngine.subscribeToOutputChanges(*m_script.getOutputs()->getChild("nested")));
+
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(5));
+        EXPECT_TRUE(m_script.getInputs()->getChild("name")->set<std::string>("name"));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), ElementsAre(nestedOutput("doubled"), nestedOutput("name")));
+
+        EXPECT_TRUE(m_logicEngine.unsubscribeFromOutputChanges(*nestedOutput("name")));
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(6));
+        EXPECT_TRUE(m_script.getInputs()->getChild("name")->set<std::string>("other name"));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), ElementsAre(nestedOutput("doubled")));
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ReusesListMemoryBetweenUpdates)
+    {
+        m_logicEngine.setOutputChangeTracking(true);
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(5));
+        ASSERT_TRUE(m_logicEngine.update());
+        const std::vector<const Property*>& changedOutputs = m_logicEngine.getChangedOutputs();
+        ASSERT_EQ(3u, changedOutputs.size());
+        const size_t capacity = changedOutputs.capacity();
+
+        EXPECT_TRUE(m_script.getInputs()->getChild("value")->set<int32_t>(6));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(&changedOutputs, &m_logicEngine.getChangedOutputs());
+        EXPECT_EQ(2u, changedOutputs.size());
+        EXPECT_EQ(capacity, changedOutputs.capacity());
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ClearsListWhenNodeIsDestroyed)
+    {
+        m_logicEngine.setOutputChangeTracking(true);
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_FALSE(m_logicEngine.getChangedOutputs().empty());
+
+        EXPECT_TRUE(m_logicEngine.destroy(m_script));
+        EXPECT_THAT(m_logicEngine.getChangedOutputs(), IsEmpty());
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ProducesErrorWhenSubscribingToInputs)
+    {
+        EXPECT_FALSE(m_logicEngine.subscribeToOutputChanges(*m_script.getInputs()->getChild("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't subscribe to changes of property 'value', only outputs of logic nodes can be subscribed", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.unsubscribeFromOutputChanges(*m_script.getInputs()->getChild("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't unsubscribe from changes of property 'value', only outputs of logic nodes can be subscribed", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_OutputChanges, ProducesErrorWhenSubscribingToOutputsOfOtherLogicEngine)
+    {
+        LogicEngine otherLogicEngine;
+        LuaScript* otherScript = otherLogicEngine.createLuaScriptFromSource(m_scriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+
+        EXPECT_FALSE(m_logicEngine.subscribeToOutputChanges(*otherScript->getOutputs()->getChild("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("LogicNode 'OtherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+    }
+}
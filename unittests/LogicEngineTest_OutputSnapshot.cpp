@@ -0,0 +1,276 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/OutputSnapshot.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using ::testing::ElementsAre;
+
+namespace rlogic
+{
+    class ALogicEngine_OutputSnapshot : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_OutputSnapshot()
+            : m_script(*m_logicEngine.createLuaScriptFromSource(m_scriptSource, "Script"))
+        {
+        }
+
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.value = INT
+                IN.fail = BOOL
+                OUT.value = INT
+                OUT.nested = {
+                    doubled = INT,
+                    position = VEC2F,
+                    name = STRING
+                }
+            end
+
+            function run()
+                OUT.value = IN.value
+                OUT.nested.doubled = IN.value * 2
+                OUT.nested.position = {IN.value, IN.value}
+                OUT.nested.name = tostring(IN.value)
+                if IN.fail then
+                    error("failed")
+                end
+            end
+        )";
+
+        Property& input(std::string_view name)
+        {
+            return *m_script.getInputs()->getChild(name);
+        }
+
+        const Property& output(std::string_view name) const
+        {
+            return *m_script.getOutputs()->getChild(name);
+        }
+
+        const Property& nestedOutput(std::string_view name) const
+        {
+            return *m_script.getOutputs()->getChild("nested")->getChild(name);
+        }
+
+        LuaScript& m_script;
+        OutputSnapshot m_snapshot;
+    };
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesNothingByDefault)
+    {
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(0u, m_snapshot.getUpdateCounter());
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, CountsUpdates)
+    {
+        EXPECT_EQ(0u, m_logicEngine.getUpdateCounter());
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.getUpdateCounter());
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesSelectedOutputsAtEndOfUpdate)
+    {
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+        EXPECT_TRUE(input("value").set<int32_t>(3));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(1u, m_snapshot.getUpdateCounter());
+        EXPECT_EQ(3, *m_snapshot.get<int32_t>(output("value")));
+        EXPECT_FALSE(m_snapshot.get<int32_t>(nestedOutput("doubled")));
+        // Type doesn't match
+        EXPECT_FALSE(m_snapshot.get<float>(output("value")));
+
+        // Snapshot keeps the values of its update
+        EXPECT_TRUE(input("value").set<int32_t>(4));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *m_snapshot.get<int32_t>(output("value")));
+
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(2u, m_snapshot.getUpdateCounter());
+        EXPECT_EQ(4, *m_snapshot.get<int32_t>(output("value")));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesAllChildrenOfStruct)
+    {
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(*m_script.getOutputs()->getChild("nested")));
+        EXPECT_TRUE(input("value").set<int32_t>(5));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(10, *m_snapshot.get<int32_t>(nestedOutput("doubled")));
+        EXPECT_THAT(*m_snapshot.get<vec2f>(nestedOutput("position")), ElementsAre(5.f, 5.f));
+        EXPECT_EQ("5", *m_snapshot.get<std::string>(nestedOutput("name")));
+        EXPECT_FALSE(m_snapshot.get<int32_t>(output("value")));
+
+        EXPECT_TRUE(m_logicEngine.removeOutputFromSnapshot(nestedOutput("name")));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(10, *m_snapshot.get<int32_t>(nestedOutput("doubled")));
+        EXPECT_FALSE(m_snapshot.get<std::string>(nestedOutput("name")));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, KeepsLastSnapshotWhenUpdateFails)
+    {
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+        EXPECT_TRUE(input("value").set<int32_t>(1));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(input("value").set<int32_t>(2));
+        EXPECT_TRUE(input("fail").set<bool>(true));
+        EXPECT_FALSE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(1u, m_snapshot.getUpdateCounter());
+        EXPECT_EQ(1, *m_snapshot.get<int32_t>(output("value")));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, StopsPublishingOutputsOfDestroyedNodes)
+    {
+        LuaScript* otherScript = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(*otherScript->getOutputs()));
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+
+        EXPECT_TRUE(m_logicEngine.destroy(*otherScript));
+        EXPECT_TRUE(input("value").set<int32_t>(7));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(7, *m_snapshot.get<int32_t>(output("value")));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, InvalidatesPublishedAndReadSnapshotsWhenNodesAreDestroyed)
+    {
+        LuaScript* otherScript = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+        EXPECT_TRUE(input("value").set<int32_t>(3));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+
+        // A new property could be created at the address of a destroyed one, the old values must not be found for it
+        EXPECT_TRUE(m_logicEngine.destroy(*otherScript));
+        EXPECT_FALSE(m_snapshot.get<int32_t>(output("value")));
+        EXPECT_FALSE(m_logicEngine.readOutputSnapshot(m_snapshot));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(3, *m_snapshot.get<int32_t>(output("value")));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, InvalidatesPublishedAndReadSnapshotsWhenContentIsLoaded)
+    {
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        EXPECT_FALSE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        const LuaScript* loadedScript = m_logicEngine.findScript("Script");
+        ASSERT_NE(nullptr, loadedScript);
+        EXPECT_FALSE(m_snapshot.get<int32_t>(*loadedScript->getOutputs()->getChild("value")));
+
+        // The selected outputs are not saved
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(m_logicEngine.readOutputSnapshot(m_snapshot));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, DiscardsPublishedSnapshotsWhenBufferCountChanges)
+    {
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(output("value")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_logicEngine.setOutputSnapshotBufferCount(2u);
+        EXPECT_FALSE(m_logicEngine.readOutputSnapshot(m_snapshot));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(2u, m_snapshot.getUpdateCounter());
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, ProducesErrorWhenAddingInputsOrOutputsOfOtherLogicEngine)
+    {
+        EXPECT_FALSE(m_logicEngine.addOutputToSnapshot(input("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't add property 'value' to output snapshots, only outputs of logic nodes can be published", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.removeOutputFromSnapshot(input("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't remove property 'value' from output snapshots, only outputs of logic nodes can be published", m_logicEngine.getErrors()[0].message);
+
+        LogicEngine otherLogicEngine;
+        LuaScript* otherScript = otherLogicEngine.createLuaScriptFromSource(m_scriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_FALSE(m_logicEngine.addOutputToSnapshot(*otherScript->getOutputs()->getChild("value")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("LogicNode 'OtherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, ReadersOnOtherThreadsNeverSeePartiallyUpdatedSnapshots)
+    {
+        EXPECT_TRUE(m_logicEngine.addOutputToSnapshot(*m_script.getOutputs()));
+        // Readers don't access the properties, they only use them to look up values
+        const Property& valueOutput = output("value");
+        const Property& doubledOutput = nestedOutput("doubled");
+        const Property& nameOutput = nestedOutput("name");
+
+        std::atomic<bool> updatesFinished = false;
+        std::vector<std::thread> readers;
+        for (size_t i = 0; i < 2u; ++i)
+        {
+            readers.emplace_back([this, &updatesFinished, &valueOutput, &doubledOutput, &nameOutput]() {
+                OutputSnapshot snapshot;
+                uint64_t lastUpdateCounter = 0u;
+                while (!updatesFinished)
+                {
+                    if (!m_logicEngine.readOutputSnapshot(snapshot))
+                    {
+                        continue;
+                    }
+                    // All values of a snapshot were computed from the same input value
+                    const int32_t value = *snapshot.get<int32_t>(valueOutput);
+                    EXPECT_EQ(value * 2, *snapshot.get<int32_t>(doubledOutput));
+                    EXPECT_EQ(std::to_string(value), *snapshot.get<std::string>(nameOutput));
+                    EXPECT_LE(lastUpdateCounter, snapshot.getUpdateCounter());
+                    lastUpdateCounter = snapshot.getUpdateCounter();
+                }
+            });
+        }
+
+        for (int32_t value = 1; value <= 2000; ++value)
+        {
+            EXPECT_TRUE(input("value").set<int32_t>(value));
+            EXPECT_TRUE(m_logicEngine.update());
+        }
+        updatesFinished = true;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        // The last update could have been skipped while both readers were reading
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.readOutputSnapshot(m_snapshot));
+        EXPECT_EQ(2000, *m_snapshot.get<int32_t>(output("value")));
+    }
+}
@@ -34,6 +34,7 @@
 #include "fmt/format.h"
 
 #include <fstream>
+#include <cstring>
 
 namespace rlogic::internal
 {
@@ -371,6 +372,11 @@ namespace rlogic::internal
         EXPECT_EQ(binding2, m_logicEngine.getErrors()[0].node);
         EXPECT_EQ("Can't save a logic engine to file while it has references to more than one Ramses scene!", m_logicEngine.getErrors()[1].message);
         EXPECT_EQ(nullptr, m_logicEngine.getErrors()[1].node);
+
+        std::vector<uint8_t> buffer;
+        EXPECT_FALSE(m_logicEngine.saveToBuffer(buffer));
+        ASSERT_EQ(2u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't save a logic engine to buffer while it has references to more than one Ramses scene!", m_logicEngine.getErrors()[1].message);
     }
 
     TEST_F(ALogicEngine_Serialization, RefusesToSaveTwoCameraBindingsWhichPointToDifferentScenes)
@@ -607,5 +613,303 @@ namespace rlogic::internal
         EXPECT_TRUE(m_logicEngine.update());
         EXPECT_EQ(2u, (*internalNodeDependencies.getTopologicallySortedNodes()).size());
     }
+
+    TEST_F(ALogicEngine_Serialization, KeepsCurrentContentWhenLoadingFails)
+    {
+        auto script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        EXPECT_FALSE(m_logicEngine.loadFromFile("invalid"));
+
+        EXPECT_EQ(script, m_logicEngine.findScript("luascript"));
+        EXPECT_TRUE(script->getInputs()->getChild("param")->set<int32_t>(42));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Serialization, LoadsFromFileAsynchronouslyAndReplacesContentOnCommit)
+    {
+        SaveBufferToFile(CreateTestBuffer(), "LogicEngine.bin");
+
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param2 = FLOAT
+            end
+            function run()
+            end
+        )", "luascript2");
+
+        std::future<bool> loadResult = m_logicEngine.loadFromFileAsync("LogicEngine.bin");
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        // Current content is still usable while loading
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_NE(nullptr, m_logicEngine.findScript("luascript2"));
+
+        EXPECT_TRUE(loadResult.get());
+        EXPECT_TRUE(m_logicEngine.commitAsyncLoad());
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(nullptr, m_logicEngine.findScript("luascript2"));
+        auto script = m_logicEngine.findScript("luascript");
+        ASSERT_NE(nullptr, script);
+        EXPECT_TRUE(script->getInputs()->getChild("param")->set<int32_t>(42));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Serialization, LoadsFromBufferAsynchronously)
+    {
+        std::future<bool> loadResult;
+        {
+            const std::vector<char> bufferData = CreateTestBuffer();
+            loadResult = m_logicEngine.loadFromBufferAsync(bufferData.data(), bufferData.size());
+            // buffer is released before loading is finished
+        }
+
+        EXPECT_TRUE(loadResult.get());
+        EXPECT_TRUE(m_logicEngine.commitAsyncLoad());
+        EXPECT_NE(nullptr, m_logicEngine.findScript("luascript"));
+    }
+
+    TEST_F(ALogicEngine_Serialization, KeepsCurrentContentAndReportsErrorsWhenAsynchronousLoadFails)
+    {
+        auto script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        std::future<bool> loadResult = m_logicEngine.loadFromFileAsync("invalid");
+        EXPECT_FALSE(loadResult.get());
+
+        EXPECT_FALSE(m_logicEngine.commitAsyncLoad());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to load file 'invalid'", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_EQ(script, m_logicEngine.findScript("luascript"));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Serialization, ProducesErrorWhenCommittingWithoutAsynchronousLoad)
+    {
+        EXPECT_FALSE(m_logicEngine.commitAsyncLoad());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't commit asynchronously loaded content, no asynchronous load was started!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_Serialization, ProducesErrorWhenStartingSecondAsynchronousLoadBeforeCommit)
+    {
+        SaveBufferToFile(CreateTestBuffer(), "LogicEngine.bin");
+
+        std::future<bool> loadResult = m_logicEngine.loadFromFileAsync("LogicEngine.bin");
+        std::future<bool> secondLoadResult = m_logicEngine.loadFromFileAsync("LogicEngine.bin");
+        EXPECT_FALSE(secondLoadResult.get());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't start loading asynchronously while a previous asynchronous load was not committed yet! Call commitAsyncLoad() first!", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(loadResult.get());
+        EXPECT_TRUE(m_logicEngine.commitAsyncLoad());
+        EXPECT_NE(nullptr, m_logicEngine.findScript("luascript"));
+    }
+
+    TEST_F(ALogicEngine_Serialization, CanBeDestroyedWhileLoadingAsynchronously)
+    {
+        SaveBufferToFile(CreateTestBuffer(), "LogicEngine.bin");
+
+        LogicEngine logicEngine;
+        std::future<bool> loadResult = logicEngine.loadFromFileAsync("LogicEngine.bin");
+        // destructor of logicEngine waits for the loader thread
+    }
+
+    TEST_F(ALogicEngine_Serialization, SavesToBufferWithSameContentAsFile)
+    {
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+        m_logicEngine.createRamsesNodeBinding(*m_node, "binding");
+
+        ASSERT_TRUE(m_logicEngine.saveToFile("LogicEngine.bin"));
+        const std::vector<char> fileData = *FileUtils::LoadBinary("LogicEngine.bin");
+
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        ASSERT_EQ(fileData.size(), buffer.size());
+        EXPECT_EQ(0, std::memcmp(fileData.data(), buffer.data(), buffer.size()));
+
+        LogicEngine loadedLogicEngine;
+        EXPECT_TRUE(loadedLogicEngine.loadFromBuffer(buffer.data(), buffer.size(), m_scene));
+        EXPECT_NE(nullptr, loadedLogicEngine.findScript("luascript"));
+        EXPECT_NE(nullptr, loadedLogicEngine.findNodeBinding("binding"));
+    }
+
+    TEST_F(ALogicEngine_Serialization, SavesToCallerProvidedMemory)
+    {
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        std::vector<uint8_t> memory(m_logicEngine.estimateSerializedSize() + 1024u);
+        size_t bytesWritten = 0u;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(memory.data(), memory.size(), bytesWritten));
+        EXPECT_GT(bytesWritten, 0u);
+        EXPECT_LE(bytesWritten, memory.size());
+
+        // After saving once, the estimate is exact
+        EXPECT_EQ(bytesWritten, m_logicEngine.estimateSerializedSize());
+
+        LogicEngine loadedLogicEngine;
+        EXPECT_TRUE(loadedLogicEngine.loadFromBuffer(memory.data(), bytesWritten));
+        EXPECT_NE(nullptr, loadedLogicEngine.findScript("luascript"));
+    }
+
+    TEST_F(ALogicEngine_Serialization, ProducesErrorWhenSavingToTooSmallBuffer)
+    {
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+
+        std::vector<uint8_t> memory(10u);
+        size_t bytesWritten = 42u;
+        EXPECT_FALSE(m_logicEngine.saveToBuffer(memory.data(), memory.size(), bytesWritten));
+        EXPECT_EQ(0u, bytesWritten);
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(fmt::format("Can't save content to buffer with size 10, it requires {} bytes!", buffer.size()), m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_Serialization, ReusesBufferWhenSavingRepeatedly)
+    {
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+        const std::vector<uint8_t> firstSave = buffer;
+        const uint8_t* bufferMemory = buffer.data();
+
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer));
+        EXPECT_EQ(bufferMemory, buffer.data());
+        EXPECT_EQ(firstSave, buffer);
+    }
+
+    TEST_F(ALogicEngine_Serialization, EstimatesSerializedSizeBeforeFirstSave)
+    {
+        const size_t emptyEstimate = m_logicEngine.estimateSerializedSize();
+        EXPECT_GT(emptyEstimate, 0u);
+
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )", "luascript");
+
+        EXPECT_GT(m_logicEngine.estimateSerializedSize(), emptyEstimate);
+    }
+
+    class ALogicEngine_LazyScriptCompilation : public ALogicEngine
+    {
+    protected:
+        std::vector<uint8_t> createBufferWithScripts()
+        {
+            LogicEngine logicEngineForSaving;
+            for (const auto* name : {"script1", "script2", "script3"})
+            {
+                logicEngineForSaving.createLuaScriptFromSource(R"(
+                    function interface()
+                        IN.param = INT
+                        OUT.param = INT
+                    end
+                    function run()
+                        OUT.param = IN.param + 1
+                    end
+                )", name);
+            }
+
+            std::vector<uint8_t> buffer;
+            EXPECT_TRUE(logicEngineForSaving.saveToBuffer(buffer));
+            return buffer;
+        }
+    };
+
+    TEST_F(ALogicEngine_LazyScriptCompilation, CompilesAllScriptsOnLoad_ByDefault)
+    {
+        const std::vector<uint8_t> buffer = createBufferWithScripts();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        EXPECT_EQ(0u, m_logicEngine.getUncompiledScriptCount());
+    }
+
+    TEST_F(ALogicEngine_LazyScriptCompilation, LoadsPropertiesButDefersCompilation)
+    {
+        m_logicEngine.setLazyScriptCompilation(true);
+        const std::vector<uint8_t> buffer = createBufferWithScripts();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        EXPECT_EQ(3u, m_logicEngine.getUncompiledScriptCount());
+
+        LuaScript* script1 = m_logicEngine.findScript("script1");
+        LuaScript* script2 = m_logicEngine.findScript("script2");
+        ASSERT_NE(nullptr, script1);
+        ASSERT_NE(nullptr, script2);
+        ASSERT_TRUE(m_logicEngine.link(*script1->getOutputs()->getChild("param"), *script2->getInputs()->getChild("param")));
+        EXPECT_TRUE(script1->getInputs()->getChild("param")->set<int32_t>(5));
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0u, m_logicEngine.getUncompiledScriptCount());
+        EXPECT_EQ(7, *script2->getOutputs()->getChild("param")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LazyScriptCompilation, PrewarmsGivenNumberOfScripts)
+    {
+        m_logicEngine.setLazyScriptCompilation(true);
+        const std::vector<uint8_t> buffer = createBufferWithScripts();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+
+        EXPECT_TRUE(m_logicEngine.prewarm(2u));
+        EXPECT_EQ(1u, m_logicEngine.getUncompiledScriptCount());
+        EXPECT_TRUE(m_logicEngine.prewarm());
+        EXPECT_EQ(0u, m_logicEngine.getUncompiledScriptCount());
+        EXPECT_TRUE(m_logicEngine.prewarm());
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1, *m_logicEngine.findScript("script3")->getOutputs()->getChild("param")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LazyScriptCompilation, DefersCompilationForAsyncLoad)
+    {
+        m_logicEngine.setLazyScriptCompilation(true);
+        const std::vector<uint8_t> buffer = createBufferWithScripts();
+        std::future<bool> loading = m_logicEngine.loadFromBufferAsync(buffer.data(), buffer.size());
+        ASSERT_TRUE(loading.get());
+        ASSERT_TRUE(m_logicEngine.commitAsyncLoad());
+        EXPECT_EQ(3u, m_logicEngine.getUncompiledScriptCount());
+    }
 }
 
@@ -0,0 +1,189 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/LogicEngineImpl.h"
+#include "impl/PropertyImpl.h"
+
+using ::testing::ElementsAre;
+
+namespace rlogic
+{
+    class ALogicEngine_StructLinks : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_StructLinks()
+            : m_sourceScript(*m_logicEngine.createLuaScriptFromSource(m_scriptSource, "SourceScript"))
+            , m_targetScript(*m_logicEngine.createLuaScriptFromSource(m_scriptSource, "TargetScript"))
+        {
+        }
+
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.data = {
+                    count = INT,
+                    transform = {
+                        translation = VEC3F,
+                        scale = FLOAT
+                    },
+                    weights = ARRAY(3, FLOAT)
+                }
+                OUT.data = {
+                    count = INT,
+                    transform = {
+                        translation = VEC3F,
+                        scale = FLOAT
+                    },
+                    weights = ARRAY(3, FLOAT)
+                }
+            end
+
+            function run()
+                OUT.data.count = IN.data.count
+                OUT.data.transform.translation = IN.data.transform.translation
+                OUT.data.transform.scale = IN.data.transform.scale
+                for i = 1, 3 do
+                    OUT.data.weights[i] = IN.data.weights[i]
+                end
+            end
+        )";
+
+        void setSourceData()
+        {
+            Property& data = *m_sourceScript.getInputs()->getChild("data");
+            EXPECT_TRUE(data.getChild("count")->set<int32_t>(3));
+            EXPECT_TRUE(data.getChild("transform")->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+            EXPECT_TRUE(data.getChild("transform")->getChild("scale")->set<float>(0.5f));
+            EXPECT_TRUE(data.getChild("weights")->getChild(2)->set<float>(0.25f));
+        }
+
+        static void ExpectData(const Property& data)
+        {
+            EXPECT_EQ(3, *data.getChild("count")->get<int32_t>());
+            EXPECT_THAT(*data.getChild("transform")->getChild("translation")->get<vec3f>(), ElementsAre(1.f, 2.f, 3.f));
+            EXPECT_FLOAT_EQ(0.5f, *data.getChild("transform")->getChild("scale")->get<float>());
+            EXPECT_FLOAT_EQ(0.f, *data.getChild("weights")->getChild(0)->get<float>());
+            EXPECT_FLOAT_EQ(0.25f, *data.getChild("weights")->getChild(2)->get<float>());
+        }
+
+        const Property& sourceData() const
+        {
+            return *m_sourceScript.getOutputs()->getChild("data");
+        }
+
+        Property& targetData()
+        {
+            return *m_targetScript.getInputs()->getChild("data");
+        }
+
+        LuaScript& m_sourceScript;
+        LuaScript& m_targetScript;
+    };
+
+    TEST_F(ALogicEngine_StructLinks, PropagatesAllChildrenOfLinkedStruct)
+    {
+        ASSERT_TRUE(m_logicEngine.link(sourceData(), targetData()));
+        EXPECT_EQ(1u, m_logicEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().size());
+
+        setSourceData();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ExpectData(targetData());
+        ExpectData(*m_targetScript.getOutputs()->getChild("data"));
+    }
+
+    TEST_F(ALogicEngine_StructLinks, PropagatesNestedStructsAndArrays)
+    {
+        ASSERT_TRUE(m_logicEngine.link(*sourceData().getChild("transform"), *targetData().getChild("transform")));
+        ASSERT_TRUE(m_logicEngine.link(*sourceData().getChild("weights"), *targetData().getChild("weights")));
+
+        setSourceData();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(0, *targetData().getChild("count")->get<int32_t>());
+        EXPECT_THAT(*targetData().getChild("transform")->getChild("translation")->get<vec3f>(), ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_FLOAT_EQ(0.25f, *targetData().getChild("weights")->getChild(2)->get<float>());
+
+        // Not linked child can still be set
+        EXPECT_TRUE(targetData().getChild("count")->set<int32_t>(5));
+    }
+
+    TEST_F(ALogicEngine_StructLinks, ChildrenOfLinkedStructCantBeSetOrLinked)
+    {
+        ASSERT_TRUE(m_logicEngine.link(sourceData(), targetData()));
+
+        EXPECT_FALSE(targetData().getChild("transform")->getChild("scale")->set<float>(1.f));
+        EXPECT_FALSE(m_logicEngine.link(*sourceData().getChild("count"), *targetData().getChild("count")));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("The property 'count' of LogicNode 'TargetScript' is already linked as a part of a linked struct or array", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.link(*sourceData().getChild("weights"), *targetData().getChild("weights")));
+        EXPECT_EQ("The property 'weights' of LogicNode 'TargetScript' is already linked as a part of a linked struct or array", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_StructLinks, UnlinksStructAsAWhole)
+    {
+        ASSERT_TRUE(m_logicEngine.link(sourceData(), targetData()));
+        setSourceData();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FALSE(m_logicEngine.unlink(*sourceData().getChild("count"), *targetData().getChild("count")));
+        ASSERT_TRUE(m_logicEngine.unlink(sourceData(), targetData()));
+        EXPECT_TRUE(m_logicEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().empty());
+        EXPECT_FALSE(m_logicEngine.isLinked(m_targetScript));
+
+        // Values are kept, but can be set again
+        ExpectData(targetData());
+        EXPECT_TRUE(targetData().getChild("count")->set<int32_t>(7));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(7, *targetData().getChild("count")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_StructLinks, DestroyingSourceRemovesStructLink)
+    {
+        ASSERT_TRUE(m_logicEngine.link(sourceData(), targetData()));
+        ASSERT_TRUE(m_logicEngine.destroy(m_sourceScript));
+
+        EXPECT_TRUE(m_logicEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().empty());
+        EXPECT_FALSE(m_logicEngine.isLinked(m_targetScript));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_StructLinks, SavesAndLoadsStructLinkAsSingleLink)
+    {
+        WithTempDirectory tempDirectory;
+
+        ASSERT_TRUE(m_logicEngine.link(sourceData(), targetData()));
+        ASSERT_TRUE(m_logicEngine.saveToFile("struct_links.rlogic"));
+
+        LogicEngine loadedEngine;
+        ASSERT_TRUE(loadedEngine.loadFromFile("struct_links.rlogic"));
+        EXPECT_EQ(1u, loadedEngine.m_impl->getApiObjects().getLogicNodeDependencies().getLinks().size());
+
+        LuaScript* sourceScript = loadedEngine.findScript("SourceScript");
+        LuaScript* targetScript = loadedEngine.findScript("TargetScript");
+        ASSERT_NE(nullptr, sourceScript);
+        ASSERT_NE(nullptr, targetScript);
+
+        Property& data = *sourceScript->getInputs()->getChild("data");
+        EXPECT_TRUE(data.getChild("count")->set<int32_t>(3));
+        EXPECT_TRUE(data.getChild("transform")->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(data.getChild("transform")->getChild("scale")->set<float>(0.5f));
+        EXPECT_TRUE(data.getChild("weights")->getChild(2)->set<float>(0.25f));
+        ASSERT_TRUE(loadedEngine.update());
+
+        ExpectData(*targetScript->getInputs()->getChild("data"));
+        EXPECT_FALSE(targetScript->getInputs()->getChild("data")->getChild("count")->set<int32_t>(1));
+    }
+}
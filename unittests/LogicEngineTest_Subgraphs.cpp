@@ -0,0 +1,165 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "WithTempDirectory.h"
+
+namespace rlogic
+{
+    class ALogicEngine_Subgraphs : public ALogicEngine_ScriptChain
+    {
+    protected:
+        ALogicEngine_Subgraphs()
+        {
+            EXPECT_TRUE(m_logicEngine.setSubgraph(m_menuScript, "menu"));
+            EXPECT_TRUE(m_logicEngine.setSubgraph(m_menuTarget, "menu"));
+        }
+
+        // Source -> MenuScript -> MenuTarget -> Target
+        LuaScript& m_source = createChainedScript("Source");
+        LuaScript& m_menuScript = createChainedScript("MenuScript");
+        LuaScript& m_menuTarget = createChainedScript("MenuTarget");
+        LuaScript& m_target = createChainedScript("Target");
+    };
+
+    TEST_F(ALogicEngine_Subgraphs, UpdatesNodesOfSubgraphWhichIsNotSuspended)
+    {
+        EXPECT_FALSE(m_logicEngine.isSubgraphSuspended("menu"));
+        updateWithSourceValue(1);
+        EXPECT_EQ(1, Output(m_menuScript));
+        EXPECT_EQ(1, Output(m_menuTarget));
+        EXPECT_EQ(1, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, RemembersSubgraphOfNodes)
+    {
+        EXPECT_EQ("menu", m_logicEngine.getSubgraph(m_menuScript));
+        EXPECT_EQ("", m_logicEngine.getSubgraph(m_source));
+
+        EXPECT_TRUE(m_logicEngine.setSubgraph(m_menuScript, "otherMenu"));
+        EXPECT_EQ("otherMenu", m_logicEngine.getSubgraph(m_menuScript));
+
+        EXPECT_TRUE(m_logicEngine.setSubgraph(m_menuScript, ""));
+        EXPECT_EQ("", m_logicEngine.getSubgraph(m_menuScript));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, SkipsExecutionAndLinksOfSuspendedSubgraph)
+    {
+        updateWithSourceValue(1);
+
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("menu"));
+        EXPECT_TRUE(m_logicEngine.isSubgraphSuspended("menu"));
+        updateWithSourceValue(2);
+
+        EXPECT_EQ(2, Output(m_source));
+        // The link from Source was not propagated either
+        EXPECT_EQ(1, *m_menuScript.getInputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(1, Output(m_menuScript));
+        EXPECT_EQ(1, Output(m_menuTarget));
+        // Nodes outside of the subgraph keep seeing the last values
+        EXPECT_EQ(1, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, AppliesChangesOfSuspendedTimeWhenResumed)
+    {
+        updateWithSourceValue(1);
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("menu"));
+
+        updateWithSourceValue(2);
+        updateWithSourceValue(3);
+        EXPECT_TRUE(m_menuTarget.getInputs()->getChild("offset")->set<int32_t>(10));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1, Output(m_menuTarget));
+        EXPECT_EQ(1, Output(m_target));
+
+        EXPECT_TRUE(m_logicEngine.resumeSubgraph("menu"));
+        EXPECT_FALSE(m_logicEngine.isSubgraphSuspended("menu"));
+        EXPECT_EQ(1, Output(m_menuTarget));
+
+        // Latest value of Source and the offset which was set while suspended, within a single update
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, Output(m_menuScript));
+        EXPECT_EQ(13, Output(m_menuTarget));
+        EXPECT_EQ(13, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, SuspendsNodesAddedToSuspendedSubgraph)
+    {
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("menu"));
+        EXPECT_TRUE(m_logicEngine.setSubgraph(m_target, "menu"));
+        updateWithSourceValue(1);
+        EXPECT_EQ(0, Output(m_target));
+
+        // Removing a node from a suspended subgraph resumes it
+        EXPECT_TRUE(m_logicEngine.setSubgraph(m_target, ""));
+        EXPECT_TRUE(m_logicEngine.update());
+        // Target runs, but the suspended nodes before it don't deliver new values
+        EXPECT_EQ(0, Output(m_target));
+        EXPECT_TRUE(m_target.getInputs()->getChild("offset")->set<int32_t>(5));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, SuspendsSubgraphsIndependently)
+    {
+        EXPECT_TRUE(m_logicEngine.setSubgraph(m_target, "otherMenu"));
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("otherMenu"));
+        EXPECT_FALSE(m_logicEngine.isSubgraphSuspended("menu"));
+
+        updateWithSourceValue(1);
+        EXPECT_EQ(1, Output(m_menuTarget));
+        EXPECT_EQ(0, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, ForgetsDestroyedNodes)
+    {
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("menu"));
+        EXPECT_TRUE(m_logicEngine.destroy(m_menuScript));
+        EXPECT_TRUE(m_logicEngine.resumeSubgraph("menu"));
+
+        EXPECT_TRUE(m_menuTarget.getInputs()->getChild("value")->set<int32_t>(4));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(4, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, DoesNotSaveSubgraphs)
+    {
+        WithTempDirectory tempDirectory;
+        EXPECT_TRUE(m_logicEngine.suspendSubgraph("menu"));
+        ASSERT_TRUE(m_logicEngine.saveToFile("subgraphs.rlogic"));
+        ASSERT_TRUE(m_logicEngine.loadFromFile("subgraphs.rlogic"));
+
+        EXPECT_FALSE(m_logicEngine.isSubgraphSuspended("menu"));
+        const LuaScript* menuScript = m_logicEngine.findScript("MenuScript");
+        ASSERT_NE(nullptr, menuScript);
+        EXPECT_EQ("", m_logicEngine.getSubgraph(*menuScript));
+    }
+
+    TEST_F(ALogicEngine_Subgraphs, ProducesErrorsForUnknownSubgraphsAndNodesOfOtherLogicEngine)
+    {
+        EXPECT_FALSE(m_logicEngine.suspendSubgraph("unknown"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't suspend subgraph 'unknown' because it doesn't exist, add logic nodes to it with setSubgraph() first", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.resumeSubgraph("unknown"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't resume subgraph 'unknown' because it doesn't exist, add logic nodes to it with setSubgraph() first", m_logicEngine.getErrors()[0].message);
+        EXPECT_FALSE(m_logicEngine.isSubgraphSuspended("unknown"));
+
+        LogicEngine otherLogicEngine;
+        LuaScript* otherScript = otherLogicEngine.createLuaScriptFromSource(m_chainedScriptSource, "OtherScript");
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_FALSE(m_logicEngine.setSubgraph(*otherScript, "menu"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("LogicNode 'OtherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+    }
+}
@@ -28,6 +28,9 @@
 #include "impl/LogicNodeImpl.h"
 #include "impl/LogicEngineImpl.h"
 
+#include <array>
+#include <thread>
+
 #include "fmt/format.h"
 
 namespace rlogic
@@ -487,5 +490,44 @@ namespace rlogic
         EXPECT_EQ("SourceScript", messages[0].first);
         EXPECT_EQ("TargetScript", messages[1].first);
     }
+
+    TEST(ALogicEngine_UpdateOnSeveralThreads, UpdatesIndependentEnginesInParallel)
+    {
+        const std::string_view scriptSource = R"(
+            function interface()
+                IN.value = INT
+                OUT.value = INT
+            end
+            function run()
+                OUT.value = IN.value + 1
+            end
+        )";
+
+        std::array<int32_t, 4> results = {};
+        std::vector<std::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < results.size(); ++threadIndex)
+        {
+            threads.emplace_back([scriptSource, threadIndex, &results]() {
+                LogicEngine logicEngine;
+                LuaScript* script1 = logicEngine.createLuaScriptFromSource(scriptSource);
+                LuaScript* script2 = logicEngine.createLuaScriptFromSource(scriptSource);
+                logicEngine.link(*script1->getOutputs()->getChild("value"), *script2->getInputs()->getChild("value"));
+
+                for (int32_t i = 0; i < 200; ++i)
+                {
+                    script1->getInputs()->getChild("value")->set<int32_t>(i + static_cast<int32_t>(threadIndex));
+                    logicEngine.update();
+                }
+                results[threadIndex] = *script2->getOutputs()->getChild("value")->get<int32_t>();
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Last input is 199 + threadIndex, each script adds 1
+        EXPECT_THAT(results, ::testing::ElementsAre(201, 202, 203, 204));
+    }
 }
 
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include <chrono>
+
+namespace rlogic
+{
+    class ALogicEngine_UpdateInterval : public ALogicEngine_ScriptChain
+    {
+    protected:
+        ALogicEngine_UpdateInterval()
+        {
+            m_logicEngine.setUpdateClock([this]() { return m_now; });
+        }
+
+        // Source -> SlowScript -> Target
+        LuaScript& m_source = createChainedScript("Source");
+        LuaScript& m_slowScript = createChainedScript("SlowScript");
+        LuaScript& m_target = createChainedScript("Target");
+        std::chrono::steady_clock::time_point m_now;
+    };
+
+    TEST_F(ALogicEngine_UpdateInterval, ExecutesNodesInEveryUpdateByDefault)
+    {
+        for (int32_t value = 1; value <= 3; ++value)
+        {
+            updateWithSourceValue(value);
+            EXPECT_EQ(value, Output(m_slowScript));
+            EXPECT_EQ(value, Output(m_target));
+        }
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, ExecutesNodeAtMostInEveryNthUpdate)
+    {
+        m_slowScript.setUpdateInterval(3u);
+
+        updateWithSourceValue(1);
+        EXPECT_EQ(1, Output(m_slowScript));
+        EXPECT_EQ(1, Output(m_target));
+
+        // Source is executed in every update, SlowScript and the nodes linked to it keep their values
+        updateWithSourceValue(2);
+        EXPECT_EQ(2, Output(m_source));
+        EXPECT_EQ(1, Output(m_slowScript));
+        EXPECT_EQ(1, Output(m_target));
+        updateWithSourceValue(3);
+        EXPECT_EQ(1, Output(m_slowScript));
+        EXPECT_EQ(1, Output(m_target));
+
+        // Sees the latest propagated value
+        updateWithSourceValue(4);
+        EXPECT_EQ(4, Output(m_slowScript));
+        EXPECT_EQ(4, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, ExecutesDeferredNodeWhenDueAlsoIfInputsDontChangeAnymore)
+    {
+        m_slowScript.setUpdateInterval(2u);
+
+        updateWithSourceValue(1);
+        updateWithSourceValue(2);
+        EXPECT_EQ(1, Output(m_slowScript));
+
+        // The change of the previous update is not lost
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2, Output(m_slowScript));
+        EXPECT_EQ(2, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, ExecutesNodeImmediatelyWhenInputChangesAfterLongerPause)
+    {
+        m_slowScript.setUpdateInterval(3u);
+
+        updateWithSourceValue(1);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.update());
+
+        updateWithSourceValue(2);
+        EXPECT_EQ(2, Output(m_slowScript));
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, ExecutesNodeWhenMinimumTimeHasPassedOnClockOfEngine)
+    {
+        m_slowScript.setMinimumTimeBetweenUpdates(std::chrono::milliseconds{200});
+
+        updateWithSourceValue(1);
+        EXPECT_EQ(1, Output(m_slowScript));
+
+        m_now += std::chrono::milliseconds{100};
+        updateWithSourceValue(2);
+        EXPECT_EQ(1, Output(m_slowScript));
+        EXPECT_EQ(1, Output(m_target));
+
+        m_now += std::chrono::milliseconds{99};
+        updateWithSourceValue(3);
+        EXPECT_EQ(1, Output(m_slowScript));
+
+        m_now += std::chrono::milliseconds{1};
+        updateWithSourceValue(4);
+        EXPECT_EQ(4, Output(m_slowScript));
+        EXPECT_EQ(4, Output(m_target));
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, UsesSteadyClockWhenClockIsReset)
+    {
+        m_slowScript.setMinimumTimeBetweenUpdates(std::chrono::milliseconds{1});
+        m_logicEngine.setUpdateClock(nullptr);
+
+        updateWithSourceValue(1);
+        const auto lastUpdate = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - lastUpdate < std::chrono::milliseconds{2})
+        {
+        }
+        updateWithSourceValue(2);
+        EXPECT_EQ(2, Output(m_slowScript));
+    }
+
+    TEST_F(ALogicEngine_UpdateInterval, DoesNotRecordDeferredNodeAsUpdated)
+    {
+        m_slowScript.setUpdateInterval(2u);
+        m_slowScript.setMinimumTimeBetweenUpdates(std::chrono::milliseconds{10});
+
+        updateWithSourceValue(1);
+        // Enough updates, but not enough time
+        updateWithSourceValue(2);
+        updateWithSourceValue(3);
+        EXPECT_EQ(1, Output(m_slowScript));
+
+        // Both have passed since the last execution
+        m_now += std::chrono::milliseconds{10};
+        updateWithSourceValue(4);
+        EXPECT_EQ(4, Output(m_slowScript));
+    }
+}
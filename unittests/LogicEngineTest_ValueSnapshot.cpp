@@ -0,0 +1,260 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/Property.h"
+
+#include "impl/LogicNodeImpl.h"
+
+namespace rlogic
+{
+    class ALogicEngine_ValueSnapshot : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.int = INT
+                IN.str = STRING
+                IN.nested = {
+                    vec = VEC3F,
+                    flag = BOOL
+                }
+                OUT.int = INT
+                OUT.str = STRING
+                OUT.vec = VEC3F
+            end
+            function run()
+                OUT.int = IN.int * 2
+                OUT.str = IN.str .. "!"
+                OUT.vec = IN.nested.vec
+            end
+        )";
+
+        std::vector<uint8_t> m_snapshot;
+    };
+
+    TEST_F(ALogicEngine_ValueSnapshot, RestoresInputAndOutputValuesOfScripts)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        Property* inputs = script->getInputs();
+        ASSERT_TRUE(inputs->getChild("int")->set<int32_t>(21));
+        ASSERT_TRUE(inputs->getChild("str")->set<std::string>("snapshot"));
+        ASSERT_TRUE(inputs->getChild("nested")->getChild("vec")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        ASSERT_TRUE(inputs->getChild("nested")->getChild("flag")->set<bool>(true));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        ASSERT_TRUE(inputs->getChild("int")->set<int32_t>(5));
+        ASSERT_TRUE(inputs->getChild("str")->set<std::string>("a much longer string which requires allocation"));
+        ASSERT_TRUE(inputs->getChild("nested")->getChild("vec")->set<vec3f>({ 4.f, 5.f, 6.f }));
+        ASSERT_TRUE(inputs->getChild("nested")->getChild("flag")->set<bool>(false));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_EQ(10, *script->getOutputs()->getChild("int")->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(21, *inputs->getChild("int")->get<int32_t>());
+        EXPECT_EQ("snapshot", *inputs->getChild("str")->get<std::string>());
+        EXPECT_THAT(*inputs->getChild("nested")->getChild("vec")->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_TRUE(*inputs->getChild("nested")->getChild("flag")->get<bool>());
+        EXPECT_EQ(42, *script->getOutputs()->getChild("int")->get<int32_t>());
+        EXPECT_EQ("snapshot!", *script->getOutputs()->getChild("str")->get<std::string>());
+        EXPECT_THAT(*script->getOutputs()->getChild("vec")->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RestoresDirtyStateOfScripts)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_FALSE(script->m_impl.get().isDirty());
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        ASSERT_TRUE(script->getInputs()->getChild("int")->set<int32_t>(5));
+        ASSERT_TRUE(script->m_impl.get().isDirty());
+
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        EXPECT_FALSE(script->m_impl.get().isDirty());
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, PropagatesLinksAgainWhenSnapshotWasTakenWhilePropagationWasPending)
+    {
+        LuaScript* source = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "source");
+        LuaScript* target = m_logicEngine.createLuaScriptFromSource(m_scriptSource, "target");
+        ASSERT_TRUE(m_logicEngine.link(*source->getOutputs()->getChild("int"), *target->getInputs()->getChild("int")));
+        Property& targetInput = *target->getInputs()->getChild("int");
+
+        // The link to the suspended target is not propagated yet
+        ASSERT_TRUE(m_logicEngine.setSubgraph(*target, "paused"));
+        ASSERT_TRUE(m_logicEngine.suspendSubgraph("paused"));
+        ASSERT_TRUE(source->getInputs()->getChild("int")->set<int32_t>(21));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_EQ(0, *targetInput.get<int32_t>());
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        ASSERT_TRUE(m_logicEngine.resumeSubgraph("paused"));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_EQ(42, *targetInput.get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        EXPECT_EQ(0, *targetInput.get<int32_t>());
+
+        // The output of the source keeps its value and version, the link is executed nevertheless
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *targetInput.get<int32_t>());
+        EXPECT_EQ(84, *target->getOutputs()->getChild("int")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, PassesRestoredBindingValuesToRamsesOnNextUpdate)
+    {
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node);
+        ASSERT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        ASSERT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 4.f, 5.f, 6.f }));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        EXPECT_TRUE(binding->m_impl.get().isDirty());
+        ASSERT_TRUE(m_logicEngine.update());
+
+        vec3f translation;
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_THAT(translation, ::testing::ElementsAre(1.f, 2.f, 3.f));
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, KeepsBindingValuesPendingWhichWereNotPassedToRamsesWhenTakingSnapshot)
+    {
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node);
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+
+        // value was not passed to Ramses yet
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        vec3f translation;
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_THAT(translation, ::testing::ElementsAre(1.f, 2.f, 3.f));
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, DoesNotMarkBindingsDirtyWhenValuesDidNotChange)
+    {
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node);
+        ASSERT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        EXPECT_FALSE(binding->m_impl.get().isDirty());
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, ReusesSnapshotMemory)
+    {
+        m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        m_logicEngine.createRamsesNodeBinding(*m_node);
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+        const std::vector<uint8_t> firstSnapshot = m_snapshot;
+        const uint8_t* snapshotMemory = m_snapshot.data();
+
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+        EXPECT_EQ(snapshotMemory, m_snapshot.data());
+        EXPECT_EQ(firstSnapshot, m_snapshot);
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RefusesToRestoreSnapshotOfDifferentStructure)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        m_logicEngine.createLuaScriptFromSource(m_valid_empty_script);
+        ASSERT_TRUE(script->getInputs()->getChild("int")->set<int32_t>(5));
+
+        EXPECT_FALSE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't restore value snapshot, it was taken from logic nodes with different properties than the current ones!", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(5, *script->getInputs()->getChild("int")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RefusesToRestoreSnapshotAfterNodeWasDestroyed)
+    {
+        m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        LuaScript* otherScript = m_logicEngine.createLuaScriptFromSource(m_valid_empty_script);
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+        // Structure is only computed again after a change
+        EXPECT_TRUE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+
+        ASSERT_TRUE(m_logicEngine.destroy(*otherScript));
+        EXPECT_FALSE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't restore value snapshot, it was taken from logic nodes with different properties than the current ones!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RefusesToRestoreSnapshotWithPropertiesOfDifferentName)
+    {
+        m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.a = INT
+            end
+            function run()
+            end
+        )", "script");
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        LogicEngine otherLogicEngine;
+        otherLogicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.b = INT
+            end
+            function run()
+            end
+        )", "script");
+        EXPECT_FALSE(otherLogicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RefusesToRestoreInvalidData)
+    {
+        m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        EXPECT_FALSE(m_logicEngine.restoreValueSnapshot(nullptr, 0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't restore value snapshot, data is too small to contain a snapshot!", m_logicEngine.getErrors()[0].message);
+
+        std::vector<uint8_t> wrongMagic = m_snapshot;
+        wrongMagic[0] ^= 0xFFu;
+        EXPECT_FALSE(m_logicEngine.restoreValueSnapshot(wrongMagic.data(), wrongMagic.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't restore value snapshot, data is not a value snapshot!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_ValueSnapshot, RefusesToRestoreTruncatedDataWithoutChangingAnyValue)
+    {
+        LuaScript* script = m_logicEngine.createLuaScriptFromSource(m_scriptSource);
+        ASSERT_TRUE(script->getInputs()->getChild("int")->set<int32_t>(21));
+        ASSERT_TRUE(script->getInputs()->getChild("str")->set<std::string>("snapshot"));
+        m_logicEngine.takeValueSnapshot(m_snapshot);
+
+        ASSERT_TRUE(script->getInputs()->getChild("int")->set<int32_t>(5));
+
+        m_snapshot.pop_back();
+        EXPECT_FALSE(m_logicEngine.restoreValueSnapshot(m_snapshot.data(), m_snapshot.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't restore value snapshot, it contains corrupted data!", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(5, *script->getInputs()->getChild("int")->get<int32_t>());
+    }
+}
@@ -74,7 +74,7 @@ namespace rlogic::internal
         // Has exactly one link
         const LinksMap& links = m_dependencies.getLinks();
         EXPECT_EQ(1u, links.size());
-        EXPECT_EQ(&output, links.at(&input));
+        EXPECT_EQ(&output, links.find(&input)->second.source);
         EXPECT_EQ(&output, m_dependencies.getLinkedOutput(input));
     }
 
@@ -191,7 +191,7 @@ namespace rlogic::internal
         // Has exactly one link
         const LinksMap& links = m_dependencies.getLinks();
         EXPECT_EQ(1u, links.size());
-        EXPECT_EQ(&outputB, links.at(&inputA));
+        EXPECT_EQ(&outputB, links.find(&inputA)->second.source);
         EXPECT_EQ(&outputB, m_dependencies.getLinkedOutput(inputA));
     }
 
@@ -219,18 +219,18 @@ namespace rlogic::internal
         PropertyImpl* m_arrayInputB;
     };
 
-    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenUnlinkingStructInputs_BasedOnTheirType)
+    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenUnlinkingStructInputs_WhichAreNotLinked)
     {
         PropertyImpl* structProperty = m_nodeBNested.getInputs()->getChild("inputStruct")->m_impl.get();
         EXPECT_FALSE(m_dependencies.unlink(*m_nestedOutputA, *structProperty, m_errorReporting));
-        EXPECT_EQ("Can't unlink properties of complex types directly!", m_errorReporting.getErrors()[0].message);
+        EXPECT_EQ("No link available from source property 'nested' to target property 'inputStruct'", m_errorReporting.getErrors()[0].message);
     }
 
-    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenUnlinkingArrayInputs_BasedOnTheirType)
+    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenUnlinkingArrayInputs_WhichAreNotLinked)
     {
         PropertyImpl* arrayProperty = m_nodeBNested.getInputs()->getChild("inputArray")->m_impl.get();
         EXPECT_FALSE(m_dependencies.unlink(*m_nestedOutputA, *arrayProperty, m_errorReporting));
-        EXPECT_EQ("Can't unlink properties of complex types directly!", m_errorReporting.getErrors()[0].message);
+        EXPECT_EQ("No link available from source property 'nested' to target property 'inputArray'", m_errorReporting.getErrors()[0].message);
     }
 
     TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenUnlinkingStructs_WithLinkedChildren)
@@ -238,11 +238,74 @@ namespace rlogic::internal
         EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
         EXPECT_TRUE(m_errorReporting.getErrors().empty());
 
-        // Still can't unlink complex type
+        // Only the child is linked, not the struct
         PropertyImpl* outputParentStruct = m_nodeANested.getOutputs()->getChild("outputStruct")->m_impl.get();
         PropertyImpl* inputParentStruct = m_nodeBNested.getInputs()->getChild("inputStruct")->m_impl.get();
         EXPECT_FALSE(m_dependencies.unlink(*outputParentStruct, *inputParentStruct, m_errorReporting));
-        EXPECT_EQ("Can't unlink properties of complex types directly!", m_errorReporting.getErrors()[0].message);
+        EXPECT_EQ("No link available from source property 'outputStruct' to target property 'inputStruct'", m_errorReporting.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, LinksStructsWithASingleLink)
+    {
+        PropertyImpl* outputStruct = m_nodeANested.getOutputs()->getChild("outputStruct")->m_impl.get();
+        PropertyImpl* inputStruct = m_nodeBNested.getInputs()->getChild("inputStruct")->m_impl.get();
+        EXPECT_TRUE(m_dependencies.link(*outputStruct, *inputStruct, m_errorReporting));
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        const LinksMap& links = m_dependencies.getLinks();
+        ASSERT_EQ(1u, links.size());
+        const PropertyLink& structLink = links.find(inputStruct)->second;
+        EXPECT_EQ(outputStruct, structLink.source);
+        ASSERT_EQ(1u, structLink.leaves.size());
+        EXPECT_EQ(m_nestedOutputA, structLink.leaves[0].source);
+        EXPECT_EQ(m_nestedInputB, structLink.leaves[0].target);
+        expectSortedNodeOrder({ &m_nodeANested, &m_nodeBNested });
+
+        EXPECT_TRUE(m_dependencies.unlink(*outputStruct, *inputStruct, m_errorReporting));
+        EXPECT_TRUE(links.empty());
+        EXPECT_FALSE(m_dependencies.isLinked(m_nodeANested));
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, LinksArraysWithASingleLink)
+    {
+        PropertyImpl* outputArray = m_nodeANested.getOutputs()->getChild("outputArray")->m_impl.get();
+        PropertyImpl* inputArray = m_nodeBNested.getInputs()->getChild("inputArray")->m_impl.get();
+        EXPECT_TRUE(m_dependencies.link(*outputArray, *inputArray, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.isLinked(m_nodeANested));
+        EXPECT_TRUE(m_dependencies.isLinked(m_nodeBNested));
+
+        // Removing the source node removes the array link
+        m_dependencies.removeNode(m_nodeANested);
+        EXPECT_TRUE(m_dependencies.getLinks().empty());
+        EXPECT_FALSE(m_dependencies.isLinked(m_nodeBNested));
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenLinkingStructsWithDifferentChildren)
+    {
+        PropertyImpl* outputStruct = m_nodeANested.getOutputs()->getChild("outputStruct")->m_impl.get();
+        PropertyImpl* inputArray = m_nodeBNested.getInputs()->getChild("inputArray")->m_impl.get();
+        EXPECT_FALSE(m_dependencies.link(*outputStruct, *inputArray, m_errorReporting));
+        EXPECT_EQ("Types of source property 'outputStruct:STRUCT' does not match target property 'inputArray:ARRAY'", m_errorReporting.getErrors()[0].message);
+
+        PropertyImpl* inputs = m_nodeBNested.getInputs()->m_impl.get();
+        EXPECT_FALSE(m_dependencies.link(*outputStruct, *inputs, m_errorReporting));
+        EXPECT_EQ("Can't link the root inputs or outputs of a LogicNode, link their children instead", m_errorReporting.getErrors()[1].message);
+        EXPECT_TRUE(m_dependencies.getLinks().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, ReportsErrorWhenStructAndItsChildrenAreLinked)
+    {
+        PropertyImpl* outputStruct = m_nodeANested.getOutputs()->getChild("outputStruct")->m_impl.get();
+        PropertyImpl* inputStruct = m_nodeBNested.getInputs()->getChild("inputStruct")->m_impl.get();
+
+        EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
+        EXPECT_FALSE(m_dependencies.link(*outputStruct, *inputStruct, m_errorReporting));
+        EXPECT_EQ("The property 'inputStruct' of LogicNode 'B' has linked children, unlink them before linking the whole struct or array", m_errorReporting.getErrors()[0].message);
+
+        EXPECT_TRUE(m_dependencies.unlink(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(*outputStruct, *inputStruct, m_errorReporting));
+        EXPECT_FALSE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
+        EXPECT_EQ("The property 'nested' of LogicNode 'B' is already linked as a part of a linked struct or array", m_errorReporting.getErrors()[1].message);
     }
 
     TEST_F(ALogicNodeDependencies_NestedLinks, ConnectingTwoNodes_CreatesALink)
@@ -255,7 +318,7 @@ namespace rlogic::internal
         // Has exactly one link
         const LinksMap& links = m_dependencies.getLinks();
         EXPECT_EQ(1u, links.size());
-        EXPECT_EQ(m_nestedOutputA, links.at(m_nestedInputB));
+        EXPECT_EQ(m_nestedOutputA, links.find(m_nestedInputB)->second.source);
         EXPECT_EQ(m_nestedOutputA, m_dependencies.getLinkedOutput(*m_nestedInputB));
     }
 
@@ -322,7 +385,7 @@ namespace rlogic::internal
         // Has exactly one link
         const LinksMap& links = m_dependencies.getLinks();
         EXPECT_EQ(1u, links.size());
-        EXPECT_EQ(&nestedOutputB, links.at(&nestedInputA));
+        EXPECT_EQ(&nestedOutputB, links.find(&nestedInputA)->second.source);
         EXPECT_EQ(&nestedOutputB, m_dependencies.getLinkedOutput(nestedInputA));
     }
 }
@@ -63,6 +63,57 @@ namespace rlogic::internal
         EXPECT_TRUE(logicNode.isDirty());
     }
 
+    TEST_F(ALogicNodeImpl, IsDueInEveryUpdateByDefault)
+    {
+        LogicNodeImplMock logicNode("");
+        EXPECT_EQ(1u, logicNode.getUpdateInterval());
+        EXPECT_EQ(std::chrono::milliseconds{0}, logicNode.getMinimumTimeBetweenUpdates());
+
+        const auto now = std::chrono::steady_clock::now();
+        EXPECT_TRUE(logicNode.isUpdateDue(1u, now));
+        logicNode.setLastUpdate(1u, now);
+        EXPECT_TRUE(logicNode.isUpdateDue(2u, now));
+    }
+
+    TEST_F(ALogicNodeImpl, IsDueWhenUpdateIntervalHasPassed)
+    {
+        LogicNodeImplMock logicNode("");
+        logicNode.setUpdateInterval(3u);
+        EXPECT_EQ(3u, logicNode.getUpdateInterval());
+
+        const auto now = std::chrono::steady_clock::now();
+        // Never delays the first update
+        EXPECT_TRUE(logicNode.isUpdateDue(5u, now));
+        logicNode.setLastUpdate(5u, now);
+        EXPECT_FALSE(logicNode.isUpdateDue(6u, now));
+        EXPECT_FALSE(logicNode.isUpdateDue(7u, now));
+        EXPECT_TRUE(logicNode.isUpdateDue(8u, now));
+        EXPECT_TRUE(logicNode.isUpdateDue(20u, now));
+
+        logicNode.setUpdateInterval(0u);
+        EXPECT_EQ(1u, logicNode.getUpdateInterval());
+    }
+
+    TEST_F(ALogicNodeImpl, IsDueWhenMinimumTimeBetweenUpdatesHasPassed)
+    {
+        LogicNodeImplMock logicNode("");
+        logicNode.setMinimumTimeBetweenUpdates(std::chrono::milliseconds{200});
+        EXPECT_EQ(std::chrono::milliseconds{200}, logicNode.getMinimumTimeBetweenUpdates());
+
+        const auto now = std::chrono::steady_clock::now();
+        logicNode.setLastUpdate(1u, now);
+        EXPECT_FALSE(logicNode.isUpdateDue(2u, now + std::chrono::milliseconds{199}));
+        EXPECT_TRUE(logicNode.isUpdateDue(2u, now + std::chrono::milliseconds{200}));
+
+        // Both limits have to pass
+        logicNode.setUpdateInterval(2u);
+        EXPECT_FALSE(logicNode.isUpdateDue(2u, now + std::chrono::milliseconds{500}));
+        EXPECT_TRUE(logicNode.isUpdateDue(3u, now + std::chrono::milliseconds{500}));
+
+        logicNode.setMinimumTimeBetweenUpdates(std::chrono::milliseconds{-1});
+        EXPECT_EQ(std::chrono::milliseconds{0}, logicNode.getMinimumTimeBetweenUpdates());
+    }
+
     TEST_F(ALogicNodeImpl, TakesOwnershipOfGivenProperties)
     {
         // These usually come from subclasses deserialization code
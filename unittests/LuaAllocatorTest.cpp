@@ -0,0 +1,180 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/LuaAllocator.h"
+
+#include <cstring>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    class ALuaAllocator : public ::testing::Test
+    {
+    protected:
+        void* allocate(size_t size)
+        {
+            return LuaAllocator::Allocate(&m_allocator, nullptr, 0u, size);
+        }
+
+        void* reallocate(void* ptr, size_t oldSize, size_t newSize)
+        {
+            return LuaAllocator::Allocate(&m_allocator, ptr, oldSize, newSize);
+        }
+
+        void deallocate(void* ptr, size_t size)
+        {
+            EXPECT_EQ(nullptr, LuaAllocator::Allocate(&m_allocator, ptr, size, 0u));
+        }
+
+        LuaAllocator m_allocator{ 0u };
+    };
+
+    TEST_F(ALuaAllocator, HasEmptyStatisticsInitially)
+    {
+        const LuaMemoryStatistics stats = m_allocator.getStatistics();
+        EXPECT_EQ(0u, stats.currentBytes);
+        EXPECT_EQ(0u, stats.peakBytes);
+        EXPECT_EQ(0u, stats.memoryLimit);
+        EXPECT_EQ(0u, stats.liveAllocations);
+        EXPECT_EQ(0u, stats.totalAllocations);
+        EXPECT_EQ(0u, stats.systemAllocations);
+        EXPECT_EQ(0u, stats.failedAllocations);
+        EXPECT_EQ(0u, stats.reservedPoolBytes);
+    }
+
+    TEST_F(ALuaAllocator, TracksAllocatedBytes)
+    {
+        void* small = allocate(24u);
+        void* large = allocate(4096u);
+        ASSERT_NE(nullptr, small);
+        ASSERT_NE(nullptr, large);
+
+        LuaMemoryStatistics stats = m_allocator.getStatistics();
+        EXPECT_EQ(24u + 4096u, stats.currentBytes);
+        EXPECT_EQ(24u + 4096u, stats.peakBytes);
+        EXPECT_EQ(2u, stats.liveAllocations);
+        EXPECT_EQ(2u, stats.totalAllocations);
+        EXPECT_EQ(LuaAllocator::PoolChunkSize, stats.reservedPoolBytes);
+
+        deallocate(large, 4096u);
+        deallocate(small, 24u);
+
+        stats = m_allocator.getStatistics();
+        EXPECT_EQ(0u, stats.currentBytes);
+        EXPECT_EQ(24u + 4096u, stats.peakBytes);
+        EXPECT_EQ(0u, stats.liveAllocations);
+        EXPECT_EQ(2u, stats.totalAllocations);
+    }
+
+    TEST_F(ALuaAllocator, ServesSmallBlocksFromPool)
+    {
+        void* first = allocate(40u);
+        const size_t systemAllocations = m_allocator.getStatistics().systemAllocations;
+
+        for (size_t i = 0u; i < 100u; ++i)
+        {
+            void* block = allocate(8u + i);
+            ASSERT_NE(nullptr, block);
+            deallocate(block, 8u + i);
+        }
+
+        EXPECT_EQ(systemAllocations, m_allocator.getStatistics().systemAllocations);
+        deallocate(first, 40u);
+    }
+
+    TEST_F(ALuaAllocator, ReusesFreedBlocksOfSameSizeClass)
+    {
+        void* block = allocate(33u);
+        deallocate(block, 33u);
+        EXPECT_EQ(block, allocate(48u));
+        deallocate(block, 48u);
+    }
+
+    TEST_F(ALuaAllocator, ReturnsAlignedBlocks)
+    {
+        for (size_t size = 1u; size < 2 * LuaAllocator::MaxPooledBlockSize; size += 7u)
+        {
+            void* block = allocate(size);
+            ASSERT_NE(nullptr, block);
+            EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t));
+            std::memset(block, 0xAB, size);
+            deallocate(block, size);
+        }
+    }
+
+    TEST_F(ALuaAllocator, KeepsContentWhenReallocating)
+    {
+        char* block = static_cast<char*>(allocate(10u));
+        std::memcpy(block, "123456789", 10u);
+
+        // Same size class, between size classes, into and out of the system allocator
+        size_t currentSize = 10u;
+        for (const size_t newSize : {12u, 100u, 2000u, 5000u, 300u, 10u})
+        {
+            block = static_cast<char*>(reallocate(block, currentSize, newSize));
+            ASSERT_NE(nullptr, block);
+            EXPECT_STREQ("123456789", block);
+            EXPECT_EQ(newSize, m_allocator.getStatistics().currentBytes);
+            EXPECT_EQ(1u, m_allocator.getStatistics().liveAllocations);
+            currentSize = newSize;
+        }
+
+        deallocate(block, currentSize);
+    }
+
+    TEST_F(ALuaAllocator, IgnoresMemoryLimit_WhenNotActive)
+    {
+        m_allocator.setMemoryLimit(100u);
+        EXPECT_EQ(100u, m_allocator.getStatistics().memoryLimit);
+
+        void* block = allocate(1000u);
+        EXPECT_NE(nullptr, block);
+        EXPECT_EQ(0u, m_allocator.getStatistics().failedAllocations);
+        deallocate(block, 1000u);
+    }
+
+    TEST_F(ALuaAllocator, FailsGrowingAllocationsOverLimit_WhenActive)
+    {
+        m_allocator.setMemoryLimit(100u);
+
+        void* block = allocate(80u);
+        ASSERT_NE(nullptr, block);
+        {
+            const LuaAllocator::ScopedMemoryLimit memoryLimit(m_allocator);
+            EXPECT_EQ(nullptr, allocate(40u));
+            EXPECT_EQ(nullptr, reallocate(block, 80u, 200u));
+            EXPECT_EQ(2u, m_allocator.getStatistics().failedAllocations);
+
+            // Shrinking always succeeds
+            block = reallocate(block, 80u, 10u);
+            ASSERT_NE(nullptr, block);
+
+            void* other = allocate(40u);
+            EXPECT_NE(nullptr, other);
+            deallocate(other, 40u);
+        }
+
+        EXPECT_EQ(10u, m_allocator.getStatistics().currentBytes);
+        deallocate(block, 10u);
+    }
+
+    TEST_F(ALuaAllocator, DeactivatesLimitAfterScope)
+    {
+        m_allocator.setMemoryLimit(10u);
+        {
+            const LuaAllocator::ScopedMemoryLimit memoryLimit(m_allocator);
+            EXPECT_EQ(nullptr, allocate(40u));
+        }
+
+        void* block = allocate(40u);
+        EXPECT_NE(nullptr, block);
+        deallocate(block, 40u);
+    }
+}
@@ -45,6 +45,70 @@ namespace rlogic::internal
         EXPECT_EQ("", script->getFilename());
     }
 
+    TEST_F(ALuaScript_Lifecycle, CreatesMultipleInstancesOfSameSource_WithIndependentInterfaceAndValues)
+    {
+        const std::string_view source = R"(
+            function interface()
+                IN.value = INT
+                IN.nested = {
+                    array = ARRAY(2, FLOAT)
+                }
+                OUT.value = INT
+            end
+
+            function run()
+                OUT.value = IN.value * 2
+            end
+        )";
+
+        auto* script1 = m_logicEngine.createLuaScriptFromSource(source, "instance1");
+        auto* script2 = m_logicEngine.createLuaScriptFromSource(source, "instance2");
+        ASSERT_NE(nullptr, script1);
+        ASSERT_NE(nullptr, script2);
+
+        for (auto* script : {script1, script2})
+        {
+            ASSERT_EQ(2u, script->getInputs()->getChildCount());
+            const Property* array = script->getInputs()->getChild("nested")->getChild("array");
+            ASSERT_NE(nullptr, array);
+            EXPECT_EQ(EPropertyType::Array, array->getType());
+            EXPECT_EQ(2u, array->getChildCount());
+            EXPECT_EQ(EPropertySemantics::ScriptInput, array->getChild(0)->m_impl->getPropertySemantics());
+            EXPECT_EQ(EPropertySemantics::ScriptOutput, script->getOutputs()->getChild("value")->m_impl->getPropertySemantics());
+        }
+        EXPECT_NE(script1->getInputs(), script2->getInputs());
+
+        script1->getInputs()->getChild("value")->set<int32_t>(5);
+        script2->getInputs()->getChild("value")->set<int32_t>(7);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(10, *script1->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(14, *script2->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Lifecycle, ReportsRuntimeErrorsWithLineNumbers_ForFurtherInstancesOfSameSource)
+    {
+        const std::string_view source = R"(
+            function interface()
+            end
+
+            function run()
+                error("failed in run")
+            end
+        )";
+
+        LuaScript* script1 = m_logicEngine.createLuaScriptFromSource(source, "instance1");
+        ASSERT_NE(nullptr, script1);
+        LuaScript* script2 = m_logicEngine.createLuaScriptFromSource(source, "instance2");
+        ASSERT_NE(nullptr, script2);
+        m_logicEngine.destroy(*script1);
+
+        // Error of the script which was compiled from cached bytecode names this script, not the first one
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("[string \"instance2\"]:6: failed in run"));
+    }
+
     TEST_F(ALuaScript_Lifecycle, ProducesErrorWhenLoadedFileWithRuntimeErrorsInTheInterfaceFunction)
     {
         std::ofstream ofs;
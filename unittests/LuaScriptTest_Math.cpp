@@ -0,0 +1,206 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LuaScriptTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "fmt/format.h"
+
+using ::testing::ElementsAre;
+using ::testing::FloatNear;
+using ::testing::HasSubstr;
+
+namespace rlogic
+{
+    class ALuaScript_Math : public ALuaScript
+    {
+    protected:
+        // Wraps the given run() body in a script with outputs of all vector types
+        LuaScript* createScriptWithRunBody(std::string_view runBody)
+        {
+            return m_logicEngine.createLuaScriptFromSource(fmt::format(R"(
+                function interface()
+                    IN.vec3f = VEC3F
+                    IN.vec3i = VEC3I
+                    OUT.float = FLOAT
+                    OUT.vec2f = VEC2F
+                    OUT.vec3f = VEC3F
+                    OUT.vec4f = VEC4F
+                    OUT.vec3i = VEC3I
+                end
+
+                function run()
+                    {}
+                end
+            )", runBody));
+        }
+
+        const Property& output(const LuaScript& script, std::string_view name)
+        {
+            return *script.getOutputs()->getChild(name);
+        }
+
+        static constexpr float Epsilon = 1e-5f;
+    };
+
+    TEST_F(ALuaScript_Math, ConstructsVectorsFromNumbersTablesAndOtherVectors)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            local a = vec3(1, 2, 3)
+            local b = vec3({4, 5, 6})
+            local c = vec3(b)
+            local d = vec3(7)
+            local e = vec3()
+            assert(e.x == 0 and e.y == 0 and e.z == 0)
+            assert(#a == 3)
+            OUT.vec3f = a + c + d
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*output(*script, "vec3f").get<vec3f>(), ElementsAre(12.f, 14.f, 16.f));
+    }
+
+    TEST_F(ALuaScript_Math, ConstructsVectorsFromVectorProperties)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            OUT.vec3f = vec3(IN.vec3f) * 2 + vec3(IN.vec3i)
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(script->getInputs()->getChild("vec3f")->set<vec3f>({1.f, 2.f, 3.f}));
+        ASSERT_TRUE(script->getInputs()->getChild("vec3i")->set<vec3i>({1, 1, 1}));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*output(*script, "vec3f").get<vec3f>(), ElementsAre(3.f, 5.f, 7.f));
+    }
+
+    TEST_F(ALuaScript_Math, AccessesComponentsByNameAndIndex)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            local v = vec4(1, 2, 3, 4)
+            v.x = 10
+            v[4] = 40
+            OUT.float = v.y + v[3]
+            OUT.vec4f = v
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(5.f, *output(*script, "float").get<float>());
+        EXPECT_THAT(*output(*script, "vec4f").get<vec4f>(), ElementsAre(10.f, 2.f, 3.f, 40.f));
+    }
+
+    TEST_F(ALuaScript_Math, ComputesVectorOperations)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            local a = vec3(3, 0, 4)
+            assert(a:length() == 5)
+            assert(a:dot(vec3(1, 1, 1)) == 7)
+            assert(a:distance(vec3(3, 0, 0)) == 4)
+            assert(vec3(1, 0, 0):cross(vec3(0, 1, 0)) == vec3(0, 0, 1))
+            assert(-a == vec3(-3, 0, -4))
+            assert(a / 2 == vec3(1.5, 0, 2))
+            assert(vec2(0, 0):lerp(vec2(10, 20), 0.5) == vec2(5, 10))
+            assert(vec2(-5, 5):clamp(-1, 1) == vec2(-1, 1))
+            assert(tostring(vec2(1, 2)) == "vec2(1, 2)")
+            OUT.vec3f = a:normalize()
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*output(*script, "vec3f").get<vec3f>(), ElementsAre(FloatNear(0.6f, Epsilon), 0.f, FloatNear(0.8f, Epsilon)));
+    }
+
+    TEST_F(ALuaScript_Math, RotatesVectorsWithQuaternionsAndMatrices)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            local q = quat.fromAxisAngle(vec3(0, 0, 1), 90)
+            local m = mat4.translation(vec3(1, 2, 3)) * mat4.rotation(q)
+            OUT.vec3f = q * vec3(1, 0, 0)
+            OUT.vec2f = vec2(m:transformPoint(vec3(1, 0, 0)).x, m:transformDirection(vec3(1, 0, 0)).y)
+            OUT.vec4f = q:slerp(quat(), 1)
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*output(*script, "vec3f").get<vec3f>(), ElementsAre(FloatNear(0.f, Epsilon), FloatNear(1.f, Epsilon), FloatNear(0.f, Epsilon)));
+        EXPECT_THAT(*output(*script, "vec2f").get<vec2f>(), ElementsAre(FloatNear(1.f, Epsilon), FloatNear(1.f, Epsilon)));
+        EXPECT_THAT(*output(*script, "vec4f").get<vec4f>(), ElementsAre(FloatNear(0.f, Epsilon), FloatNear(0.f, Epsilon), FloatNear(0.f, Epsilon), FloatNear(1.f, Epsilon)));
+    }
+
+    TEST_F(ALuaScript_Math, AssignsVectorsToIntegerOutputsWithoutRounding)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            OUT.vec3i = vec3(1, 2, 3)
+        )");
+        ASSERT_NE(nullptr, script);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*output(*script, "vec3i").get<vec3i>(), ElementsAre(1, 2, 3));
+    }
+
+    TEST_F(ALuaScript_Math, ReportsErrorWhenAssigningVectorWhichNeedsRoundingToIntegerOutput)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            OUT.vec3i = vec3(1, 2.5, 3)
+        )");
+        ASSERT_NE(nullptr, script);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr("Implicit rounding during assignment of integer output 'vec3i' (value: 2.5)!"));
+    }
+
+    TEST_F(ALuaScript_Math, ReportsErrorWhenAssigningVectorOfWrongSize)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            OUT.vec3f = vec2(1, 2)
+        )");
+        ASSERT_NE(nullptr, script);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr("Type mismatch while assigning property 'vec3f'! Expected VEC3F but received vec2"));
+    }
+
+    TEST_F(ALuaScript_Math, ReportsErrorWhenAssigningMatrixToProperty)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            OUT.vec4f = mat4()
+        )");
+        ASSERT_NE(nullptr, script);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr("Can't assign mat4 to property 'vec4f'!"));
+    }
+
+    TEST_F(ALuaScript_Math, ReportsErrorWhenAssigningVectorToInput)
+    {
+        LuaScript* script = createScriptWithRunBody(R"(
+            IN.vec3f = vec3(1, 2, 3)
+        )");
+        ASSERT_NE(nullptr, script);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr("Error while writing to 'vec3f'. Writing input values is not allowed, only outputs!"));
+    }
+
+    TEST_F(ALuaScript_Math, ReportsErrorForInvalidConstructorArgumentsAndIndices)
+    {
+        const std::vector<LuaTestError> errorCases = {
+            {"vec3(1, 2)", "vec3: expected 3 numbers but received 2 arguments!"},
+            {"vec3('text')", "vec3: can't construct from argument of type string!"},
+            {"quat(1)", "quat: can't construct from argument of type number!"},
+            {"local x = vec2(1, 2)[3]", "vec2: index out of range! Expected 0 < index <= 2 but received index == 3"},
+            {"local x = vec2(1, 2).z", "vec2: unknown field!"},
+        };
+
+        for (const auto& errorCase : errorCases)
+        {
+            LuaScript* script = createScriptWithRunBody(errorCase.errorCode);
+            ASSERT_NE(nullptr, script);
+            EXPECT_FALSE(m_logicEngine.update(true));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_THAT(m_logicEngine.getErrors()[0].message, HasSubstr(errorCase.expectedErrorMessage));
+            ASSERT_TRUE(m_logicEngine.destroy(*script));
+        }
+    }
+}
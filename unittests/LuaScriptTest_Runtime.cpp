@@ -1850,4 +1850,67 @@ namespace rlogic
         EXPECT_EQ("Lua", *script->getOutputs()->getChild("language_of_debug_func")->get<std::string>());
     }
 
+    TEST_F(ALuaScript_Runtime, ReusesPropertyObjectsOfNestedPropertiesBetweenAccesses)
+    {
+        auto script = m_logicEngine.createLuaScriptFromSource(R"(
+            function interface()
+                IN.struct = {nested = {value = INT}, vec = VEC2I}
+                IN.array = ARRAY(2, VEC3F)
+                OUT.sameStruct = BOOL
+                OUT.sameArrayElement = BOOL
+                OUT.value = INT
+                OUT.vecSum = INT
+            end
+            function run()
+                OUT.sameStruct = rawequal(IN.struct.nested, IN.struct.nested)
+                OUT.sameArrayElement = rawequal(IN.array[2], IN.array[2])
+                OUT.value = IN.struct.nested.value
+                OUT.vecSum = IN.struct.vec[1] + IN.struct.vec[2]
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(*script->getOutputs()->getChild("sameStruct")->get<bool>());
+        EXPECT_TRUE(*script->getOutputs()->getChild("sameArrayElement")->get<bool>());
+        EXPECT_EQ(0, *script->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(0, *script->getOutputs()->getChild("vecSum")->get<int32_t>());
+
+        // Cached property objects read the current values
+        Property* structInput = script->getInputs()->getChild("struct");
+        ASSERT_TRUE(structInput->getChild("nested")->getChild("value")->set<int32_t>(42));
+        ASSERT_TRUE(structInput->getChild("vec")->set<vec2i>({1, 2}));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *script->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(3, *script->getOutputs()->getChild("vecSum")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Runtime, AccessesFieldsOfLargeStructsByName)
+    {
+        std::string interfaceFields;
+        std::string sumExpression = "0";
+        for (int i = 0; i < 64; ++i)
+        {
+            interfaceFields += fmt::format("IN.field{} = INT\n", i);
+            sumExpression += fmt::format(" + IN.field{}", i);
+        }
+
+        auto script = m_logicEngine.createLuaScriptFromSource(fmt::format(R"(
+            function interface()
+                {}
+                OUT.sum = INT
+            end
+            function run()
+                OUT.sum = {}
+            end
+        )", interfaceFields, sumExpression));
+        ASSERT_NE(nullptr, script);
+
+        for (int i = 0; i < 64; ++i)
+        {
+            ASSERT_TRUE(script->getInputs()->getChild(fmt::format("field{}", i))->set<int32_t>(i));
+        }
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2016, *script->getOutputs()->getChild("sum")->get<int32_t>());
+    }
 }
@@ -60,17 +60,18 @@ namespace rlogic::internal
         EXPECT_EQ(serializedScript.name()->string_view(), "name");
 
         ASSERT_TRUE(serializedScript.rootInput());
-        EXPECT_EQ(serializedScript.rootInput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedScript.rootInput()->children());
-        EXPECT_EQ(serializedScript.rootInput()->children()->size(), 0u);
+        ASSERT_TRUE(serializedScript.rootInput()->records());
+        EXPECT_EQ(serializedScript.rootInput()->records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serializedScript.rootInput()->records()->Get(0)->childCount(), 0u);
 
         ASSERT_TRUE(serializedScript.rootOutput());
-        EXPECT_EQ(serializedScript.rootOutput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedScript.rootOutput()->children());
-        EXPECT_EQ(serializedScript.rootOutput()->children()->size(), 0u);
+        ASSERT_TRUE(serializedScript.rootOutput()->records());
+        EXPECT_EQ(serializedScript.rootOutput()->records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serializedScript.rootOutput()->records()->Get(0)->childCount(), 0u);
 
         // Deserialize
         {
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(m_solState, serializedScript, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedScript);
@@ -92,6 +93,7 @@ namespace rlogic::internal
         EXPECT_EQ(serializedScript.filename()->string_view(), "filename");
 
         {
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(m_solState, serializedScript, m_errorReporting, m_deserializationMap);
             EXPECT_EQ(deserializedScript->getFilename(), "filename");
         }
@@ -202,6 +204,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -217,18 +220,19 @@ namespace rlogic::internal
                 m_flatBufferBuilder.CreateString("name"),
                 m_flatBufferBuilder.CreateString("some/file.lua"),
                 m_flatBufferBuilder.CreateString("lua source code"),
-                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyRootType::Struct, true, true), // create root input with errors
+                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyType::Struct, true, true), // create root input with errors
                 m_testUtils.serializeTestProperty("OUT")
             );
             m_flatBufferBuilder.Finish(script);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(ALuaScript_Serialization, ProducesErrorWhenRootOutputHasErrors)
@@ -240,17 +244,18 @@ namespace rlogic::internal
                 m_flatBufferBuilder.CreateString("some/file.lua"),
                 m_flatBufferBuilder.CreateString("lua source code"),
                 m_testUtils.serializeTestProperty("IN"),
-                m_testUtils.serializeTestProperty("OUT", rlogic_serialization::EPropertyRootType::Struct, true, true) // create root output with errors
+                m_testUtils.serializeTestProperty("OUT", rlogic_serialization::EPropertyType::Struct, true, true) // create root output with errors
             );
             m_flatBufferBuilder.Finish(script);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(ALuaScript_Serialization, ProducesErrorWhenLuaScriptSourceHasSyntaxErrors)
@@ -268,6 +273,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -290,6 +296,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -297,4 +304,113 @@ namespace rlogic::internal
         EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Fatal error during loading of LuaScript 'script' from serialized data: failed executing script"));
         EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("This is not going to compile"));
     }
+
+    TEST_F(ALuaScript_Serialization, DefersCompilation_WhenRequested)
+    {
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("script"),
+                m_flatBufferBuilder.CreateString("some/file.lua"),
+                m_flatBufferBuilder.CreateString(m_minimalScript.data(), m_minimalScript.size()),
+                m_testUtils.serializeTestProperty("IN"),
+                m_testUtils.serializeTestProperty("OUT")
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, true);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+        EXPECT_FALSE(deserialized->isCompiled());
+        ASSERT_NE(nullptr, deserialized->getInputs());
+        ASSERT_NE(nullptr, deserialized->getOutputs());
+
+        EXPECT_FALSE(deserialized->compile().has_value());
+        EXPECT_TRUE(deserialized->isCompiled());
+        EXPECT_FALSE(deserialized->update().has_value());
+    }
+
+    TEST_F(ALuaScript_Serialization, CompilesOnFirstUpdate_WhenCompilationWasDeferred)
+    {
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("script"),
+                m_flatBufferBuilder.CreateString("some/file.lua"),
+                m_flatBufferBuilder.CreateString(m_minimalScript.data(), m_minimalScript.size()),
+                m_testUtils.serializeTestProperty("IN"),
+                m_testUtils.serializeTestProperty("OUT")
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, true);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_FALSE(deserialized->update().has_value());
+        EXPECT_TRUE(deserialized->isCompiled());
+    }
+
+    TEST_F(ALuaScript_Serialization, ReportsSyntaxErrorsOnCompilation_WhenCompilationWasDeferred)
+    {
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("script"),
+                m_flatBufferBuilder.CreateString("some/file.lua"),
+                m_flatBufferBuilder.CreateString("this.is.bad.code"),
+                m_testUtils.serializeTestProperty("IN"),
+                m_testUtils.serializeTestProperty("OUT")
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, true);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        const std::optional<std::string> compileError = deserialized->compile();
+        ASSERT_TRUE(compileError);
+        EXPECT_THAT(*compileError, ::testing::HasSubstr("Failed to compile LuaScript 'script': failed parsing Lua source code"));
+        EXPECT_FALSE(deserialized->isCompiled());
+
+        const std::optional<LogicNodeRuntimeError> updateError = deserialized->update();
+        ASSERT_TRUE(updateError);
+        EXPECT_THAT(updateError->message, ::testing::HasSubstr("Failed to compile LuaScript 'script': failed parsing Lua source code"));
+    }
+
+    TEST_F(ALuaScript_Serialization, ReportsRuntimeErrorsOnCompilation_WhenCompilationWasDeferred)
+    {
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("script"),
+                m_flatBufferBuilder.CreateString("some/file.lua"),
+                m_flatBufferBuilder.CreateString("error('This is not going to compile')"),
+                m_testUtils.serializeTestProperty("IN"),
+                m_testUtils.serializeTestProperty("OUT")
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, true);
+
+        ASSERT_TRUE(deserialized);
+        const std::optional<std::string> compileError = deserialized->compile();
+        ASSERT_TRUE(compileError);
+        EXPECT_THAT(*compileError, ::testing::HasSubstr("failed executing script"));
+        EXPECT_THAT(*compileError, ::testing::HasSubstr("This is not going to compile"));
+        EXPECT_FALSE(deserialized->isCompiled());
+    }
 }
@@ -22,6 +22,7 @@
 
 #include "LogicNodeDummy.h"
 #include "LogTestUtils.h"
+#include "SerializationTestUtils.h"
 
 #include <memory>
 
@@ -563,6 +564,40 @@ namespace rlogic::internal
     class AProperty_SerializationLifecycle : public AProperty
     {
     protected:
+        std::unique_ptr<PropertyImpl> deserializeSerializedProperty()
+        {
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
+            return PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        }
+
+        // Deserializes hand-crafted test data, the string table contains the strings "name" and "child"
+        std::unique_ptr<PropertyImpl> deserializeTestData(
+            const std::vector<rlogic_serialization::PropertyRecord>& records,
+            const std::vector<float>& floatValues = {},
+            const std::vector<uint32_t>& stringValues = {})
+        {
+            auto propertyTree = rlogic_serialization::CreatePropertyTree(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateVectorOfStructs(records),
+                floatValues.empty() ? 0 : m_flatBufferBuilder.CreateVector(floatValues),
+                0,
+                0,
+                stringValues.empty() ? 0 : m_flatBufferBuilder.CreateVector(stringValues)
+            );
+            m_flatBufferBuilder.Finish(propertyTree);
+
+            m_deserializationMap.storeStrings({ "name", "child" });
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
+            return PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        }
+
+        void expectSingleError(std::string_view message)
+        {
+            ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+            EXPECT_EQ(m_errorReporting.getErrors()[0].message, message);
+        }
+
         ErrorReporting m_errorReporting;
         flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
         SerializationMap m_serializationMap;
@@ -576,13 +611,15 @@ namespace rlogic::internal
             (void)PropertyImpl::Serialize(structNoChildren, m_flatBufferBuilder, m_serializationMap);
         }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
 
-        EXPECT_EQ(serialized.name()->string_view(), "noChildren");
-        EXPECT_EQ(serialized.children()->size(), 0u);
+        ASSERT_EQ(serialized.records()->size(), 1u);
+        EXPECT_EQ(serialized.records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serialized.records()->Get(0)->childCount(), 0u);
+        EXPECT_EQ(m_serializationMap.getStrings()[serialized.records()->Get(0)->nameIndex()], "noChildren");
 
         {
-            std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+            std::unique_ptr<PropertyImpl> deserialized = deserializeSerializedProperty();
             ASSERT_EQ(0u, deserialized->getChildCount());
             EXPECT_EQ(EPropertyType::Struct, deserialized->getType());
             EXPECT_EQ("noChildren", deserialized->getName());
@@ -601,8 +638,7 @@ namespace rlogic::internal
             (void)PropertyImpl::Serialize(*parent, m_flatBufferBuilder, m_serializationMap);
         }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<PropertyImpl> deserialized = deserializeSerializedProperty();
 
         ASSERT_EQ(3u, deserialized->getChildCount());
         EXPECT_EQ(EPropertyType::Struct, deserialized->getType());
@@ -629,8 +665,7 @@ namespace rlogic::internal
             (void)PropertyImpl::Serialize(*root, m_flatBufferBuilder, m_serializationMap);
         }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<PropertyImpl> deserialized = deserializeSerializedProperty();
 
         ASSERT_EQ(1u, deserialized->getChildCount());
         EXPECT_EQ(EPropertyType::Struct, deserialized->getType());
@@ -655,6 +690,88 @@ namespace rlogic::internal
         EXPECT_EQ("float", propertyFloat2->getName());
     }
 
+    TEST_F(AProperty_SerializationLifecycle, StoresChildrenNextToEachOther_AfterTheirParent)
+    {
+        {
+            auto root = CreateInputProperty("root", EPropertyType::Struct);
+            auto nested = CreateInputProperty("nested", EPropertyType::Struct, false);
+            nested->addChild(CreateInputProperty("x", EPropertyType::Float, false));
+            nested->addChild(CreateInputProperty("y", EPropertyType::Float, false));
+            root->addChild(std::move(nested));
+            root->addChild(CreateInputProperty("z", EPropertyType::Float, false));
+
+            (void)PropertyImpl::Serialize(*root, m_flatBufferBuilder, m_serializationMap);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
+        const auto& records = *serialized.records();
+        const auto& strings = m_serializationMap.getStrings();
+
+        // root, nested, z, nested.x, nested.y
+        ASSERT_EQ(records.size(), 5u);
+        EXPECT_EQ(strings[records.Get(0)->nameIndex()], "root");
+        EXPECT_EQ(records.Get(0)->dataIndex(), 1u);
+        EXPECT_EQ(records.Get(0)->childCount(), 2u);
+        EXPECT_EQ(strings[records.Get(1)->nameIndex()], "nested");
+        EXPECT_EQ(records.Get(1)->dataIndex(), 3u);
+        EXPECT_EQ(records.Get(1)->childCount(), 2u);
+        EXPECT_EQ(strings[records.Get(2)->nameIndex()], "z");
+        EXPECT_EQ(strings[records.Get(3)->nameIndex()], "x");
+        EXPECT_EQ(strings[records.Get(4)->nameIndex()], "y");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle, StoresEqualNamesAndStringValuesOnlyOnce)
+    {
+        {
+            auto root = CreateInputProperty("root", EPropertyType::Array);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                auto element = CreateInputProperty("", EPropertyType::Struct, false);
+                auto value = CreateInputProperty("value", EPropertyType::String, false);
+                value->setValue(std::string("value"));
+                element->addChild(std::move(value));
+                root->addChild(std::move(element));
+            }
+
+            (void)PropertyImpl::Serialize(*root, m_flatBufferBuilder, m_serializationMap);
+        }
+
+        EXPECT_EQ(m_serializationMap.getStrings(), (std::vector<std::string>{"root", "", "value"}));
+
+        std::unique_ptr<PropertyImpl> deserialized = deserializeSerializedProperty();
+        ASSERT_EQ(3u, deserialized->getChildCount());
+        for (size_t i = 0; i < 3; ++i)
+        {
+            EXPECT_EQ("", deserialized->getChild(i)->getName());
+            EXPECT_EQ("value", *deserialized->getChild(i)->getChild(0)->get<std::string>());
+        }
+    }
+
+    TEST_F(AProperty_SerializationLifecycle, StoresValuesInOneVectorPerComponentType)
+    {
+        {
+            auto root = CreateInputProperty("root", EPropertyType::Struct);
+            root->addChild(CreateInputProperty("vec3f", EPropertyType::Vec3f, false));
+            root->addChild(CreateInputProperty("float", EPropertyType::Float, false));
+            root->addChild(CreateInputProperty("vec2i", EPropertyType::Vec2i, false));
+
+            (void)PropertyImpl::Serialize(*root, m_flatBufferBuilder, m_serializationMap);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
+        ASSERT_TRUE(serialized.floatValues());
+        EXPECT_EQ(serialized.floatValues()->size(), 4u);
+        ASSERT_TRUE(serialized.intValues());
+        EXPECT_EQ(serialized.intValues()->size(), 2u);
+        // Unused value vectors are not stored
+        EXPECT_FALSE(serialized.boolValues());
+        EXPECT_FALSE(serialized.stringValues());
+
+        EXPECT_EQ(serialized.records()->Get(1)->dataIndex(), 0u);
+        EXPECT_EQ(serialized.records()->Get(2)->dataIndex(), 3u);
+        EXPECT_EQ(serialized.records()->Get(3)->dataIndex(), 0u);
+    }
+
     // Making this test templated makes it a lot harder to read, better leave it so - simple, stupid
     TEST_F(AProperty_SerializationLifecycle, AllSupportedPropertyTypes)
     {
@@ -698,8 +815,7 @@ namespace rlogic::internal
             (void)PropertyImpl::Serialize(*rootImpl, m_flatBufferBuilder, m_serializationMap);
         }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<PropertyImpl> deserialized = deserializeSerializedProperty();
 
         ASSERT_EQ(11u, deserialized->getChildCount());
         EXPECT_EQ(EPropertyType::Struct, deserialized->getType());
@@ -747,184 +863,136 @@ namespace rlogic::internal
         EXPECT_FALSE(propDefValue->m_impl->checkForBindingInputNewValueAndReset());
     }
 
-    TEST_F(AProperty_SerializationLifecycle, ErrorWhenNameMissing)
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenRecordsMissing)
     {
         {
-            auto propertyOffset = rlogic_serialization::CreateProperty(
+            auto propertyTree = rlogic_serialization::CreatePropertyTree(
                 m_flatBufferBuilder,
                 0
             );
-            m_flatBufferBuilder.Finish(propertyOffset);
+            m_flatBufferBuilder.Finish(propertyTree);
         }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::PropertyTree>(m_flatBufferBuilder.GetBufferPointer());
         std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
-        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        expectSingleError("Fatal error during loading of Property from serialized data: missing property records!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenRecordsEmpty)
+    {
+        EXPECT_FALSE(deserializeTestData({}));
+        expectSingleError("Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(AProperty_SerializationLifecycle, ErrorWhenTypeCorrupted)
     {
-        {
-            // Simulate bad things with enums, but this can happen with corrupted binary data and we need to handle it safely nevertheless
-            auto invalidType = static_cast<rlogic_serialization::EPropertyRootType>(std::numeric_limits<uint8_t>::max());
-            auto propertyOffset = rlogic_serialization::CreateProperty(
-                m_flatBufferBuilder,
-                m_flatBufferBuilder.CreateString("name"),
-                invalidType
-            );
-            m_flatBufferBuilder.Finish(propertyOffset);
-        }
+        // Simulate bad things with enums, but this can happen with corrupted binary data and we need to handle it safely nevertheless
+        const auto invalidType = static_cast<rlogic_serialization::EPropertyType>(std::numeric_limits<uint8_t>::max());
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        EXPECT_FALSE(deserializeTestData({ {invalidType, 0u, 0u, 0u} }));
+        expectSingleError("Fatal error during loading of Property from serialized data: invalid type!");
+    }
 
-        EXPECT_FALSE(deserialized);
-        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: invalid type!");
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenNameIndexInvalid)
+    {
+        EXPECT_FALSE(deserializeTestData({ {rlogic_serialization::EPropertyType::Struct, 2u, 0u, 0u} }));
+        expectSingleError("Fatal error during loading of Property from serialized data: invalid name index!");
     }
 
     TEST_F(AProperty_SerializationLifecycle, ErrorWhenChildHasErrors)
     {
-        {
-            // Child is invalid because it has no name
-            auto childOffset = rlogic_serialization::CreateProperty(
-                m_flatBufferBuilder,
-                0
-            );
-            // Parent is fine, but references a corrupt child property
-            auto propertyOffset = rlogic_serialization::CreateProperty(
-                m_flatBufferBuilder,
-                m_flatBufferBuilder.CreateString("name"),
-                rlogic_serialization::EPropertyRootType::Struct,
-                m_flatBufferBuilder.CreateVector(std::vector{childOffset})
-            );
-            m_flatBufferBuilder.Finish(propertyOffset);
-        }
-
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        EXPECT_FALSE(deserializeTestData({
+            {rlogic_serialization::EPropertyType::Struct, 0u, 1u, 1u},
+            {rlogic_serialization::EPropertyType::Float, 42u, 0u, 0u} // child has invalid name index
+            }, { 0.f }));
+        expectSingleError("Fatal error during loading of Property from serialized data: invalid name index!");
+    }
 
-        EXPECT_FALSE(deserialized);
-        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenChildRangeExceedsRecords)
+    {
+        EXPECT_FALSE(deserializeTestData({
+            {rlogic_serialization::EPropertyType::Struct, 0u, 1u, 2u},
+            {rlogic_serialization::EPropertyType::Float, 1u, 0u, 0u}
+            }, { 0.f }));
+        expectSingleError("Fatal error during loading of Property from serialized data: corrupt child data!");
     }
 
-    TEST_F(AProperty_SerializationLifecycle, ErrorWhenComplexTypeHasNoChildInfo)
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenChildIsStoredBeforeItsParent)
     {
-        {
-            // Parent is fine, but references a corrupt child property
-            auto propertyOffset = rlogic_serialization::CreateProperty(
-                m_flatBufferBuilder,
-                m_flatBufferBuilder.CreateString("name"),
-                rlogic_serialization::EPropertyRootType::Struct,
-                0
-            );
-            m_flatBufferBuilder.Finish(propertyOffset);
-        }
+        // Would reference itself as child
+        EXPECT_FALSE(deserializeTestData({ {rlogic_serialization::EPropertyType::Struct, 0u, 0u, 1u} }));
+        expectSingleError("Fatal error during loading of Property from serialized data: corrupt child data!");
+    }
 
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenChildIsReferencedByTwoParents)
+    {
+        EXPECT_FALSE(deserializeTestData({
+            {rlogic_serialization::EPropertyType::Struct, 0u, 1u, 2u},
+            {rlogic_serialization::EPropertyType::Struct, 1u, 2u, 1u},
+            {rlogic_serialization::EPropertyType::Float, 1u, 0u, 0u}
+            }, { 0.f }));
+        expectSingleError("Fatal error during loading of Property from serialized data: corrupt child data!");
+    }
 
-        EXPECT_FALSE(deserialized);
-        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: complex type has no child type info!");
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenRecordIsNotReferencedByAnyParent)
+    {
+        EXPECT_FALSE(deserializeTestData({
+            {rlogic_serialization::EPropertyType::Struct, 0u, 0u, 0u},
+            {rlogic_serialization::EPropertyType::Float, 1u, 0u, 0u}
+            }, { 0.f }));
+        expectSingleError("Fatal error during loading of Property from serialized data: corrupt child data!");
     }
 
-    TEST_F(AProperty_SerializationLifecycle, ErrorWhenMissingValueForPrimitiveType_AllUnionTypes)
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenValuesMissing_AllPrimitiveTypes)
     {
-        // A bit ugly, but simple way to iterate all enum values
-        for (rlogic_serialization::PropertyValue valueType = rlogic_serialization::PropertyValue::float_s; valueType <= rlogic_serialization::PropertyValue::MAX; valueType = rlogic_serialization::PropertyValue(uint32_t(valueType) + 1))
+        for (auto type : {
+            rlogic_serialization::EPropertyType::Float,
+            rlogic_serialization::EPropertyType::Vec2f,
+            rlogic_serialization::EPropertyType::Vec3f,
+            rlogic_serialization::EPropertyType::Vec4f,
+            rlogic_serialization::EPropertyType::Int32,
+            rlogic_serialization::EPropertyType::Vec2i,
+            rlogic_serialization::EPropertyType::Vec3i,
+            rlogic_serialization::EPropertyType::Vec4i,
+            rlogic_serialization::EPropertyType::String,
+            rlogic_serialization::EPropertyType::Bool })
         {
-            {
-                auto propertyOffset = rlogic_serialization::CreateProperty(
-                    m_flatBufferBuilder,
-                    m_flatBufferBuilder.CreateString("name"),
-                    rlogic_serialization::EPropertyRootType::Primitive,
-                    0,
-                    valueType,
-                    0 // no union value type provided -> error when deserialized
-                );
-                m_flatBufferBuilder.Finish(propertyOffset);
-            }
-
-            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
             m_errorReporting.clear();
-            std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
-
-            EXPECT_FALSE(deserialized);
-            ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-            EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: invalid union!");
+            EXPECT_FALSE(deserializeTestData({ {type, 0u, 0u, 0u} }));
+            expectSingleError("Fatal error during loading of Property from serialized data: invalid value index!");
         }
     }
 
-    // String requires individual test, other types are tested below in AProperty_SerializationLifecycle_T
-    TEST_F(AProperty_SerializationLifecycle, ErrorWhenPrimitiveValueIsCorrupt_String)
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenValueIndexExceedsValues)
     {
-        {
-            auto propertyOffset = rlogic_serialization::CreateProperty(
-                m_flatBufferBuilder,
-                m_flatBufferBuilder.CreateString("name"),
-                rlogic_serialization::EPropertyRootType::Primitive,
-                0,
-                rlogic_serialization::PropertyValue::NONE, // setting NONE here makes the enum tuple invalid and would trigger seg fault if not checked
-                m_flatBufferBuilder.CreateStruct(m_flatBufferBuilder.CreateString("test string")).Union()
-            );
-            m_flatBufferBuilder.Finish(propertyOffset);
-        }
-
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
-
-        EXPECT_FALSE(deserialized);
-        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: invalid type!");
+        EXPECT_FALSE(deserializeTestData({ {rlogic_serialization::EPropertyType::Vec4f, 0u, 0u, 0u} }, { 1.f, 2.f, 3.f }));
+        expectSingleError("Fatal error during loading of Property from serialized data: invalid value index!");
     }
 
-    // two element type
-    template <typename T>
-    class AProperty_SerializationLifecycle_T : public AProperty_SerializationLifecycle
-    {
-    };
-    // The list of types we want to test.
-    typedef ::testing::Types <
-        rlogic_serialization::float_s,
-        rlogic_serialization::vec2f_s,
-        rlogic_serialization::vec3f_s,
-        rlogic_serialization::vec4f_s,
-        rlogic_serialization::int32_s,
-        rlogic_serialization::vec2i_s,
-        rlogic_serialization::vec3i_s,
-        rlogic_serialization::vec4i_s,
-        rlogic_serialization::bool_s
-        //string_s requires a separate test because it's not a struct but a table, see below
-    > ValueTypes;
-
-    TYPED_TEST_SUITE(AProperty_SerializationLifecycle_T, ValueTypes);
-
-    TYPED_TEST(AProperty_SerializationLifecycle_T, ErrorWhenPrimitiveValueIsCorrupt)
+    TEST_F(AProperty_SerializationLifecycle, ErrorWhenStringValueHasInvalidStringIndex)
     {
-        {
-            const TypeParam unionValue; // data doesn't matter, just use default constructor for simplicity
-            auto propertyOffset = rlogic_serialization::CreateProperty(
-                this->m_flatBufferBuilder,
-                this->m_flatBufferBuilder.CreateString("name"),
-                rlogic_serialization::EPropertyRootType::Primitive,
-                0,
-                rlogic_serialization::PropertyValue::NONE, // setting NONE here makes the enum tuple invalid and would trigger seg fault if not checked
-                this->m_flatBufferBuilder.CreateStruct(unionValue).Union()
-            );
-            this->m_flatBufferBuilder.Finish(propertyOffset);
-        }
-
-        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(this->m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, this->m_errorReporting, this->m_deserializationMap);
+        EXPECT_FALSE(deserializeTestData({ {rlogic_serialization::EPropertyType::String, 0u, 0u, 0u} }, {}, { 42u }));
+        expectSingleError("Fatal error during loading of Property from serialized data: invalid value index!");
+    }
 
-        EXPECT_FALSE(deserialized);
-        ASSERT_EQ(this->m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(this->m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: invalid type!");
+    TEST_F(AProperty_SerializationLifecycle, LoadsHandCraftedData)
+    {
+        std::unique_ptr<PropertyImpl> deserialized = deserializeTestData({
+            {rlogic_serialization::EPropertyType::Struct, 0u, 1u, 2u},
+            {rlogic_serialization::EPropertyType::Vec2f, 1u, 0u, 0u},
+            {rlogic_serialization::EPropertyType::String, 0u, 0u, 0u}
+            }, { 1.f, 2.f }, { 1u });
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+        EXPECT_EQ("name", deserialized->getName());
+        ASSERT_EQ(2u, deserialized->getChildCount());
+        EXPECT_EQ("child", deserialized->getChild(0)->getName());
+        EXPECT_EQ(vec2f({ 1.f, 2.f }), *deserialized->getChild(0)->get<vec2f>());
+        EXPECT_EQ("name", deserialized->getChild(1)->getName());
+        EXPECT_EQ("child", *deserialized->getChild(1)->get<std::string>());
     }
 
     // TODO Violin restructure tests and move in fixtures for better readibility
@@ -995,4 +1063,37 @@ namespace rlogic::internal
         EXPECT_TRUE(vec3iProperty->getLogicNode().isDirty());
         EXPECT_TRUE(stringProperty->getLogicNode().isDirty());
     }
+
+    TEST_F(AProperty, IncreasesChangeVersionOnlyIfInputValueIsChanged)
+    {
+        auto stringProperty = CreateInputProperty("Property", EPropertyType::String);
+        EXPECT_EQ(0u, stringProperty->getChangeVersion());
+
+        stringProperty->setValue(std::string("42"));
+        EXPECT_EQ(1u, stringProperty->getChangeVersion());
+
+        stringProperty->setValue(std::string("42"));
+        EXPECT_EQ(1u, stringProperty->getChangeVersion());
+
+        stringProperty->restoreSnapshotValue(std::string("42"), false);
+        EXPECT_EQ(1u, stringProperty->getChangeVersion());
+
+        stringProperty->restoreSnapshotValue(std::string("43"), false);
+        EXPECT_EQ(2u, stringProperty->getChangeVersion());
+    }
+
+    TEST_F(AProperty, IncreasesChangeVersionOnlyIfOutputValueIsChanged)
+    {
+        auto floatProperty = CreateOutputProperty("Property", EPropertyType::Float);
+        EXPECT_EQ(0u, floatProperty->getChangeVersion());
+
+        floatProperty->setOutputValue_FromScript(1.f);
+        EXPECT_EQ(1u, floatProperty->getChangeVersion());
+
+        floatProperty->setOutputValue_FromScript(1.f);
+        EXPECT_EQ(1u, floatProperty->getChangeVersion());
+
+        floatProperty->setOutputValue_FromScript(2.f);
+        EXPECT_EQ(2u, floatProperty->getChangeVersion());
+    }
 }
@@ -86,13 +86,14 @@ namespace rlogic::internal
         EXPECT_EQ(serializedBinding.base()->name()->string_view(), "name");
 
         ASSERT_TRUE(serializedBinding.base()->rootInput());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedBinding.base()->rootInput()->children());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->children()->size(), 1u);
+        ASSERT_TRUE(serializedBinding.base()->rootInput()->records());
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->childCount(), 1u);
 
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("name"), m_appearance->getSceneObjectId())).WillOnce(::testing::Return(m_appearance));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesAppearanceBindingImpl> deserializedBinding = RamsesAppearanceBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -121,6 +122,7 @@ namespace rlogic::internal
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("name"), m_appearance->getSceneObjectId())).WillOnce(::testing::Return(m_appearance));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesAppearanceBindingImpl> deserializedBinding = RamsesAppearanceBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -219,6 +221,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("name"), mockObjectId)).WillOnce(::testing::Return(nullptr));
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesAppearanceBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesAppearanceBindingImpl> deserialized = RamsesAppearanceBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -231,7 +234,7 @@ namespace rlogic::internal
                 m_flatBufferBuilder,
                 m_flatBufferBuilder.CreateString("name"),
                 0,
-                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyRootType::Struct, false, true) // rootInput with errors
+                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyType::Struct, false, true) // rootInput with errors
             );
             auto binding = rlogic_serialization::CreateRamsesAppearanceBinding(
                 m_flatBufferBuilder,
@@ -241,11 +244,12 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesAppearanceBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesAppearanceBindingImpl> deserialized = RamsesAppearanceBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(ARamsesAppearanceBinding_SerializationLifecycle, ReportsErrorWhenDeserializedWithDifferentAppearanceThenDuringSerialization)
@@ -284,6 +288,7 @@ namespace rlogic::internal
         // Deserialize with different appearance -> expect errors
         {
             EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("name"), m_appearance->getSceneObjectId())).WillOnce(::testing::Return(&differentAppearance));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesAppearanceBindingImpl> deserializedBinding = RamsesAppearanceBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             EXPECT_FALSE(deserializedBinding);
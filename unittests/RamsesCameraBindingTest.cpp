@@ -757,13 +757,14 @@ namespace rlogic::internal
         EXPECT_EQ(serializedBinding.base()->name()->string_view(), "name");
 
         ASSERT_TRUE(serializedBinding.base()->rootInput());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedBinding.base()->rootInput()->children());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->children()->size(), 2u);
+        ASSERT_TRUE(serializedBinding.base()->rootInput()->records());
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->childCount(), 2u);
 
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("name"), m_camera->getSceneObjectId())).WillOnce(::testing::Return(m_camera));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesCameraBindingImpl> deserializedBinding = RamsesCameraBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -792,6 +793,7 @@ namespace rlogic::internal
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("name"), m_camera->getSceneObjectId())).WillOnce(::testing::Return(m_camera));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesCameraBindingImpl> deserializedBinding = RamsesCameraBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -869,7 +871,7 @@ namespace rlogic::internal
                 m_flatBufferBuilder,
                 m_flatBufferBuilder.CreateString("name"),
                 0,
-                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyRootType::Struct, false, true) // rootInput with errors
+                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyType::Struct, false, true) // rootInput with errors
             );
             auto binding = rlogic_serialization::CreateRamsesCameraBinding(
                 m_flatBufferBuilder,
@@ -879,11 +881,12 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesCameraBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesCameraBindingImpl> deserialized = RamsesCameraBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(ARamsesCameraBinding_SerializationLifecycle, ErrorWhenBoundCameraCannotBeResolved)
@@ -910,6 +913,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("name"), mockObjectId)).WillOnce(::testing::Return(nullptr));
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesCameraBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesCameraBindingImpl> deserialized = RamsesCameraBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -945,6 +949,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("name"), mockObjectId)).WillOnce(::testing::Return(perspCamera));
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesCameraBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesCameraBindingImpl> deserialized = RamsesCameraBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -1392,15 +1397,13 @@ namespace rlogic::internal
         // Does not touch the frustum because not linked or set at all
         ExpectDefaultPerspectiveCameraFrustumValues(m_perspectiveCam);
 
-        // TODO Violin investigate this... There is some problem with dirty handling which causes links to always
-        // re-apply their values, even if nothing changed in the script or in the binding -> this is inefficient
-        // As long as link is active, binding overwrites value which was manually set directly to the ramses camera
+        // Link only propagates values when the script output changed, values which were manually set directly to the ramses camera are not overwritten
         m_perspectiveCam.setViewport(9, 8, 1u, 2u);
         m_logicEngine.update();
-        EXPECT_EQ(m_perspectiveCam.getViewportX(), 15);
-        EXPECT_EQ(m_perspectiveCam.getViewportY(), 12);
-        EXPECT_EQ(m_perspectiveCam.getViewportWidth(), 13u);
-        EXPECT_EQ(m_perspectiveCam.getViewportHeight(), 14u);
+        EXPECT_EQ(m_perspectiveCam.getViewportX(), 9);
+        EXPECT_EQ(m_perspectiveCam.getViewportY(), 8);
+        EXPECT_EQ(m_perspectiveCam.getViewportWidth(), 1u);
+        EXPECT_EQ(m_perspectiveCam.getViewportHeight(), 2u);
         ExpectDefaultPerspectiveCameraFrustumValues(m_perspectiveCam);
 
         // Remove link -> value is not overwritten any more
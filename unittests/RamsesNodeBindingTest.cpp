@@ -384,13 +384,14 @@ namespace rlogic::internal
         EXPECT_EQ(serializedBinding.base()->name()->string_view(), "name");
 
         ASSERT_TRUE(serializedBinding.base()->rootInput());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedBinding.base()->rootInput()->children());
-        EXPECT_EQ(serializedBinding.base()->rootInput()->children()->size(), 4u);
+        ASSERT_TRUE(serializedBinding.base()->rootInput()->records());
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->type(), rlogic_serialization::EPropertyType::Struct);
+        EXPECT_EQ(serializedBinding.base()->rootInput()->records()->Get(0)->childCount(), 4u);
 
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("name"), m_node->getSceneObjectId())).WillOnce(::testing::Return(m_node));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesNodeBindingImpl> deserializedBinding = RamsesNodeBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -419,6 +420,7 @@ namespace rlogic::internal
         // Deserialize
         {
             EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("node"), m_node->getSceneObjectId())).WillOnce(::testing::Return(m_node));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesNodeBindingImpl> deserializedBinding = RamsesNodeBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedBinding);
@@ -447,6 +449,7 @@ namespace rlogic::internal
             m_node->setRotation(11, 12, 13);
 
             EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("node"), m_node->getSceneObjectId())).WillOnce(::testing::Return(m_node));
+            SerializationTestUtils::ProvideStrings(m_serializationMap, m_deserializationMap);
             std::unique_ptr<RamsesNodeBindingImpl> deserializedBinding = RamsesNodeBindingImpl::Deserialize(serializedBinding, m_resolverMock, m_errorReporting, m_deserializationMap);
 
             EXPECT_EQ(&deserializedBinding->getRamsesNode(), m_node);
@@ -530,7 +533,7 @@ namespace rlogic::internal
                 m_flatBufferBuilder,
                 m_flatBufferBuilder.CreateString("name"),
                 0,
-                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyRootType::Struct, false, true) // rootInput with errors
+                m_testUtils.serializeTestProperty("IN", rlogic_serialization::EPropertyType::Struct, false, true) // rootInput with errors
             );
             auto binding = rlogic_serialization::CreateRamsesNodeBinding(
                 m_flatBufferBuilder,
@@ -540,11 +543,12 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesNodeBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesNodeBindingImpl> deserialized = RamsesNodeBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
-        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing name!");
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing property records!");
     }
 
     TEST_F(ARamsesNodeBinding_SerializationLifecycle, ErrorWhenBoundNodeCannotBeResolved)
@@ -571,6 +575,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("name"), mockObjectId)).WillOnce(::testing::Return(nullptr));
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesNodeBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesNodeBindingImpl> deserialized = RamsesNodeBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -606,6 +611,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("name"), mockObjectId)).WillOnce(::testing::Return(meshNode));
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::RamsesNodeBinding>(m_flatBufferBuilder.GetBufferPointer());
+        m_testUtils.provideStrings(m_deserializationMap);
         std::unique_ptr<RamsesNodeBindingImpl> deserialized = RamsesNodeBindingImpl::Deserialize(serialized, m_resolverMock, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
@@ -936,10 +942,10 @@ namespace rlogic::internal
         m_logicEngine.update();
         ExpectValues(*m_node, ENodePropertyStaticIndex::Rotation, vec3f{ 1.f, 2.f, 3.f });
 
-        // As long as link is active, binding overwrites value which was manually set directly to the ramses node
+        // Link only propagates values when the script output changed, value which was manually set directly to the ramses node is not overwritten
         m_node->setRotation(100.f, 100.f, 100.f, ramses::ERotationConvention::XYZ);
         m_logicEngine.update();
-        ExpectValues(*m_node, ENodePropertyStaticIndex::Rotation, vec3f{ 1.f, 2.f, 3.f });
+        ExpectValues(*m_node, ENodePropertyStaticIndex::Rotation, vec3f{ 100.f, 100.f, 100.f });
 
         // Remove link -> value is not overwritten any more
         ASSERT_TRUE(m_logicEngine.unlink(*script->getOutputs()->getChild("rotation"), *nodeBinding.getInputs()->getChild("rotation")));
@@ -8,9 +8,14 @@
 
 #pragma once
 
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+
 #include "generated/LuaScriptGen.h"
 #include "generated/PropertyGen.h"
 
+#include <deque>
+
 namespace rlogic::internal
 {
     class SerializationTestUtils
@@ -21,41 +26,36 @@ namespace rlogic::internal
         {
         }
 
-        flatbuffers::Offset<rlogic_serialization::Property> serializeTestProperty(
+        flatbuffers::Offset<rlogic_serialization::PropertyTree> serializeTestProperty(
             std::string_view name,
-            rlogic_serialization::EPropertyRootType type = rlogic_serialization::EPropertyRootType::Struct,
+            rlogic_serialization::EPropertyType type = rlogic_serialization::EPropertyType::Struct,
             bool withChildren = true,
             bool withErrors = false)
         {
             if (withErrors)
             {
-                // Unnamed property -> causes errors down the hierarchy
-                return rlogic_serialization::CreateProperty(
+                // No property records -> causes errors
+                return rlogic_serialization::CreatePropertyTree(
                     m_builder,
                     0);
             }
 
+            std::vector<rlogic_serialization::PropertyRecord> records{
+                rlogic_serialization::PropertyRecord(type, storeString(name), 1u, withChildren ? 1u : 0u)
+            };
+
             if (withChildren)
             {
-                auto child = rlogic_serialization::CreateProperty(
-                    m_builder,
-                    m_builder.CreateString("child"),
-                    rlogic_serialization::EPropertyRootType::Primitive,
-                    0,
-                    rlogic_serialization::PropertyValue::float_s,
-                    m_builder.CreateStruct(rlogic_serialization::float_s{0.42f}).Union()
-                );
-                return rlogic_serialization::CreateProperty(
+                records.emplace_back(rlogic_serialization::EPropertyType::Float, storeString("child"), 0u, 0u);
+                return rlogic_serialization::CreatePropertyTree(
                     m_builder,
-                    m_builder.CreateString(name),
-                    type,
-                    m_builder.CreateVector(std::vector{child}));
+                    m_builder.CreateVectorOfStructs(records),
+                    m_builder.CreateVector(std::vector<float>{0.42f}));
             }
 
-            return rlogic_serialization::CreateProperty(
+            return rlogic_serialization::CreatePropertyTree(
                 m_builder,
-                m_builder.CreateString(name),
-                type);
+                m_builder.CreateVectorOfStructs(records));
         }
 
         flatbuffers::Offset<rlogic_serialization::LuaScript> serializeTestScript(bool withErrors = false)
@@ -78,6 +78,30 @@ namespace rlogic::internal
             );
         }
 
+        // Adds a string to the string table of the test data and returns its index
+        uint32_t storeString(std::string_view str)
+        {
+            m_strings.emplace_back(str);
+            return static_cast<uint32_t>(m_strings.size() - 1u);
+        }
+
+        // Makes the strings of the test data available for deserialization
+        void provideStrings(DeserializationMap& deserializationMap) const
+        {
+            deserializationMap.storeStrings({ m_strings.cbegin(), m_strings.cend() });
+        }
+
+        // Makes the strings collected during serialization available for deserialization
+        static void ProvideStrings(const SerializationMap& serializationMap, DeserializationMap& deserializationMap)
+        {
+            const auto& strings = serializationMap.getStrings();
+            deserializationMap.storeStrings({ strings.cbegin(), strings.cend() });
+        }
+
         flatbuffers::FlatBufferBuilder& m_builder;
+
+    private:
+        // deque keeps the strings at stable addresses
+        std::deque<std::string> m_strings;
     };
 }
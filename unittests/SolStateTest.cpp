@@ -128,4 +128,103 @@ namespace rlogic::internal
         dataStatus = script();
         EXPECT_EQ(dataStatus, "data: a lot of data!");
     }
+
+    TEST_F(ASolState, StoresBytecodeInChunkCache_WhenLoadingScriptSuccessfully)
+    {
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get(m_valid_empty_script);
+        EXPECT_TRUE(chunk->bytecode.empty());
+
+        auto load_result = m_solState.loadScript(m_valid_empty_script, "script", *chunk);
+        EXPECT_TRUE(load_result.valid());
+        EXPECT_FALSE(chunk->bytecode.empty());
+        EXPECT_EQ(1u, m_solState.getChunkCache().size());
+    }
+
+    TEST_F(ASolState, DoesNotStoreBytecodeInChunkCache_WhenScriptHasErrors)
+    {
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get("this.does.not.compile");
+        auto load_result = m_solState.loadScript("this.does.not.compile", "script", *chunk);
+        EXPECT_FALSE(load_result.valid());
+        EXPECT_TRUE(chunk->bytecode.empty());
+    }
+
+    TEST_F(ASolState, ChunkCache_SharesEntriesOfSameSource)
+    {
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get("source");
+        EXPECT_EQ("source", chunk->source);
+        EXPECT_EQ(chunk, m_solState.getChunkCache().get("source"));
+        std::shared_ptr<CompiledChunk> otherChunk = m_solState.getChunkCache().get("other source");
+        EXPECT_NE(chunk, otherChunk);
+        EXPECT_EQ(2u, m_solState.getChunkCache().size());
+    }
+
+    TEST_F(ASolState, ChunkCache_RemovesEntriesWhenTheyAreNotUsedAnymore)
+    {
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get("source");
+        std::shared_ptr<CompiledChunk> sameChunk = m_solState.getChunkCache().get("source");
+        (void)m_solState.getChunkCache().get("unused source");
+        EXPECT_EQ(1u, m_solState.getChunkCache().size());
+
+        chunk.reset();
+        EXPECT_EQ(1u, m_solState.getChunkCache().size());
+        sameChunk.reset();
+        EXPECT_EQ(0u, m_solState.getChunkCache().size());
+    }
+
+    TEST_F(ASolState, ChunkCache_EntriesCanOutliveTheCache)
+    {
+        std::shared_ptr<CompiledChunk> chunk;
+        {
+            CompiledChunkCache cache;
+            chunk = cache.get("source");
+        }
+        EXPECT_EQ("source", chunk->source);
+    }
+
+    TEST_F(ASolState, LoadsCachedBytecodeWithChunkNameOfLoadedScript)
+    {
+        const std::string_view source = R"(
+            error("failed")
+        )";
+
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get(source);
+        sol::protected_function script1 = m_solState.loadScript(source, "script1", *chunk);
+        ASSERT_FALSE(chunk->bytecode.empty());
+        sol::protected_function script2 = m_solState.loadScript(source, "script2", *chunk);
+
+        sol::protected_function_result result1 = script1();
+        sol::protected_function_result result2 = script2();
+        ASSERT_FALSE(result1.valid());
+        ASSERT_FALSE(result2.valid());
+        sol::error error1 = result1;
+        sol::error error2 = result2;
+        EXPECT_THAT(error1.what(), ::testing::HasSubstr("[string \"script1\"]:2: failed"));
+        EXPECT_THAT(error2.what(), ::testing::HasSubstr("[string \"script2\"]:2: failed"));
+    }
+
+    TEST_F(ASolState, LoadsScriptFromCachedBytecode_WithOwnEnvironment)
+    {
+        const std::string_view source = R"(
+            return data
+        )";
+
+        std::shared_ptr<CompiledChunk> chunk = m_solState.getChunkCache().get(source);
+        sol::protected_function script1 = m_solState.loadScript(source, "script", *chunk);
+        ASSERT_FALSE(chunk->bytecode.empty());
+        // The source is not parsed anymore once the bytecode is available
+        sol::protected_function script2 = m_solState.loadScript("this.does.not.compile", "script", *chunk);
+        ASSERT_TRUE(script2.valid());
+
+        sol::environment env1 = m_solState.createEnvironment();
+        sol::environment env2 = m_solState.createEnvironment();
+        env1["data"] = "env1";
+        env2["data"] = "env2";
+        env1.set_on(script1);
+        env2.set_on(script2);
+
+        std::string data1 = script1();
+        std::string data2 = script2();
+        EXPECT_EQ(data1, "env1");
+        EXPECT_EQ(data2, "env2");
+    }
 }